@@ -0,0 +1,242 @@
+#ifndef BENCH_HARNESS_H
+#define BENCH_HARNESS_H
+
+#include "audio/audio_config.h"
+#include "profiling/histogram.h"
+#include "profiling/steady_time.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/** Results of the two backends measure different things and are never compared, see libs/fmod_fake */
+#if defined(FMOD_CMAKE_FAKE_FMOD)
+constexpr auto BENCHMARK_FMOD_BACKEND = "fake";
+#else
+constexpr auto BENCHMARK_FMOD_BACKEND = "fmod";
+#endif
+
+/** Keeps the compiler from optimizing away a benchmarked result */
+template <typename T>
+inline void DoNotOptimize(const T& value)
+{
+#if defined(_MSC_VER)
+	static const volatile void* sSink = nullptr;
+	sSink = &value;
+	_ReadWriteBarrier();
+#else
+	asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+/** Section names can contain dots ([Budget.Cover]), the key never does. Expects Section.Key=Value. */
+inline bool ApplyConfigOverride(const std::string& assignment)
+{
+	const auto valueIndex = assignment.find('=');
+	if (valueIndex == std::string::npos) { return false; }
+
+	const auto keyIndex = assignment.rfind('.', valueIndex);
+	if (keyIndex == std::string::npos || keyIndex == 0) { return false; }
+
+	AudioConfig::SetOverride(assignment.substr(0, keyIndex), assignment.substr(keyIndex + 1, valueIndex - keyIndex - 1),
+		assignment.substr(valueIndex + 1));
+	return true;
+}
+
+/** No sound card, no Live Update and one mix per AudioEngine::Update on the calling thread.
+ * Call before parsing --set overrides, so they win.
+ */
+inline void ApplyHeadlessConfigDefaults()
+{
+	AudioConfig::SetOverride("System", "OutputType", "NoSoundNRT");
+	AudioConfig::SetOverride("System", "EnableLiveUpdate", "false");
+	AudioConfig::SetOverride("Advanced", "EnableSynchronousUpdate", "true");
+	AudioConfig::SetOverride("Advanced", "EnableAdaptiveUpdate", "false");
+	AudioConfig::SetOverride("Advanced", "EnableBufferAutoSizing", "false");
+}
+
+struct BenchmarkSettings
+{
+	int repetitions = 20;
+	int64_t warmupNs = 100000000;
+	int64_t minRepetitionNs = 10000000; // Iterations per repetition are calibrated to take at least this long
+	std::string filter;                  // Substring of the benchmark name, empty runs everything
+};
+
+struct BenchmarkResult
+{
+	std::string name;
+	uint64_t iterations = 0; // Per repetition
+	std::vector<double> nsPerOp; // One sample per repetition
+	double min = 0;
+	double median = 0;
+	double mean = 0;
+	double stddev = 0;
+	double mad = 0; // Median absolute deviation
+	double max = 0;
+	std::string skippedReason;
+};
+
+/**
+ * @brief Minimal self-contained benchmark runner: warmup, iteration calibration and repetitions
+ * Every repetition times a batch of iterations of the body and records its mean ns per operation, so the
+ * statistics are over repetitions. BetweenBatches runs untimed after every batch (e.g. AudioEngine::Update,
+ * to flush the commands the batch queued) and maxBatchIterations bounds what a single batch can queue.
+ */
+class BenchmarkRunner
+{
+	public:
+		explicit BenchmarkRunner(BenchmarkSettings settings)
+		: mSettings(std::move(settings))
+		{}
+
+		template <typename Body, typename BetweenBatches>
+		void Run(const std::string& name, Body&& body, BetweenBatches&& betweenBatches, const uint64_t maxBatchIterations = UINT64_MAX)
+		{
+			if (!IsSelected(name)) { return; }
+
+			BenchmarkResult result;
+			result.name = name;
+
+			// Warmup doubles the batch until the warmup time is spent, which also calibrates the batch size
+			uint64_t iterations = 1;
+			int64_t batchNs = 0;
+			const int64_t warmupEndNs = GetSteadyTimeNs() + mSettings.warmupNs;
+			do
+			{
+				batchNs = RunBatch(body, iterations);
+				betweenBatches();
+				if (batchNs < mSettings.minRepetitionNs && iterations < maxBatchIterations)
+				{
+					iterations = std::min(iterations * 2, maxBatchIterations);
+				}
+			}
+			while (GetSteadyTimeNs() < warmupEndNs || (batchNs < mSettings.minRepetitionNs && iterations < maxBatchIterations));
+
+			result.iterations = iterations;
+			for (int i = 0; i < std::max(mSettings.repetitions, 1); ++i)
+			{
+				batchNs = RunBatch(body, iterations);
+				betweenBatches();
+				result.nsPerOp.push_back(static_cast<double>(batchNs) / static_cast<double>(iterations));
+			}
+
+			ComputeStatistics(result);
+			mResults.push_back(std::move(result));
+		}
+
+		template <typename Body>
+		void Run(const std::string& name, Body&& body)
+		{
+			Run(name, std::forward<Body>(body), [] {});
+		}
+
+		/** Listed in the output with the reason, so a missing bank or event does not look like a removed benchmark */
+		void Skip(const std::string& name, const std::string& reason)
+		{
+			if (!IsSelected(name)) { return; }
+
+			BenchmarkResult result;
+			result.name = name;
+			result.skippedReason = reason;
+			mResults.push_back(std::move(result));
+		}
+
+		[[nodiscard]] bool IsSelected(const std::string& name) const
+		{
+			return mSettings.filter.empty() || name.find(mSettings.filter) != std::string::npos;
+		}
+
+		[[nodiscard]] const std::vector<BenchmarkResult>& GetResults() const { return mResults; }
+
+		void WriteJson(std::ostream& stream, const std::string& suiteName) const
+		{
+			stream << std::format(R"({{"suite":"{}","backend":"{}","settings":{{"repetitions":{},"warmupMs":{},"minRepetitionMs":{}}},"results":[)",
+				suiteName, BENCHMARK_FMOD_BACKEND, mSettings.repetitions, mSettings.warmupNs / 1000000, mSettings.minRepetitionNs / 1000000);
+
+			for (size_t i = 0; i < mResults.size(); ++i)
+			{
+				const BenchmarkResult& result = mResults[i];
+				stream << (i == 0 ? "\n" : ",\n");
+				if (!result.skippedReason.empty())
+				{
+					stream << std::format(R"({{"name":"{}","skipped":"{}"}})", result.name, result.skippedReason);
+					continue;
+				}
+
+				stream << std::format(R"({{"name":"{}","iterations":{},"repetitions":{},"nsPerOp":{{"min":{:.3f},"median":{:.3f},)"
+					R"("mean":{:.3f},"stddev":{:.3f},"mad":{:.3f},"max":{:.3f}}},"samples":[)",
+					result.name, result.iterations, result.nsPerOp.size(), result.min, result.median,
+					result.mean, result.stddev, result.mad, result.max);
+				for (size_t j = 0; j < result.nsPerOp.size(); ++j)
+				{
+					stream << std::format("{}{:.3f}", j == 0 ? "" : ",", result.nsPerOp[j]);
+				}
+				stream << "]}";
+			}
+			stream << "\n]}" << std::endl;
+		}
+
+		void WriteSummary(std::ostream& stream) const
+		{
+			for (const BenchmarkResult& result : mResults)
+			{
+				if (!result.skippedReason.empty())
+				{
+					stream << std::format("{:<48} skipped: {}", result.name, result.skippedReason) << std::endl;
+					continue;
+				}
+				stream << std::format("{:<48} {:>12.1f} ns/op  (MAD {:.1f}, min {:.1f}, {} x {} iterations)",
+					result.name, result.median, result.mad, result.min, result.nsPerOp.size(), result.iterations) << std::endl;
+			}
+		}
+
+	private:
+		BenchmarkSettings mSettings;
+		std::vector<BenchmarkResult> mResults;
+
+		template <typename Body>
+		static int64_t RunBatch(Body& body, const uint64_t iterations)
+		{
+			const int64_t startNs = GetSteadyTimeNs();
+			for (uint64_t i = 0; i < iterations; ++i)
+			{
+				body();
+			}
+			return GetSteadyTimeNs() - startNs;
+		}
+
+		static double GetMedian(std::vector<double> values)
+		{
+			if (values.empty()) { return 0; }
+
+			std::ranges::sort(values);
+			const size_t middle = values.size() / 2;
+			return values.size() % 2 == 0 ? (values[middle - 1] + values[middle]) * 0.5 : values[middle];
+		}
+
+		static void ComputeStatistics(BenchmarkResult& result)
+		{
+			const std::vector<double>& samples = result.nsPerOp;
+			if (samples.empty()) { return; }
+
+			result.min = *std::ranges::min_element(samples);
+			result.max = *std::ranges::max_element(samples);
+			result.median = GetMedian(samples);
+
+			double sum = 0;
+			for (const double sample : samples) { sum += sample; }
+			result.mean = sum / static_cast<double>(samples.size());
+
+			double squaredSum = 0;
+			std::vector<double> deviations;
+			for (const double sample : samples)
+			{
+				squaredSum += (sample - result.mean) * (sample - result.mean);
+				deviations.push_back(std::abs(sample - result.median));
+			}
+			result.stddev = samples.size() > 1 ? std::sqrt(squaredSum / static_cast<double>(samples.size() - 1)) : 0.0;
+			result.mad = GetMedian(std::move(deviations));
+		}
+};
+#endif
@@ -0,0 +1,199 @@
+/*
+ * Command Replay Benchmark
+ * Replays a Studio command capture (recorded with [Profiling] EnableCommandCapture or the Options menu) against
+ * headless NoSoundNRT output with synchronous updates, so production traffic can be replayed under alternative
+ * audio_engine.ini settings and compared. Every AudioEngine::Update mixes one DSP buffer; by default the replay
+ * keeps the captured timing relative to the Studio clock, --fast-forward executes the commands as fast as possible.
+ * The engine's own banks are unloaded first so the captured bank loads replay as they happened, unless
+ * --skip-bank-load keeps them (and the --bank files) loaded and skips the captured loads instead.
+ * Prints update cost, DSP and Studio CPU, channels, FMOD memory and the faster-than-realtime factor as JSON.
+ *
+ * Usage: FmodCmakeReplay <capture file> [--fast-forward] [--skip-bank-load] [--bank <file>]... [--bank-path <dir>]
+ *                        [--max-ticks 0] [--config <ini>]... [--set <Section.Key=Value>]... [--output <file>]
+ */
+
+#include "bench_harness.h"
+
+#include "audio/audio_engine.h"
+
+namespace
+{
+	struct ReplayOptions
+	{
+		std::string capturePath;
+		std::vector<std::string> banks;
+		std::string bankPath;
+		bool bFastForward = false;
+		bool bSkipBankLoad = false;
+		uint64_t maxTicks = 0;
+		std::string outputPath;
+	};
+
+	void PrintUsage(const char* program)
+	{
+		std::cout << std::format("Usage: {} <capture file> [--fast-forward] [--skip-bank-load] [--bank <file>]... [--bank-path <dir>]\n"
+			"    [--max-ticks 0] [--config <ini>]... [--set <Section.Key=Value>]... [--output <file>]", program) << std::endl;
+	}
+
+	bool ParseOptions(const int argc, char* argv[], ReplayOptions& outOptions)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string argument = argv[i];
+			if (argument == "--fast-forward") { outOptions.bFastForward = true; continue; }
+			if (argument == "--skip-bank-load") { outOptions.bSkipBankLoad = true; continue; }
+			if (!argument.starts_with("--"))
+			{
+				if (!outOptions.capturePath.empty()) { return false; }
+				outOptions.capturePath = argument;
+				continue;
+			}
+			if (i + 1 >= argc) { return false; }
+
+			const std::string value = argv[++i];
+			if (argument == "--bank") { outOptions.banks.push_back(value); }
+			else if (argument == "--bank-path") { outOptions.bankPath = value; }
+			else if (argument == "--max-ticks") { outOptions.maxTicks = std::strtoull(value.c_str(), nullptr, 10); }
+			else if (argument == "--config") { if (!AudioConfig::SetOverridesFromFile(value)) { return false; } }
+			else if (argument == "--set") { if (!ApplyConfigOverride(value)) { return false; } }
+			else if (argument == "--output") { outOptions.outputPath = value; }
+			else { return false; }
+		}
+		return !outOptions.capturePath.empty();
+	}
+}
+
+int main(const int argc, char* argv[])
+{
+	ApplyHeadlessConfigDefaults();
+	// Replaying with the capture on would overwrite the file being replayed
+	AudioConfig::SetOverride("Profiling", "EnableCommandCapture", "false");
+
+	ReplayOptions options;
+	if (!ParseOptions(argc, argv, options))
+	{
+		PrintUsage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	if (!AudioEngine::Initialize())
+	{
+		std::cerr << "AudioEngine failed to initialize, run from the build directory (config/ and assets/ next to the executable)" << std::endl;
+		AudioEngine::Terminate();
+		return EXIT_FAILURE;
+	}
+
+	if (options.bSkipBankLoad)
+	{
+		for (const auto& bank : options.banks)
+		{
+			if (!AudioEngine::LoadSoundBankFile(bank))
+			{
+				std::cerr << std::format("Cannot load bank {}", bank) << std::endl;
+				AudioEngine::Terminate();
+				return EXIT_FAILURE;
+			}
+		}
+	}
+	else
+	{
+		AudioEngine::UnloadAllSoundBanks();
+		AudioEngine::Update();
+	}
+
+	AudioCommandReplayFlags flags = FMOD_STUDIO_COMMANDREPLAY_NORMAL;
+	if (options.bFastForward) { flags |= FMOD_STUDIO_COMMANDREPLAY_FAST_FORWARD; }
+	if (options.bSkipBankLoad) { flags |= FMOD_STUDIO_COMMANDREPLAY_SKIP_BANK_LOAD; }
+
+	AudioCommandReplay* replay = nullptr;
+	if (!AudioEngine::LoadCommandReplay(options.capturePath, flags, replay))
+	{
+		std::cerr << std::format("Cannot load the command capture {}", options.capturePath) << std::endl;
+		AudioEngine::Terminate();
+		return EXIT_FAILURE;
+	}
+	if (!options.bankPath.empty()) { replay->setBankPath(options.bankPath.c_str()); }
+
+	int commandCount = 0;
+	float captureSeconds = 0;
+	replay->getCommandCount(&commandCount);
+	replay->getLength(&captureSeconds);
+
+	HdrHistogram updateNs;
+	double dspCPUSum = 0;
+	float dspCPUMax = 0;
+	double studioCPUSum = 0;
+	float studioCPUMax = 0;
+	int channelsPlayingMax = 0;
+	int realChannelsPlayingMax = 0;
+	int memoryMaxBytes = 0;
+	int currentCommand = 0;
+	float currentSeconds = 0;
+
+	uint64_t startSamples = 0;
+	uint64_t currentSamples = 0;
+	int sampleRate = 0;
+	AudioEngine::GetMixerClock(startSamples, sampleRate);
+	currentSamples = startSamples;
+
+	const int64_t startNs = GetSteadyTimeNs();
+	replay->start();
+
+	uint64_t ticks = 0;
+	for (FMOD_STUDIO_PLAYBACK_STATE state = FMOD_STUDIO_PLAYBACK_STARTING; state != FMOD_STUDIO_PLAYBACK_STOPPED; ++ticks)
+	{
+		if (options.maxTicks > 0 && ticks >= options.maxTicks) { break; }
+
+		const int64_t updateStartNs = GetSteadyTimeNs();
+		AudioEngine::Update();
+		updateNs.Record(static_cast<uint64_t>(GetSteadyTimeNs() - updateStartNs));
+
+		if (replay->getPlaybackState(&state) != FMOD_OK) { break; }
+		replay->getCurrentCommand(&currentCommand, &currentSeconds);
+		AudioEngine::GetMixerClock(currentSamples, sampleRate);
+
+		if (AudioEngineStats stats; AudioEngine::GetStatsSnapshot(stats))
+		{
+			dspCPUSum += stats.coreCPU.dsp;
+			dspCPUMax = std::max(dspCPUMax, stats.coreCPU.dsp);
+			studioCPUSum += stats.studioCPU.update;
+			studioCPUMax = std::max(studioCPUMax, stats.studioCPU.update);
+			channelsPlayingMax = std::max(channelsPlayingMax, stats.channelsPlaying);
+			realChannelsPlayingMax = std::max(realChannelsPlayingMax, stats.realChannelsPlaying);
+			memoryMaxBytes = std::max(memoryMaxBytes, stats.memoryMaxBytes);
+		}
+	}
+
+	const double wallSeconds = static_cast<double>(GetSteadyTimeNs() - startNs) * 1e-9;
+	const double audioSeconds = sampleRate > 0 ? static_cast<double>(currentSamples - startSamples) / sampleRate : 0.0;
+	const double tickCount = static_cast<double>(std::max<uint64_t>(ticks, 1));
+
+	const std::string report = std::format(
+		"{{\"benchmark\":\"command_replay\",\"backend\":\"{}\",\"capture\":\"{}\",\"fastForward\":{},\"skipBankLoad\":{},"
+		"\"commands\":{},\"commandsReplayed\":{},\"captureSeconds\":{:.4f},\"replayedSeconds\":{:.4f},"
+		"\"ticks\":{},\"wallSeconds\":{:.4f},\"audioSeconds\":{:.4f},\"realtimeFactor\":{:.3f},\"updateMs\":{},"
+		"\"dspCPUPercent\":{{\"mean\":{:.3f},\"max\":{:.3f}}},\"studioUpdateCPUPercent\":{{\"mean\":{:.3f},\"max\":{:.3f}}},"
+		"\"channelsPlayingMax\":{},\"realChannelsPlayingMax\":{},\"memoryMaxBytes\":{}}}",
+		BENCHMARK_FMOD_BACKEND, options.capturePath, options.bFastForward, options.bSkipBankLoad,
+		commandCount, currentCommand, captureSeconds, currentSeconds,
+		ticks, wallSeconds, audioSeconds, wallSeconds > 0 ? audioSeconds / wallSeconds : 0.0, FormatHistogramMs(updateNs),
+		dspCPUSum / tickCount, dspCPUMax, studioCPUSum / tickCount, studioCPUMax,
+		channelsPlayingMax, realChannelsPlayingMax, memoryMaxBytes);
+
+	replay->stop();
+	replay->release();
+	AudioEngine::Terminate();
+
+	if (!options.outputPath.empty())
+	{
+		std::ofstream outputFile(options.outputPath);
+		if (!outputFile)
+		{
+			std::cerr << std::format("Cannot write {}", options.outputPath) << std::endl;
+			return EXIT_FAILURE;
+		}
+		outputFile << report << std::endl;
+	}
+	std::cout << report << std::endl;
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,338 @@
+/*
+ * Engine Microbenchmarks
+ * Times the wrapper layer hot paths: AudioConfig parsing and getters, PlayAudioEvent, parameters by name and by ID,
+ * GetNormalizedVolumeInRange, bus and VCA getters and InputEvent dispatch. The engine runs headless (NoSoundNRT).
+ * Prints a summary and writes every repetition sample as JSON, for comparing runs.
+ *
+ * Usage: FmodCmakeBench [--filter <substring>] [--repetitions 20] [--warmup-ms 100] [--min-time-ms 10]
+ *                       [--set <Section.Key=Value>]... [--output <file>]
+ */
+
+#include "bench_harness.h"
+
+#include "audio/audio_engine.h"
+#include "input/input_events.h"
+
+namespace
+{
+	constexpr auto BENCH_EVENT = "event:/MusicTest";
+	constexpr auto BENCH_BANK = "Music.bank";
+	constexpr auto BENCH_PARAMETER_EVENT = "event:/ProgrammerSound_VO";
+	constexpr auto BENCH_PARAMETER_BANK = "ProgrammerSounds_Basic.bank";
+	constexpr auto BENCH_PARAMETER = "ReverbSendValue";
+	constexpr auto BENCH_BUS = "bus:/";
+	constexpr auto BENCH_VCA = "vca:/Master_VCA";
+
+	// Commands queued by a batch are flushed by the untimed update that follows it
+	constexpr uint64_t MAX_PLAY_BATCH = 256;
+
+	void PrintUsage(const char* program)
+	{
+		std::cout << std::format("Usage: {} [--filter <substring>] [--repetitions 20] [--warmup-ms 100] [--min-time-ms 10]\n"
+			"    [--set <Section.Key=Value>]... [--output <file>]", program) << std::endl;
+	}
+
+	void RunHelperBenchmarks(BenchmarkRunner& runner)
+	{
+		float controlPercent = 0;
+		runner.Run("helpers/get_normalized_volume_in_range", [&controlPercent]
+		{
+			controlPercent = controlPercent >= 100.0f ? 0.0f : controlPercent + 0.37f;
+			DoNotOptimize(AudioEngine::GetNormalizedVolumeInRange(controlPercent));
+		});
+	}
+
+	// Mirrors how Application::HandleEvents and GUI::ConsumeInputEvents dispatch, and the std::visit alternative
+	void RunInputEventBenchmarks(BenchmarkRunner& runner)
+	{
+		const std::vector<InputEvent> events = {
+			ToggleProfilerOverlayEvent(), OpenPageEvent{ "Cover" }, ToggleAudioInfoOverlayEvent(),
+			ToggleDSPGraphOverlayEvent(), ToggleAudioVolumeWindowEvent(), QuitRequestedEvent(),
+			OpenPageEvent{ "ProgrammerSounds" }, ToggleProfilerOverlayEvent()
+		};
+
+		size_t eventIndex = 0;
+		int handledCount = 0;
+		runner.Run("input/dispatch_holds_alternative", [&]
+		{
+			const InputEvent& inputEvent = events[eventIndex++ % events.size()];
+			if (std::holds_alternative<QuitRequestedEvent>(inputEvent)) { handledCount += 1; }
+			else if (const auto* openPage = std::get_if<OpenPageEvent>(&inputEvent)) { handledCount += static_cast<int>(openPage->page_name.size()); }
+			else if (std::holds_alternative<ToggleAudioInfoOverlayEvent>(inputEvent)) { handledCount += 2; }
+			else if (std::holds_alternative<ToggleAudioVolumeWindowEvent>(inputEvent)) { handledCount += 3; }
+			else if (std::holds_alternative<ToggleDSPGraphOverlayEvent>(inputEvent)) { handledCount += 4; }
+			else if (std::holds_alternative<ToggleProfilerOverlayEvent>(inputEvent)) { handledCount += 5; }
+			DoNotOptimize(handledCount);
+		});
+
+		struct InputEventVisitor
+		{
+			int& handledCount;
+			void operator()(const QuitRequestedEvent&) const { handledCount += 1; }
+			void operator()(const OpenPageEvent& openPage) const { handledCount += static_cast<int>(openPage.page_name.size()); }
+			void operator()(const ToggleAudioInfoOverlayEvent&) const { handledCount += 2; }
+			void operator()(const ToggleAudioVolumeWindowEvent&) const { handledCount += 3; }
+			void operator()(const ToggleDSPGraphOverlayEvent&) const { handledCount += 4; }
+			void operator()(const ToggleProfilerOverlayEvent&) const { handledCount += 5; }
+			void operator()(const ToggleCommandCaptureEvent&) const { handledCount += 7; }
+			void operator()(const PlayProgrammerSoundEvent& playSound) const { handledCount += static_cast<int>(playSound.key.size()); }
+			void operator()(const StopProgrammerSoundEvent&) const { handledCount += 8; }
+			void operator()(const SetReverbEnabledEvent& setReverb) const { handledCount += setReverb.enabled ? 9 : 10; }
+			void operator()(const SelectLocaleEvent& selectLocale) const { handledCount += static_cast<int>(selectLocale.locale.size()); }
+			void operator()(const SetVolumeEvent&) const { handledCount += 6; }
+		};
+
+		runner.Run("input/dispatch_visit", [&]
+		{
+			std::visit(InputEventVisitor{ handledCount }, events[eventIndex++ % events.size()]);
+			DoNotOptimize(handledCount);
+		});
+
+		// What a frame pays to queue and clear its events, OpenPageEvent carries a string
+		std::vector<InputEvent> frameEvents;
+		frameEvents.reserve(events.size());
+		runner.Run("input/queue_and_clear_frame", [&]
+		{
+			frameEvents.insert(frameEvents.end(), events.begin(), events.end());
+			DoNotOptimize(frameEvents.data());
+			frameEvents.clear();
+		});
+	}
+
+	void RunEventBenchmarks(BenchmarkRunner& runner)
+	{
+		if (!AudioEngine::LoadSoundBankFile(BENCH_BANK))
+		{
+			runner.Skip("engine/play_event_start_release", std::format("cannot load {}", BENCH_BANK));
+			runner.Skip("engine/play_event_create_release", std::format("cannot load {}", BENCH_BANK));
+			return;
+		}
+
+		const auto update = [] { AudioEngine::Update(); };
+
+		// The event loops, so every batch stops what it started or the instances pile up across repetitions
+		AudioBus* masterBus = nullptr;
+		AudioEngine::GetBus(BENCH_BUS, masterBus);
+		const auto stopAndUpdate = [masterBus]
+		{
+			if (masterBus) { AudioEngine::BusStopAllAudioEvents(masterBus, false); }
+			AudioEngine::Update();
+		};
+
+		runner.Run("engine/play_event_start_release", []
+		{
+			DoNotOptimize(AudioEngine::PlayAudioEvent(BENCH_EVENT));
+		}, stopAndUpdate, MAX_PLAY_BATCH);
+
+		runner.Run("engine/play_event_create_release", []
+		{
+			AudioInstance* instance = AudioEngine::PlayAudioEvent(BENCH_EVENT, Audio3DAttributes(), nullptr, nullptr,
+				FMOD_STUDIO_EVENT_CALLBACK_ALL, false, false);
+			AudioEngine::InstanceRelease(instance);
+		}, update, MAX_PLAY_BATCH);
+	}
+
+	void RunParameterBenchmarks(BenchmarkRunner& runner)
+	{
+		AudioInstance* instance = nullptr;
+		AudioParameterID parameterID = {};
+		if (AudioEngine::LoadSoundBankFile(BENCH_PARAMETER_BANK))
+		{
+			// Never started, setting parameters on a created instance is enough and needs no programmer sound
+			instance = AudioEngine::PlayAudioEvent(BENCH_PARAMETER_EVENT, Audio3DAttributes(), nullptr, nullptr,
+				FMOD_STUDIO_EVENT_CALLBACK_ALL, false, false);
+		}
+
+		if (!(instance && AudioEngine::GetParameterID(instance, BENCH_PARAMETER, parameterID)))
+		{
+			const std::string reason = std::format("no {} parameter on {}", BENCH_PARAMETER, BENCH_PARAMETER_EVENT);
+			runner.Skip("parameters/set_by_name", reason);
+			runner.Skip("parameters/set_by_id", reason);
+			runner.Skip("parameters/get_id", reason);
+			AudioEngine::InstanceRelease(instance);
+			return;
+		}
+
+		const auto update = [] { AudioEngine::Update(); };
+		float value = 0;
+
+		runner.Run("parameters/set_by_name", [instance, &value]
+		{
+			value = value >= 1.0f ? 0.0f : value + 0.01f;
+			AudioEngine::SetParameterByName(instance, BENCH_PARAMETER, value);
+		}, update);
+
+		runner.Run("parameters/set_by_id", [instance, parameterID, &value]
+		{
+			value = value >= 1.0f ? 0.0f : value + 0.01f;
+			AudioEngine::SetParameterByID(instance, parameterID, value);
+		}, update);
+
+		runner.Run("parameters/get_id", [instance]
+		{
+			AudioParameterID id = {};
+			AudioEngine::GetParameterID(instance, BENCH_PARAMETER, id);
+			DoNotOptimize(id);
+		});
+
+		AudioEngine::InstanceRelease(instance);
+		AudioEngine::Update();
+	}
+
+	void RunMixerBenchmarks(BenchmarkRunner& runner)
+	{
+		AudioBus* bus = nullptr;
+		if (AudioEngine::GetBus(BENCH_BUS, bus))
+		{
+			runner.Run("buses/get_bus", []
+			{
+				AudioBus* outBus = nullptr;
+				AudioEngine::GetBus(BENCH_BUS, outBus);
+				DoNotOptimize(outBus);
+			});
+			runner.Run("buses/get_volume", [bus]
+			{
+				float volume = 0;
+				float finalVolume = 0;
+				AudioEngine::BusGetVolume(bus, volume, finalVolume);
+				DoNotOptimize(finalVolume);
+			});
+			runner.Run("buses/is_muted", [bus]
+			{
+				bool bMuted = false;
+				AudioEngine::BusIsMuted(bus, bMuted);
+				DoNotOptimize(bMuted);
+			});
+		}
+		else
+		{
+			runner.Skip("buses/get_bus", std::format("no {}", BENCH_BUS));
+		}
+
+		AudioVCA* vca = nullptr;
+		if (AudioEngine::GetVCA(BENCH_VCA, vca))
+		{
+			runner.Run("vcas/get_vca", []
+			{
+				AudioVCA* outVCA = nullptr;
+				AudioEngine::GetVCA(BENCH_VCA, outVCA);
+				DoNotOptimize(outVCA);
+			});
+			runner.Run("vcas/get_volume", [vca]
+			{
+				float volume = 0;
+				float finalVolume = 0;
+				AudioEngine::VCA_GetVolume(vca, volume, finalVolume);
+				DoNotOptimize(finalVolume);
+			});
+		}
+		else
+		{
+			runner.Skip("vcas/get_vca", std::format("no {}", BENCH_VCA));
+		}
+	}
+
+	void RunConfigBenchmarks(BenchmarkRunner& runner)
+	{
+		runner.Run("config/load_config_file", []
+		{
+			AudioConfig config;
+			DoNotOptimize(config.LoadConfigFile(AUDIO_CONFIG_FILE_PATH));
+		});
+
+		const AudioConfig& config = AudioConfig::Get();
+		if (!config.IsLoaded())
+		{
+			runner.Skip("config/getters", std::format("cannot open {}", AUDIO_CONFIG_FILE_PATH));
+			return;
+		}
+
+		runner.Run("config/get_string", [&config]
+		{
+			DoNotOptimize(config.GetString("Banks", "BankOutputDirectory"));
+		});
+		runner.Run("config/get_int", [&config]
+		{
+			DoNotOptimize(config.GetInt("System", "MaxChannelCount", 128));
+		});
+		runner.Run("config/get_int_missing", [&config]
+		{
+			DoNotOptimize(config.GetInt("System", "NotAKey", 128));
+		});
+		runner.Run("config/get_float", [&config]
+		{
+			DoNotOptimize(config.GetFloat("Advanced", "Vol0VirtualLevel"));
+		});
+		runner.Run("config/get_bool", [&config]
+		{
+			DoNotOptimize(config.GetBool("System", "EnableLiveUpdate"));
+		});
+		runner.Run("config/get_string_array", [&config]
+		{
+			DoNotOptimize(config.GetStringArray("Metering", "MeteredBuses").size());
+		});
+	}
+}
+
+int main(const int argc, char* argv[])
+{
+	ApplyHeadlessConfigDefaults();
+
+	BenchmarkSettings settings;
+	std::string outputPath;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string argument = argv[i];
+		if (i + 1 >= argc)
+		{
+			PrintUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+
+		const std::string value = argv[++i];
+		if (argument == "--filter") { settings.filter = value; }
+		else if (argument == "--repetitions") { settings.repetitions = std::max(std::atoi(value.c_str()), 1); }
+		else if (argument == "--warmup-ms") { settings.warmupNs = std::max<int64_t>(std::atoll(value.c_str()), 0) * 1000000; }
+		else if (argument == "--min-time-ms") { settings.minRepetitionNs = std::max<int64_t>(std::atoll(value.c_str()), 1) * 1000000; }
+		else if (argument == "--output") { outputPath = value; }
+		else if (argument != "--set" || !ApplyConfigOverride(value))
+		{
+			PrintUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	BenchmarkRunner runner(settings);
+	RunConfigBenchmarks(runner);
+	RunHelperBenchmarks(runner);
+	RunInputEventBenchmarks(runner);
+
+	if (AudioEngine::Initialize())
+	{
+		RunEventBenchmarks(runner);
+		RunParameterBenchmarks(runner);
+		RunMixerBenchmarks(runner);
+	}
+	else
+	{
+		runner.Skip("engine", "AudioEngine failed to initialize, run from the build directory");
+	}
+	AudioEngine::Terminate();
+
+	runner.WriteSummary(std::cout);
+	if (!outputPath.empty())
+	{
+		std::ofstream outputFile(outputPath);
+		if (!outputFile)
+		{
+			std::cerr << std::format("Cannot write {}", outputPath) << std::endl;
+			return EXIT_FAILURE;
+		}
+		runner.WriteJson(outputFile, "FmodCmakeBench");
+	}
+	else
+	{
+		runner.WriteJson(std::cout, "FmodCmakeBench");
+	}
+	return EXIT_SUCCESS;
+}
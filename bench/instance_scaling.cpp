@@ -0,0 +1,285 @@
+/*
+ * Instance Scaling Stress
+ * Ramps the number of live instances of each event (10 to 10,000 by default) and measures, at every step,
+ * AudioEngine::Update time, Studio update time, DSP CPU, playing and real channels, virtualization churn,
+ * FMOD memory and Studio command queue / handle buffer usage. Headless, NoSoundNRT with synchronous updates
+ * by default, so channel counts are compared against [System] MaxChannelCount and [Advanced] RealChannelCount.
+ * 2D events play at the listener, 3D events are spread around it up to --max-distance.
+ * Writes one CSV row per event and step: the scaling curve used to pick voice limits.
+ *
+ * Usage: FmodCmakeScaling [--bank <file>]... [--event <studio path>]... [--steps 10,20,...,10000]
+ *                         [--starts-per-tick 250] [--settle-ticks 20] [--measure-ticks 200] [--max-distance 50]
+ *                         [--set <Section.Key=Value>]... [--output <file>]
+ */
+
+#include "bench_harness.h"
+
+#include "audio/audio_engine.h"
+#include "profiling/histogram.h"
+
+namespace
+{
+	constexpr auto DEFAULT_BANK = "Music.bank";
+	constexpr auto DEFAULT_EVENT = "event:/MusicTest";
+
+	struct ScalingOptions
+	{
+		std::vector<std::string> banks;
+		std::vector<std::string> events;
+		std::vector<int> steps = { 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000 };
+		int startsPerTick = 250;
+		int settleTicks = 20;
+		int measureTicks = 200;
+		float maxDistance = 50;
+		std::string outputPath;
+	};
+
+	std::atomic<uint64_t> sRealToVirtualCount = 0;
+	std::atomic<uint64_t> sVirtualToRealCount = 0;
+
+	FMOD_RESULT F_CALL CountVirtualization(const FMOD_STUDIO_EVENT_CALLBACK_TYPE type, FMOD_STUDIO_EVENTINSTANCE*, void*)
+	{
+		if (type == FMOD_STUDIO_EVENT_CALLBACK_REAL_TO_VIRTUAL) { sRealToVirtualCount.fetch_add(1, std::memory_order_relaxed); }
+		else if (type == FMOD_STUDIO_EVENT_CALLBACK_VIRTUAL_TO_REAL) { sVirtualToRealCount.fetch_add(1, std::memory_order_relaxed); }
+		return FMOD_OK;
+	}
+
+	void PrintUsage(const char* program)
+	{
+		std::cout << std::format("Usage: {} [--bank <file>]... [--event <studio path>]... [--steps 10,20,...,10000]\n"
+			"    [--starts-per-tick 250] [--settle-ticks 20] [--measure-ticks 200] [--max-distance 50]\n"
+			"    [--set <Section.Key=Value>]... [--output <file>]", program) << std::endl;
+	}
+
+	bool ParseSteps(const std::string& text, std::vector<int>& outSteps)
+	{
+		outSteps.clear();
+		std::stringstream stream(text);
+		std::string item;
+		while (std::getline(stream, item, ','))
+		{
+			const int step = std::atoi(item.c_str());
+			if (step <= 0 || (!outSteps.empty() && step <= outSteps.back())) { return false; }
+			outSteps.push_back(step);
+		}
+		return !outSteps.empty();
+	}
+
+	bool ParseOptions(const int argc, char* argv[], ScalingOptions& outOptions)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string argument = argv[i];
+			if (i + 1 >= argc) { return false; }
+
+			const std::string value = argv[++i];
+			if (argument == "--bank") { outOptions.banks.push_back(value); }
+			else if (argument == "--event") { outOptions.events.push_back(value); }
+			else if (argument == "--steps") { if (!ParseSteps(value, outOptions.steps)) { return false; } }
+			else if (argument == "--starts-per-tick") { outOptions.startsPerTick = std::max(std::atoi(value.c_str()), 1); }
+			else if (argument == "--settle-ticks") { outOptions.settleTicks = std::max(std::atoi(value.c_str()), 0); }
+			else if (argument == "--measure-ticks") { outOptions.measureTicks = std::max(std::atoi(value.c_str()), 1); }
+			else if (argument == "--max-distance") { outOptions.maxDistance = std::strtof(value.c_str(), nullptr); }
+			else if (argument == "--set") { if (!ApplyConfigOverride(value)) { return false; } }
+			else if (argument == "--output") { outOptions.outputPath = value; }
+			else { return false; }
+		}
+
+		if (outOptions.events.empty())
+		{
+			outOptions.events.emplace_back(DEFAULT_EVENT);
+			if (outOptions.banks.empty()) { outOptions.banks.emplace_back(DEFAULT_BANK); }
+		}
+		return true;
+	}
+
+	// Golden angle spiral from 1 m to maxDistance, so the far instances attenuate below the virtual level
+	Audio3DAttributes GetInstanceAttributes(const int instanceIndex, const bool bIs3D, const float maxDistance)
+	{
+		Audio3DAttributes attributes = {};
+		attributes.forward = { 0.0f, 0.0f, 1.0f };
+		attributes.up = { 0.0f, 1.0f, 0.0f };
+		if (!bIs3D) { return attributes; }
+
+		constexpr float GOLDEN_ANGLE = 2.39996323f;
+		const float angle = static_cast<float>(instanceIndex) * GOLDEN_ANGLE;
+		const float distance = 1.0f + std::fmod(static_cast<float>(instanceIndex) * 0.618034f, 1.0f) * std::max(maxDistance - 1.0f, 0.0f);
+		attributes.position = { std::cos(angle) * distance, 0.0f, std::sin(angle) * distance };
+		return attributes;
+	}
+
+	double GetMixerSeconds()
+	{
+		uint64_t samples = 0;
+		int sampleRate = 0;
+		return AudioEngine::GetMixerClock(samples, sampleRate) && sampleRate > 0 ? static_cast<double>(samples) / sampleRate : 0.0;
+	}
+
+	void WriteCsvHeader(std::ostream& stream)
+	{
+		stream << "event,kind,instances,active_instances,ticks,audio_seconds,"
+			"update_ms_mean,update_ms_p50,update_ms_p99,update_ms_max,studio_update_ms_mean,dsp_cpu_mean,"
+			"channels_playing_mean,channels_playing_max,real_channels_mean,real_channels_max,"
+			"to_virtual_per_s,to_real_per_s,real_channel_changes_per_s,"
+			"memory_current_bytes,memory_max_bytes,"
+			"command_queue_peak_bytes,command_queue_capacity,command_queue_stalls,"
+			"handle_peak_bytes,handle_capacity,handle_stalls" << std::endl;
+	}
+
+	void RunEvent(const std::string& studioPath, const ScalingOptions& options, std::ostream& csv)
+	{
+		bool bIs3D = false;
+		if (!AudioEngine::EventIs3D(studioPath, bIs3D))
+		{
+			std::cerr << std::format("Cannot find {}, skipped", studioPath) << std::endl;
+			return;
+		}
+
+		constexpr AudioCallbackType VIRTUALIZATION_CALLBACKS = FMOD_STUDIO_EVENT_CALLBACK_REAL_TO_VIRTUAL | FMOD_STUDIO_EVENT_CALLBACK_VIRTUAL_TO_REAL;
+		std::vector<AudioInstance*> instances;
+		instances.reserve(options.steps.back());
+
+		for (const int instanceCount : options.steps)
+		{
+			// Stalls are counted from the start of the step, the ramp is what fills the command queue
+			AudioEngineStats stats;
+			AudioEngine::GetStatsSnapshot(stats);
+			const FMOD_STUDIO_BUFFER_USAGE startBufferUsage = stats.bufferUsage;
+
+			// Ramp: start what this step adds over as many ticks as needed, then let voice selection settle
+			bool bPlayFailed = false;
+			while (!bPlayFailed && static_cast<int>(instances.size()) < instanceCount)
+			{
+				for (int i = 0; i < options.startsPerTick && static_cast<int>(instances.size()) < instanceCount; ++i)
+				{
+					const auto instanceIndex = static_cast<int>(instances.size());
+					AudioInstance* instance = AudioEngine::PlayAudioEvent(studioPath, GetInstanceAttributes(instanceIndex, bIs3D, options.maxDistance),
+						nullptr, CountVirtualization, VIRTUALIZATION_CALLBACKS, true, false);
+					if (!instance)
+					{
+						std::cerr << std::format("{}: PlayAudioEvent failed at {} instances", studioPath, instances.size()) << std::endl;
+						bPlayFailed = true;
+						break;
+					}
+					instances.push_back(instance);
+				}
+				AudioEngine::Update();
+			}
+			if (bPlayFailed) { break; }
+			for (int i = 0; i < options.settleTicks; ++i) { AudioEngine::Update(); }
+
+			AudioEngine::GetStatsSnapshot(stats);
+			const uint64_t startToVirtual = sRealToVirtualCount.load(std::memory_order_relaxed);
+			const uint64_t startToReal = sVirtualToRealCount.load(std::memory_order_relaxed);
+			const double startSeconds = GetMixerSeconds();
+
+			HdrHistogram updateNs;
+			double studioUpdateMsSum = 0;
+			double dspCPUSum = 0;
+			double channelsSum = 0;
+			double realChannelsSum = 0;
+			int channelsMax = 0;
+			int realChannelsMax = 0;
+			uint64_t realChannelChanges = 0;
+			int previousRealChannels = stats.realChannelsPlaying;
+
+			for (int tick = 0; tick < options.measureTicks; ++tick)
+			{
+				const int64_t updateStartNs = GetSteadyTimeNs();
+				AudioEngine::Update();
+				updateNs.Record(static_cast<uint64_t>(GetSteadyTimeNs() - updateStartNs));
+
+				AudioEngine::GetStatsSnapshot(stats);
+				studioUpdateMsSum += stats.studioUpdateMs;
+				dspCPUSum += stats.coreCPU.dsp;
+				channelsSum += stats.channelsPlaying;
+				realChannelsSum += stats.realChannelsPlaying;
+				channelsMax = std::max(channelsMax, stats.channelsPlaying);
+				realChannelsMax = std::max(realChannelsMax, stats.realChannelsPlaying);
+				realChannelChanges += static_cast<uint64_t>(std::abs(stats.realChannelsPlaying - previousRealChannels));
+				previousRealChannels = stats.realChannelsPlaying;
+			}
+
+			const double audioSeconds = GetMixerSeconds() - startSeconds;
+			const double perSecond = audioSeconds > 0 ? 1.0 / audioSeconds : 0.0;
+			const double ticks = options.measureTicks;
+			const FMOD_STUDIO_BUFFER_INFO& commandQueue = stats.bufferUsage.studiocommandqueue;
+			const FMOD_STUDIO_BUFFER_INFO& handles = stats.bufferUsage.studiohandle;
+
+			csv << std::format("{},{},{},{},{},{:.3f},{:.4f},{:.4f},{:.4f},{:.4f},{:.4f},{:.3f},{:.1f},{},{:.1f},{},{:.2f},{:.2f},{:.2f},{},{},{},{},{},{},{},{}",
+				studioPath, bIs3D ? "3d" : "2d", instances.size(), stats.activeInstances, options.measureTicks, audioSeconds,
+				updateNs.GetMean() * 1e-6, static_cast<double>(updateNs.GetPercentile(50)) * 1e-6,
+				static_cast<double>(updateNs.GetPercentile(99)) * 1e-6, static_cast<double>(updateNs.GetMax()) * 1e-6,
+				studioUpdateMsSum / ticks, dspCPUSum / ticks,
+				channelsSum / ticks, channelsMax, realChannelsSum / ticks, realChannelsMax,
+				static_cast<double>(sRealToVirtualCount.load(std::memory_order_relaxed) - startToVirtual) * perSecond,
+				static_cast<double>(sVirtualToRealCount.load(std::memory_order_relaxed) - startToReal) * perSecond,
+				static_cast<double>(realChannelChanges) * perSecond,
+				stats.memoryCurrentBytes, stats.memoryMaxBytes,
+				commandQueue.peakusage, commandQueue.capacity, commandQueue.stallcount - startBufferUsage.studiocommandqueue.stallcount,
+				handles.peakusage, handles.capacity, handles.stallcount - startBufferUsage.studiohandle.stallcount) << std::endl;
+		}
+
+		for (AudioInstance* instance : instances)
+		{
+			AudioEngine::InstanceStop(instance, false);
+			AudioEngine::InstanceRelease(instance);
+		}
+		for (int i = 0; i < options.settleTicks + 1; ++i) { AudioEngine::Update(); }
+	}
+}
+
+int main(const int argc, char* argv[])
+{
+	ApplyHeadlessConfigDefaults();
+
+	ScalingOptions options;
+	if (!ParseOptions(argc, argv, options))
+	{
+		PrintUsage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	// Every instance keeps its engine record, so virtualization callbacks reach the counters at the largest step
+	AudioConfig::SetOverride("Profiling", "EnableInstanceTracking", "true");
+	AudioConfig::SetOverride("Profiling", "TrackedInstanceCapacity", std::to_string(options.steps.back() + 1024));
+
+	if (!AudioEngine::Initialize())
+	{
+		std::cerr << "AudioEngine failed to initialize, run from the build directory (config/ and assets/ next to the executable)" << std::endl;
+		AudioEngine::Terminate();
+		return EXIT_FAILURE;
+	}
+
+	for (const auto& bank : options.banks)
+	{
+		if (!AudioEngine::LoadSoundBankFile(bank))
+		{
+			std::cerr << std::format("Cannot load bank {}", bank) << std::endl;
+			AudioEngine::Terminate();
+			return EXIT_FAILURE;
+		}
+	}
+
+	std::ofstream outputFile;
+	if (!options.outputPath.empty())
+	{
+		outputFile.open(options.outputPath);
+		if (!outputFile)
+		{
+			std::cerr << std::format("Cannot write {}", options.outputPath) << std::endl;
+			AudioEngine::Terminate();
+			return EXIT_FAILURE;
+		}
+	}
+	std::ostream& csv = options.outputPath.empty() ? std::cout : outputFile;
+
+	WriteCsvHeader(csv);
+	for (const auto& studioPath : options.events)
+	{
+		RunEvent(studioPath, options, csv);
+	}
+
+	AudioEngine::Terminate();
+	return EXIT_SUCCESS;
+}
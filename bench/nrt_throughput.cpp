@@ -0,0 +1,235 @@
+/*
+ * NRT Throughput Benchmark
+ * Runs the audio engine headless (no raylib, no window, no sound card) with [System] OutputType=NoSoundNRT and
+ * [Advanced] EnableSynchronousUpdate=true, so every AudioEngine::Update mixes one DSP buffer on the calling thread
+ * and the loop runs as fast as the machine allows. A configurable event workload is fired every tick.
+ * Prints events started per second, update cost per tick, DSP CPU and the faster-than-realtime factor as JSON.
+ *
+ * Usage: FmodCmakeThroughput [--bank <file>]... [--event <studio path>]... [--events-per-tick 1] [--max-instances 64]
+ *                            [--spread 10] [--audio-seconds 60] [--max-ticks 0] [--warmup-ticks 100]
+ *                            [--set <Section.Key=Value>]... [--output <file>]
+ */
+
+#include "bench_harness.h"
+
+#include "audio/audio_engine.h"
+
+#include <deque>
+
+namespace
+{
+	constexpr auto DEFAULT_BANK = "Music.bank";
+	constexpr auto DEFAULT_EVENT = "event:/MusicTest";
+
+	struct ThroughputOptions
+	{
+		std::vector<std::string> banks;
+		std::vector<std::string> events;
+		int eventsPerTick = 1;
+		size_t maxInstances = 64;
+		float spread = 10;
+		double audioSeconds = 60;
+		uint64_t maxTicks = 0;
+		uint64_t warmupTicks = 100;
+		std::string outputPath;
+	};
+
+	void PrintUsage(const char* program)
+	{
+		std::cout << std::format("Usage: {} [--bank <file>]... [--event <studio path>]... [--events-per-tick 1] [--max-instances 64]\n"
+			"    [--spread 10] [--audio-seconds 60] [--max-ticks 0] [--warmup-ticks 100] [--set <Section.Key=Value>]... [--output <file>]",
+			program) << std::endl;
+	}
+
+	bool ParseOptions(const int argc, char* argv[], ThroughputOptions& outOptions)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string argument = argv[i];
+			if (i + 1 >= argc) { return false; }
+
+			const std::string value = argv[++i];
+			if (argument == "--bank") { outOptions.banks.push_back(value); }
+			else if (argument == "--event") { outOptions.events.push_back(value); }
+			else if (argument == "--events-per-tick") { outOptions.eventsPerTick = std::max(std::atoi(value.c_str()), 0); }
+			else if (argument == "--max-instances") { outOptions.maxInstances = static_cast<size_t>(std::max(std::atoi(value.c_str()), 1)); }
+			else if (argument == "--spread") { outOptions.spread = std::strtof(value.c_str(), nullptr); }
+			else if (argument == "--audio-seconds") { outOptions.audioSeconds = std::max(std::strtod(value.c_str(), nullptr), 0.0); }
+			else if (argument == "--max-ticks") { outOptions.maxTicks = std::strtoull(value.c_str(), nullptr, 10); }
+			else if (argument == "--warmup-ticks") { outOptions.warmupTicks = std::strtoull(value.c_str(), nullptr, 10); }
+			else if (argument == "--set") { if (!ApplyConfigOverride(value)) { return false; } }
+			else if (argument == "--output") { outOptions.outputPath = value; }
+			else { return false; }
+		}
+
+		if (outOptions.events.empty())
+		{
+			outOptions.events.emplace_back(DEFAULT_EVENT);
+			if (outOptions.banks.empty()) { outOptions.banks.emplace_back(DEFAULT_BANK); }
+		}
+		return outOptions.audioSeconds > 0 || outOptions.maxTicks > 0;
+	}
+
+	// Spreads the instances on a circle around the listener so 3D events pan and attenuate differently
+	Audio3DAttributes GetWorkloadAttributes(const uint64_t eventIndex, const float spread)
+	{
+		constexpr float GOLDEN_ANGLE = 2.39996323f;
+		const float angle = static_cast<float>(eventIndex % 1024) * GOLDEN_ANGLE;
+
+		Audio3DAttributes attributes = {};
+		attributes.position = { std::cos(angle) * spread, 0.0f, std::sin(angle) * spread };
+		attributes.forward = { 0.0f, 0.0f, 1.0f };
+		attributes.up = { 0.0f, 1.0f, 0.0f };
+		return attributes;
+	}
+}
+
+int main(const int argc, char* argv[])
+{
+	ApplyHeadlessConfigDefaults();
+
+	ThroughputOptions options;
+	if (!ParseOptions(argc, argv, options))
+	{
+		PrintUsage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	if (!AudioEngine::Initialize())
+	{
+		std::cerr << "AudioEngine failed to initialize, run from the build directory (config/ and assets/ next to the executable)" << std::endl;
+		AudioEngine::Terminate();
+		return EXIT_FAILURE;
+	}
+
+	for (const auto& bank : options.banks)
+	{
+		if (!AudioEngine::LoadSoundBankFile(bank))
+		{
+			std::cerr << std::format("Cannot load bank {}", bank) << std::endl;
+			AudioEngine::Terminate();
+			return EXIT_FAILURE;
+		}
+	}
+
+	HdrHistogram updateNs;
+	HdrHistogram tickNs;
+	std::deque<AudioInstance*> liveInstances;
+	uint64_t eventIndex = 0;
+	uint64_t eventsStarted = 0;
+	uint64_t eventsFailed = 0;
+	double dspCPUSum = 0;
+	float dspCPUMax = 0;
+	double studioCPUSum = 0;
+	int channelsPlayingMax = 0;
+	int realChannelsPlayingMax = 0;
+	int memoryMaxBytes = 0;
+
+	uint64_t startSamples = 0;
+	uint64_t currentSamples = 0;
+	int sampleRate = 0;
+	int64_t startNs = GetSteadyTimeNs();
+	uint64_t measuredTicks = 0;
+
+	for (uint64_t tick = 0;; ++tick)
+	{
+		if (tick == options.warmupTicks)
+		{
+			AudioEngine::GetMixerClock(startSamples, sampleRate);
+			startNs = GetSteadyTimeNs();
+		}
+		const bool bMeasured = tick >= options.warmupTicks;
+
+		const int64_t tickStartNs = GetSteadyTimeNs();
+		for (int i = 0; i < options.eventsPerTick; ++i)
+		{
+			// Voice count stays bounded, the oldest instance makes room for the new one
+			if (liveInstances.size() >= options.maxInstances)
+			{
+				AudioEngine::InstanceStop(liveInstances.front(), false);
+				AudioEngine::InstanceRelease(liveInstances.front());
+				liveInstances.pop_front();
+			}
+
+			const std::string& studioPath = options.events[eventIndex % options.events.size()];
+			if (AudioInstance* instance = AudioEngine::PlayAudioEvent(studioPath, GetWorkloadAttributes(eventIndex, options.spread),
+				nullptr, nullptr, FMOD_STUDIO_EVENT_CALLBACK_ALL, true, false))
+			{
+				liveInstances.push_back(instance);
+				if (bMeasured) { ++eventsStarted; }
+			}
+			else if (bMeasured) { ++eventsFailed; }
+			++eventIndex;
+		}
+
+		const int64_t updateStartNs = GetSteadyTimeNs();
+		AudioEngine::Update();
+		const int64_t tickEndNs = GetSteadyTimeNs();
+
+		AudioEngine::GetMixerClock(currentSamples, sampleRate);
+		if (!bMeasured) { continue; }
+
+		++measuredTicks;
+		updateNs.Record(static_cast<uint64_t>(tickEndNs - updateStartNs));
+		tickNs.Record(static_cast<uint64_t>(tickEndNs - tickStartNs));
+
+		if (AudioEngineStats stats; AudioEngine::GetStatsSnapshot(stats))
+		{
+			dspCPUSum += stats.coreCPU.dsp;
+			dspCPUMax = std::max(dspCPUMax, stats.coreCPU.dsp);
+			studioCPUSum += stats.studioCPU.update;
+			channelsPlayingMax = std::max(channelsPlayingMax, stats.channelsPlaying);
+			realChannelsPlayingMax = std::max(realChannelsPlayingMax, stats.realChannelsPlaying);
+			memoryMaxBytes = std::max(memoryMaxBytes, stats.memoryMaxBytes);
+		}
+
+		const double audioSeconds = sampleRate > 0 ? static_cast<double>(currentSamples - startSamples) / sampleRate : 0.0;
+		if ((options.audioSeconds > 0 && audioSeconds >= options.audioSeconds)
+			|| (options.maxTicks > 0 && measuredTicks >= options.maxTicks))
+		{
+			break;
+		}
+	}
+
+	const double wallSeconds = static_cast<double>(GetSteadyTimeNs() - startNs) * 1e-9;
+	const double audioSeconds = sampleRate > 0 ? static_cast<double>(currentSamples - startSamples) / sampleRate : 0.0;
+	const double tickCount = static_cast<double>(std::max<uint64_t>(measuredTicks, 1));
+
+	std::string eventList;
+	for (const auto& studioPath : options.events)
+	{
+		eventList += std::format("{}\"{}\"", eventList.empty() ? "" : ",", studioPath);
+	}
+
+	const std::string report = std::format(
+		"{{\"benchmark\":\"nrt_throughput\",\"backend\":\"{}\",\"events\":[{}],\"eventsPerTick\":{},\"maxInstances\":{},\"sampleRate\":{},"
+		"\"ticks\":{},\"wallSeconds\":{:.4f},\"audioSeconds\":{:.4f},\"realtimeFactor\":{:.3f},"
+		"\"eventsStarted\":{},\"eventsFailed\":{},\"eventsStartedPerSecond\":{:.1f},"
+		"\"updateMs\":{},\"tickMs\":{},\"dspCPUPercent\":{{\"mean\":{:.3f},\"max\":{:.3f}}},\"studioUpdateCPUPercent\":{:.3f},"
+		"\"channelsPlayingMax\":{},\"realChannelsPlayingMax\":{},\"memoryMaxBytes\":{}}}",
+		BENCHMARK_FMOD_BACKEND, eventList, options.eventsPerTick, options.maxInstances, sampleRate,
+		measuredTicks, wallSeconds, audioSeconds, wallSeconds > 0 ? audioSeconds / wallSeconds : 0.0,
+		eventsStarted, eventsFailed, wallSeconds > 0 ? static_cast<double>(eventsStarted) / wallSeconds : 0.0,
+		FormatHistogramMs(updateNs), FormatHistogramMs(tickNs), dspCPUSum / tickCount, dspCPUMax, studioCPUSum / tickCount,
+		channelsPlayingMax, realChannelsPlayingMax, memoryMaxBytes);
+
+	for (AudioInstance* instance : liveInstances)
+	{
+		AudioEngine::InstanceStop(instance, false);
+		AudioEngine::InstanceRelease(instance);
+	}
+	AudioEngine::Terminate();
+
+	if (!options.outputPath.empty())
+	{
+		std::ofstream outputFile(options.outputPath);
+		if (!outputFile)
+		{
+			std::cerr << std::format("Cannot write {}", options.outputPath) << std::endl;
+			return EXIT_FAILURE;
+		}
+		outputFile << report << std::endl;
+	}
+	std::cout << report << std::endl;
+	return EXIT_SUCCESS;
+}
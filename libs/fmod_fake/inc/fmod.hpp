@@ -0,0 +1,135 @@
+/*
+ * Fake FMOD Core C++ API, see libs/fmod_fake/readme.md
+ * Objects are opaque handles like in the real API: never construct, copy or dereference them.
+ */
+
+#ifndef FMOD_FAKE_HPP
+#define FMOD_FAKE_HPP
+
+#include "fmod_common.h"
+
+namespace FMOD
+{
+	class System;
+	class Sound;
+	class ChannelControl;
+	class ChannelGroup;
+	class DSP;
+	class DSPConnection;
+
+	FMOD_RESULT F_API Memory_GetStats(int* currentalloced, int* maxalloced, bool blocking = true);
+	FMOD_RESULT F_API Debug_Initialize(FMOD_DEBUG_FLAGS flags, FMOD_DEBUG_MODE mode = FMOD_DEBUG_MODE_TTY,
+		FMOD_DEBUG_CALLBACK callback = nullptr, const char* filename = nullptr);
+
+	class System
+	{
+		private:
+			System();
+			System(const System&);
+
+		public:
+			FMOD_RESULT F_API release();
+
+			// Setup, before init
+			FMOD_RESULT F_API setOutput(FMOD_OUTPUTTYPE output);
+			FMOD_RESULT F_API getOutput(FMOD_OUTPUTTYPE* output);
+			FMOD_RESULT F_API getNumDrivers(int* numdrivers);
+			FMOD_RESULT F_API getDriverInfo(int id, char* name, int namelen, FMOD_GUID* guid, int* systemrate,
+				FMOD_SPEAKERMODE* speakermode, int* speakermodechannels);
+			FMOD_RESULT F_API setDriver(int driver);
+			FMOD_RESULT F_API setSoftwareChannels(int numsoftwarechannels);
+			FMOD_RESULT F_API setSoftwareFormat(int samplerate, FMOD_SPEAKERMODE speakermode, int numrawspeakers);
+			FMOD_RESULT F_API getSoftwareFormat(int* samplerate, FMOD_SPEAKERMODE* speakermode, int* numrawspeakers);
+			FMOD_RESULT F_API setDSPBufferSize(unsigned int bufferlength, int numbuffers);
+			FMOD_RESULT F_API getDSPBufferSize(unsigned int* bufferlength, int* numbuffers);
+			FMOD_RESULT F_API setFileSystem(FMOD_FILE_OPEN_CALLBACK useropen, FMOD_FILE_CLOSE_CALLBACK userclose,
+				FMOD_FILE_READ_CALLBACK userread, FMOD_FILE_SEEK_CALLBACK userseek, FMOD_FILE_ASYNCREAD_CALLBACK userasyncread,
+				FMOD_FILE_ASYNCCANCEL_CALLBACK userasynccancel, int blockalign);
+			FMOD_RESULT F_API attachFileSystem(FMOD_FILE_OPEN_CALLBACK useropen, FMOD_FILE_CLOSE_CALLBACK userclose,
+				FMOD_FILE_READ_CALLBACK userread, FMOD_FILE_SEEK_CALLBACK userseek);
+			FMOD_RESULT F_API setAdvancedSettings(FMOD_ADVANCEDSETTINGS* settings);
+			FMOD_RESULT F_API setCallback(FMOD_SYSTEM_CALLBACK callback, FMOD_SYSTEM_CALLBACK_TYPE callbackmask = FMOD_SYSTEM_CALLBACK_ALL);
+
+			// Plugins
+			FMOD_RESULT F_API setPluginPath(const char* path);
+			FMOD_RESULT F_API loadPlugin(const char* filename, unsigned int* handle, unsigned int priority = 0);
+			FMOD_RESULT F_API unloadPlugin(unsigned int handle);
+
+			// General
+			FMOD_RESULT F_API update();
+			FMOD_RESULT F_API getCPUUsage(FMOD_CPU_USAGE* usage);
+			FMOD_RESULT F_API createSound(const char* name_or_data, FMOD_MODE mode, FMOD_CREATESOUNDEXINFO* exinfo, Sound** sound);
+			FMOD_RESULT F_API getChannelsPlaying(int* channels, int* realchannels = nullptr);
+			FMOD_RESULT F_API getMasterChannelGroup(ChannelGroup** channelgroup);
+
+			// Userdata
+			FMOD_RESULT F_API setUserData(void* userdata);
+			FMOD_RESULT F_API getUserData(void** userdata);
+	};
+
+	class Sound
+	{
+		private:
+			Sound();
+			Sound(const Sound&);
+
+		public:
+			FMOD_RESULT F_API release();
+			FMOD_RESULT F_API getName(char* name, int namelen);
+			FMOD_RESULT F_API getLength(unsigned int* length, FMOD_TIMEUNIT lengthtype);
+	};
+
+	class ChannelControl
+	{
+		private:
+			ChannelControl();
+			ChannelControl(const ChannelControl&);
+
+		public:
+			FMOD_RESULT F_API getSystemObject(System** system);
+			FMOD_RESULT F_API getVolume(float* volume);
+			FMOD_RESULT F_API getDSPClock(unsigned long long* dspclock, unsigned long long* parentclock);
+			FMOD_RESULT F_API getDSP(int index, DSP** dsp);
+			FMOD_RESULT F_API getNumDSPs(int* numdsps);
+	};
+
+	class ChannelGroup : public ChannelControl
+	{
+		private:
+			ChannelGroup();
+			ChannelGroup(const ChannelGroup&);
+
+		public:
+			FMOD_RESULT F_API getNumGroups(int* numgroups);
+			FMOD_RESULT F_API getGroup(int index, ChannelGroup** group);
+			FMOD_RESULT F_API getName(char* name, int namelen);
+			FMOD_RESULT F_API getNumChannels(int* numchannels);
+	};
+
+	class DSP
+	{
+		private:
+			DSP();
+			DSP(const DSP&);
+
+		public:
+			FMOD_RESULT F_API getNumInputs(int* numinputs);
+			FMOD_RESULT F_API getInput(int index, DSP** input, DSPConnection** inputconnection);
+			FMOD_RESULT F_API getActive(bool* active);
+			FMOD_RESULT F_API getBypass(bool* bypass);
+			FMOD_RESULT F_API getInfo(char* name, unsigned int* version, int* channels, int* configwidth, int* configheight);
+			FMOD_RESULT F_API getType(FMOD_DSP_TYPE* type);
+			FMOD_RESULT F_API getCPUUsage(unsigned int* exclusive, unsigned int* inclusive);
+			FMOD_RESULT F_API setMeteringEnabled(bool inputEnabled, bool outputEnabled);
+			FMOD_RESULT F_API getMeteringEnabled(bool* inputEnabled, bool* outputEnabled);
+			FMOD_RESULT F_API getMeteringInfo(FMOD_DSP_METERING_INFO* inputInfo, FMOD_DSP_METERING_INFO* outputInfo);
+	};
+
+	class DSPConnection
+	{
+		private:
+			DSPConnection();
+			DSPConnection(const DSPConnection&);
+	};
+}
+#endif
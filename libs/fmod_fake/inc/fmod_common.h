@@ -0,0 +1,328 @@
+/*
+ * Fake FMOD Core common types, see libs/fmod_fake/readme.md
+ * Declares the subset of the FMOD 2.03 Core API used by this project with the same names and signatures.
+ * Values may differ from the real headers, code must only use the names.
+ */
+
+#ifndef FMOD_FAKE_COMMON_H
+#define FMOD_FAKE_COMMON_H
+
+#define F_CALL
+#define F_API
+#define F_CALLBACK F_CALL
+
+#define FMOD_VERSION 0x00020312
+
+typedef int FMOD_BOOL;
+typedef unsigned int FMOD_INITFLAGS;
+typedef unsigned int FMOD_DEBUG_FLAGS;
+typedef unsigned int FMOD_MEMORY_TYPE;
+typedef unsigned int FMOD_SYSTEM_CALLBACK_TYPE;
+typedef unsigned int FMOD_MODE;
+typedef unsigned int FMOD_TIMEUNIT;
+typedef unsigned int FMOD_CHANNELMASK;
+typedef unsigned long long FMOD_PORT_INDEX;
+
+typedef struct FMOD_SYSTEM FMOD_SYSTEM;
+typedef struct FMOD_SOUND FMOD_SOUND;
+typedef struct FMOD_CHANNELCONTROL FMOD_CHANNELCONTROL;
+typedef struct FMOD_CHANNELGROUP FMOD_CHANNELGROUP;
+typedef struct FMOD_DSP FMOD_DSP;
+typedef struct FMOD_DSPCONNECTION FMOD_DSPCONNECTION;
+
+typedef enum FMOD_RESULT
+{
+	FMOD_OK,
+	FMOD_ERR_BADCOMMAND,
+	FMOD_ERR_CHANNEL_ALLOC,
+	FMOD_ERR_CHANNEL_STOLEN,
+	FMOD_ERR_DMA,
+	FMOD_ERR_DSP_CONNECTION,
+	FMOD_ERR_DSP_DONTPROCESS,
+	FMOD_ERR_DSP_FORMAT,
+	FMOD_ERR_DSP_INUSE,
+	FMOD_ERR_DSP_NOTFOUND,
+	FMOD_ERR_DSP_RESERVED,
+	FMOD_ERR_DSP_SILENCE,
+	FMOD_ERR_DSP_TYPE,
+	FMOD_ERR_FILE_BAD,
+	FMOD_ERR_FILE_COULDNOTSEEK,
+	FMOD_ERR_FILE_DISKEJECTED,
+	FMOD_ERR_FILE_EOF,
+	FMOD_ERR_FILE_ENDOFDATA,
+	FMOD_ERR_FILE_NOTFOUND,
+	FMOD_ERR_FORMAT,
+	FMOD_ERR_HEADER_MISMATCH,
+	FMOD_ERR_HTTP,
+	FMOD_ERR_HTTP_ACCESS,
+	FMOD_ERR_HTTP_PROXY_AUTH,
+	FMOD_ERR_HTTP_SERVER_ERROR,
+	FMOD_ERR_HTTP_TIMEOUT,
+	FMOD_ERR_INITIALIZATION,
+	FMOD_ERR_INITIALIZED,
+	FMOD_ERR_INTERNAL,
+	FMOD_ERR_INVALID_FLOAT,
+	FMOD_ERR_INVALID_HANDLE,
+	FMOD_ERR_INVALID_PARAM,
+	FMOD_ERR_INVALID_POSITION,
+	FMOD_ERR_INVALID_SPEAKER,
+	FMOD_ERR_INVALID_SYNCPOINT,
+	FMOD_ERR_INVALID_THREAD,
+	FMOD_ERR_INVALID_VECTOR,
+	FMOD_ERR_MAXAUDIBLE,
+	FMOD_ERR_MEMORY,
+	FMOD_ERR_MEMORY_CANTPOINT,
+	FMOD_ERR_NEEDS3D,
+	FMOD_ERR_NEEDSHARDWARE,
+	FMOD_ERR_NET_CONNECT,
+	FMOD_ERR_NET_SOCKET_ERROR,
+	FMOD_ERR_NET_URL,
+	FMOD_ERR_NET_WOULD_BLOCK,
+	FMOD_ERR_NOTREADY,
+	FMOD_ERR_OUTPUT_ALLOCATED,
+	FMOD_ERR_OUTPUT_CREATEBUFFER,
+	FMOD_ERR_OUTPUT_DRIVERCALL,
+	FMOD_ERR_OUTPUT_FORMAT,
+	FMOD_ERR_OUTPUT_INIT,
+	FMOD_ERR_OUTPUT_NODRIVERS,
+	FMOD_ERR_PLUGIN,
+	FMOD_ERR_PLUGIN_MISSING,
+	FMOD_ERR_PLUGIN_RESOURCE,
+	FMOD_ERR_PLUGIN_VERSION,
+	FMOD_ERR_RECORD,
+	FMOD_ERR_REVERB_CHANNELGROUP,
+	FMOD_ERR_REVERB_INSTANCE,
+	FMOD_ERR_SUBSOUNDS,
+	FMOD_ERR_SUBSOUND_ALLOCATED,
+	FMOD_ERR_SUBSOUND_CANTMOVE,
+	FMOD_ERR_TAGNOTFOUND,
+	FMOD_ERR_TOOMANYCHANNELS,
+	FMOD_ERR_TRUNCATED,
+	FMOD_ERR_UNIMPLEMENTED,
+	FMOD_ERR_UNINITIALIZED,
+	FMOD_ERR_UNSUPPORTED,
+	FMOD_ERR_VERSION,
+	FMOD_ERR_EVENT_ALREADY_LOADED,
+	FMOD_ERR_EVENT_LIVEUPDATE_BUSY,
+	FMOD_ERR_EVENT_LIVEUPDATE_MISMATCH,
+	FMOD_ERR_EVENT_LIVEUPDATE_TIMEOUT,
+	FMOD_ERR_EVENT_NOTFOUND,
+	FMOD_ERR_STUDIO_UNINITIALIZED,
+	FMOD_ERR_STUDIO_NOT_LOADED,
+	FMOD_ERR_INVALID_STRING,
+	FMOD_ERR_ALREADY_LOCKED,
+	FMOD_ERR_NOT_LOCKED,
+	FMOD_ERR_RECORD_DISCONNECTED,
+	FMOD_ERR_TOOMANYSAMPLES
+} FMOD_RESULT;
+
+typedef enum FMOD_OUTPUTTYPE
+{
+	FMOD_OUTPUTTYPE_AUTODETECT,
+	FMOD_OUTPUTTYPE_UNKNOWN,
+	FMOD_OUTPUTTYPE_NOSOUND,
+	FMOD_OUTPUTTYPE_WAVWRITER,
+	FMOD_OUTPUTTYPE_NOSOUND_NRT,
+	FMOD_OUTPUTTYPE_WAVWRITER_NRT,
+	FMOD_OUTPUTTYPE_WASAPI,
+	FMOD_OUTPUTTYPE_ASIO,
+	FMOD_OUTPUTTYPE_PULSEAUDIO,
+	FMOD_OUTPUTTYPE_ALSA,
+	FMOD_OUTPUTTYPE_COREAUDIO,
+	FMOD_OUTPUTTYPE_AUDIOTRACK,
+	FMOD_OUTPUTTYPE_OPENSL,
+	FMOD_OUTPUTTYPE_AUDIOOUT,
+	FMOD_OUTPUTTYPE_AUDIO3D,
+	FMOD_OUTPUTTYPE_WEBAUDIO,
+	FMOD_OUTPUTTYPE_NNAUDIO,
+	FMOD_OUTPUTTYPE_WINSONIC,
+	FMOD_OUTPUTTYPE_AAUDIO,
+	FMOD_OUTPUTTYPE_AUDIOWORKLET,
+	FMOD_OUTPUTTYPE_PHASE,
+	FMOD_OUTPUTTYPE_OHAUDIO,
+	FMOD_OUTPUTTYPE_MAX
+} FMOD_OUTPUTTYPE;
+
+typedef enum FMOD_DEBUG_MODE
+{
+	FMOD_DEBUG_MODE_TTY,
+	FMOD_DEBUG_MODE_FILE,
+	FMOD_DEBUG_MODE_CALLBACK
+} FMOD_DEBUG_MODE;
+
+typedef enum FMOD_SPEAKERMODE
+{
+	FMOD_SPEAKERMODE_DEFAULT,
+	FMOD_SPEAKERMODE_RAW,
+	FMOD_SPEAKERMODE_MONO,
+	FMOD_SPEAKERMODE_STEREO,
+	FMOD_SPEAKERMODE_QUAD,
+	FMOD_SPEAKERMODE_SURROUND,
+	FMOD_SPEAKERMODE_5POINT1,
+	FMOD_SPEAKERMODE_7POINT1,
+	FMOD_SPEAKERMODE_7POINT1POINT4,
+	FMOD_SPEAKERMODE_MAX
+} FMOD_SPEAKERMODE;
+
+typedef enum FMOD_DSP_TYPE
+{
+	FMOD_DSP_TYPE_UNKNOWN,
+	FMOD_DSP_TYPE_MIXER,
+	FMOD_DSP_TYPE_OSCILLATOR,
+	FMOD_DSP_TYPE_LOWPASS,
+	FMOD_DSP_TYPE_ITLOWPASS,
+	FMOD_DSP_TYPE_HIGHPASS,
+	FMOD_DSP_TYPE_ECHO,
+	FMOD_DSP_TYPE_FADER,
+	FMOD_DSP_TYPE_MAX
+} FMOD_DSP_TYPE;
+
+typedef enum FMOD_ERRORCALLBACK_INSTANCETYPE
+{
+	FMOD_ERRORCALLBACK_INSTANCETYPE_NONE,
+	FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM,
+	FMOD_ERRORCALLBACK_INSTANCETYPE_CHANNEL,
+	FMOD_ERRORCALLBACK_INSTANCETYPE_CHANNELGROUP,
+	FMOD_ERRORCALLBACK_INSTANCETYPE_CHANNELCONTROL,
+	FMOD_ERRORCALLBACK_INSTANCETYPE_SOUND,
+	FMOD_ERRORCALLBACK_INSTANCETYPE_SOUNDGROUP,
+	FMOD_ERRORCALLBACK_INSTANCETYPE_DSP,
+	FMOD_ERRORCALLBACK_INSTANCETYPE_DSPCONNECTION,
+	FMOD_ERRORCALLBACK_INSTANCETYPE_GEOMETRY,
+	FMOD_ERRORCALLBACK_INSTANCETYPE_REVERB3D,
+	FMOD_ERRORCALLBACK_INSTANCETYPE_STUDIO_SYSTEM,
+	FMOD_ERRORCALLBACK_INSTANCETYPE_STUDIO_EVENTDESCRIPTION,
+	FMOD_ERRORCALLBACK_INSTANCETYPE_STUDIO_EVENTINSTANCE,
+	FMOD_ERRORCALLBACK_INSTANCETYPE_STUDIO_PARAMETERINSTANCE,
+	FMOD_ERRORCALLBACK_INSTANCETYPE_STUDIO_BUS,
+	FMOD_ERRORCALLBACK_INSTANCETYPE_STUDIO_VCA,
+	FMOD_ERRORCALLBACK_INSTANCETYPE_STUDIO_BANK,
+	FMOD_ERRORCALLBACK_INSTANCETYPE_STUDIO_COMMANDREPLAY
+} FMOD_ERRORCALLBACK_INSTANCETYPE;
+
+#define FMOD_DEBUG_LEVEL_NONE                       0x00000000
+#define FMOD_DEBUG_LEVEL_ERROR                      0x00000001
+#define FMOD_DEBUG_LEVEL_WARNING                    0x00000002
+#define FMOD_DEBUG_LEVEL_LOG                        0x00000004
+
+#define FMOD_INIT_NORMAL                            0x00000000
+#define FMOD_INIT_STREAM_FROM_UPDATE                0x00000001
+#define FMOD_INIT_MIX_FROM_UPDATE                   0x00000002
+#define FMOD_INIT_PROFILE_ENABLE                    0x00010000
+#define FMOD_INIT_PROFILE_METER_ALL                 0x00200000
+#define FMOD_INIT_MEMORY_TRACKING                   0x00400000
+
+#define FMOD_SYSTEM_CALLBACK_ERROR                  0x00000080
+#define FMOD_SYSTEM_CALLBACK_ALL                    0xFFFFFFFF
+
+#define FMOD_DEFAULT                                0x00000000
+#define FMOD_LOOP_OFF                               0x00000001
+#define FMOD_CREATESTREAM                           0x00000080
+#define FMOD_NONBLOCKING                            0x00010000
+
+#define FMOD_TIMEUNIT_MS                            0x00000001
+#define FMOD_TIMEUNIT_PCM                           0x00000002
+#define FMOD_TIMEUNIT_PCMBYTES                      0x00000004
+
+#define FMOD_CHANNELCONTROL_DSP_HEAD                -1
+#define FMOD_CHANNELCONTROL_DSP_FADER               -2
+#define FMOD_CHANNELCONTROL_DSP_TAIL                -3
+
+#define FMOD_MAX_CHANNEL_WIDTH                      32
+
+typedef struct FMOD_VECTOR
+{
+	float x;
+	float y;
+	float z;
+} FMOD_VECTOR;
+
+typedef struct FMOD_3D_ATTRIBUTES
+{
+	FMOD_VECTOR position;
+	FMOD_VECTOR velocity;
+	FMOD_VECTOR forward;
+	FMOD_VECTOR up;
+} FMOD_3D_ATTRIBUTES;
+
+typedef struct FMOD_GUID
+{
+	unsigned int Data1;
+	unsigned short Data2;
+	unsigned short Data3;
+	unsigned char Data4[8];
+} FMOD_GUID;
+
+typedef struct FMOD_CREATESOUNDEXINFO
+{
+	int cbsize;
+	unsigned int length;
+	unsigned int fileoffset;
+	int numchannels;
+	int defaultfrequency;
+} FMOD_CREATESOUNDEXINFO;
+
+typedef struct FMOD_ADVANCEDSETTINGS
+{
+	int cbSize;
+	int maxMPEGCodecs;
+	int maxADPCMCodecs;
+	int maxXMACodecs;
+	int maxVorbisCodecs;
+	int maxAT9Codecs;
+	int maxFADPCMCodecs;
+	int maxOpusCodecs;
+	int ASIONumChannels;
+	char** ASIOChannelList;
+	FMOD_SPEAKERMODE* ASIOSpeakerList;
+	float vol0virtualvol;
+	unsigned int defaultDecodeBufferSize;
+	unsigned short profilePort;
+	unsigned int geometryMaxFadeTime;
+	float distanceFilterCenterFreq;
+	int reverb3Dinstance;
+	int DSPBufferPoolSize;
+	int resamplerMethod;
+	unsigned int randomSeed;
+	int maxConvolutionThreads;
+	int maxSpatialObjects;
+} FMOD_ADVANCEDSETTINGS;
+
+typedef struct FMOD_CPU_USAGE
+{
+	float dsp;
+	float stream;
+	float geometry;
+	float update;
+	float convolution1;
+	float convolution2;
+} FMOD_CPU_USAGE;
+
+typedef struct FMOD_DSP_METERING_INFO
+{
+	int numsamples;
+	float peaklevel[32];
+	float rmslevel[32];
+	short numchannels;
+} FMOD_DSP_METERING_INFO;
+
+typedef struct FMOD_ERRORCALLBACK_INFO
+{
+	FMOD_RESULT result;
+	FMOD_ERRORCALLBACK_INSTANCETYPE instancetype;
+	void* instance;
+	const char* functionname;
+	const char* functionparams;
+} FMOD_ERRORCALLBACK_INFO;
+
+typedef struct FMOD_ASYNCREADINFO FMOD_ASYNCREADINFO;
+
+typedef FMOD_RESULT (F_CALL *FMOD_DEBUG_CALLBACK)(FMOD_DEBUG_FLAGS flags, const char* file, int line, const char* func, const char* message);
+typedef FMOD_RESULT (F_CALL *FMOD_SYSTEM_CALLBACK)(FMOD_SYSTEM* system, FMOD_SYSTEM_CALLBACK_TYPE type, void* commanddata1, void* commanddata2, void* userdata);
+typedef FMOD_RESULT (F_CALL *FMOD_FILE_OPEN_CALLBACK)(const char* name, unsigned int* filesize, void** handle, void* userdata);
+typedef FMOD_RESULT (F_CALL *FMOD_FILE_CLOSE_CALLBACK)(void* handle, void* userdata);
+typedef FMOD_RESULT (F_CALL *FMOD_FILE_READ_CALLBACK)(void* handle, void* buffer, unsigned int sizebytes, unsigned int* bytesread, void* userdata);
+typedef FMOD_RESULT (F_CALL *FMOD_FILE_SEEK_CALLBACK)(void* handle, unsigned int pos, void* userdata);
+typedef FMOD_RESULT (F_CALL *FMOD_FILE_ASYNCREAD_CALLBACK)(FMOD_ASYNCREADINFO* info, void* userdata);
+typedef FMOD_RESULT (F_CALL *FMOD_FILE_ASYNCCANCEL_CALLBACK)(FMOD_ASYNCREADINFO* info, void* userdata);
+#endif
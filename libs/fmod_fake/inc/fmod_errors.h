@@ -0,0 +1,35 @@
+/*
+ * Fake FMOD error strings, see libs/fmod_fake/readme.md
+ */
+
+#ifndef FMOD_FAKE_ERRORS_H
+#define FMOD_FAKE_ERRORS_H
+
+#include "fmod_common.h"
+
+static const char* FMOD_ErrorString(const FMOD_RESULT errcode)
+{
+	switch (errcode)
+	{
+		case FMOD_OK: return "No errors.";
+		case FMOD_ERR_BADCOMMAND: return "Tried to call a function on a data type that does not allow this type of functionality.";
+		case FMOD_ERR_FILE_BAD: return "Error loading file.";
+		case FMOD_ERR_FILE_EOF: return "End of file unexpectedly reached while trying to read essential data.";
+		case FMOD_ERR_FILE_NOTFOUND: return "File not found.";
+		case FMOD_ERR_INITIALIZED: return "Cannot call this command after System::init.";
+		case FMOD_ERR_INVALID_HANDLE: return "An invalid object handle was used.";
+		case FMOD_ERR_INVALID_PARAM: return "An invalid parameter was passed to this function.";
+		case FMOD_ERR_NOTREADY: return "Operation could not be performed because specified sound/DSP connection is not ready.";
+		case FMOD_ERR_TRUNCATED: return "The retrieved string is too long to fit in the supplied buffer and has been truncated.";
+		case FMOD_ERR_UNINITIALIZED: return "This command failed because System::init or System::setDriver was not called.";
+		case FMOD_ERR_UNSUPPORTED: return "A command issued was not supported by this object.";
+		case FMOD_ERR_EVENT_ALREADY_LOADED: return "The specified bank has already been loaded.";
+		case FMOD_ERR_EVENT_NOTFOUND: return "The requested event, parameter, bus or vca could not be found.";
+		case FMOD_ERR_STUDIO_UNINITIALIZED: return "The Studio::System object is not yet initialized.";
+		case FMOD_ERR_STUDIO_NOT_LOADED: return "The specified resource is not loaded, so it can't be unloaded.";
+		case FMOD_ERR_INVALID_STRING: return "An invalid string was passed to this function.";
+		case FMOD_ERR_NOT_LOCKED: return "The specified resource is not locked, so it can't be unlocked.";
+		default: return "Unknown error (fake FMOD backend).";
+	}
+}
+#endif
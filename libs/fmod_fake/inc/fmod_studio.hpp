@@ -0,0 +1,244 @@
+/*
+ * Fake FMOD Studio C++ API, see libs/fmod_fake/readme.md
+ * Objects are opaque handles like in the real API: never construct, copy or dereference them.
+ */
+
+#ifndef FMOD_FAKE_STUDIO_HPP
+#define FMOD_FAKE_STUDIO_HPP
+
+#include "fmod_studio_common.h"
+#include "fmod.hpp"
+
+namespace FMOD
+{
+	namespace Studio
+	{
+		class System;
+		class EventDescription;
+		class EventInstance;
+		class Bus;
+		class VCA;
+		class Bank;
+		class CommandReplay;
+
+		class System
+		{
+			private:
+				System();
+				System(const System&);
+
+			public:
+				static FMOD_RESULT F_API create(System** system, unsigned int headerversion = FMOD_VERSION);
+				bool F_API isValid() const;
+
+				// Initialization
+				FMOD_RESULT F_API setAdvancedSettings(FMOD_STUDIO_ADVANCEDSETTINGS* settings);
+				FMOD_RESULT F_API getAdvancedSettings(FMOD_STUDIO_ADVANCEDSETTINGS* settings);
+				FMOD_RESULT F_API initialize(int maxchannels, FMOD_STUDIO_INITFLAGS studioflags, FMOD_INITFLAGS flags, void* extradriverdata);
+				FMOD_RESULT F_API release();
+
+				// Update
+				FMOD_RESULT F_API update();
+				FMOD_RESULT F_API getCoreSystem(FMOD::System** coresystem) const;
+				FMOD_RESULT F_API getEvent(const char* path, EventDescription** event) const;
+				FMOD_RESULT F_API getBus(const char* path, Bus** bus) const;
+				FMOD_RESULT F_API getVCA(const char* path, VCA** vca) const;
+				FMOD_RESULT F_API getBank(const char* path, Bank** bank) const;
+				FMOD_RESULT F_API getSoundInfo(const char* key, FMOD_STUDIO_SOUND_INFO* info) const;
+
+				// Global parameters
+				FMOD_RESULT F_API getParameterDescriptionByName(const char* name, FMOD_STUDIO_PARAMETER_DESCRIPTION* parameter) const;
+				FMOD_RESULT F_API setParameterByID(FMOD_STUDIO_PARAMETER_ID id, float value, bool ignoreseekspeed = false);
+				FMOD_RESULT F_API setParameterByName(const char* name, float value, bool ignoreseekspeed = false);
+				FMOD_RESULT F_API setParameterByNameWithLabel(const char* name, const char* label, bool ignoreseekspeed = false);
+
+				// Async
+				FMOD_RESULT F_API flushCommands();
+				FMOD_RESULT F_API flushSampleLoading();
+
+				// Command capture and replay
+				FMOD_RESULT F_API startCommandCapture(const char* filename, FMOD_STUDIO_COMMANDCAPTURE_FLAGS flags);
+				FMOD_RESULT F_API stopCommandCapture();
+				FMOD_RESULT F_API loadCommandReplay(const char* filename, FMOD_STUDIO_COMMANDREPLAY_FLAGS flags, CommandReplay** replay);
+
+				// Banks
+				FMOD_RESULT F_API loadBankFile(const char* filename, FMOD_STUDIO_LOAD_BANK_FLAGS flags, Bank** bank);
+				FMOD_RESULT F_API getBankCount(int* count) const;
+				FMOD_RESULT F_API getBankList(Bank** array, int capacity, int* count) const;
+
+				// Profiling
+				FMOD_RESULT F_API getCPUUsage(FMOD_STUDIO_CPU_USAGE* usage, FMOD_CPU_USAGE* usage_core) const;
+				FMOD_RESULT F_API getBufferUsage(FMOD_STUDIO_BUFFER_USAGE* usage) const;
+				FMOD_RESULT F_API resetBufferUsage();
+				FMOD_RESULT F_API getMemoryUsage(FMOD_STUDIO_MEMORY_USAGE* memoryusage) const;
+
+				// Callbacks
+				FMOD_RESULT F_API setCallback(FMOD_STUDIO_SYSTEM_CALLBACK callback,
+					FMOD_STUDIO_SYSTEM_CALLBACK_TYPE callbackmask = FMOD_STUDIO_SYSTEM_CALLBACK_ALL);
+				FMOD_RESULT F_API setUserData(void* userdata);
+				FMOD_RESULT F_API getUserData(void** userdata) const;
+		};
+
+		class EventDescription
+		{
+			private:
+				EventDescription();
+				EventDescription(const EventDescription&);
+
+			public:
+				bool F_API isValid() const;
+				FMOD_RESULT F_API getPath(char* path, int size, int* retrieved) const;
+				FMOD_RESULT F_API getParameterDescriptionByName(const char* name, FMOD_STUDIO_PARAMETER_DESCRIPTION* parameter) const;
+				FMOD_RESULT F_API getLength(int* length) const;
+				FMOD_RESULT F_API isOneshot(bool* oneshot) const;
+				FMOD_RESULT F_API is3D(bool* is3D) const;
+
+				// Playback
+				FMOD_RESULT F_API createInstance(EventInstance** instance) const;
+				FMOD_RESULT F_API getInstanceCount(int* count) const;
+				FMOD_RESULT F_API releaseAllInstances();
+
+				// Sample data
+				FMOD_RESULT F_API loadSampleData();
+				FMOD_RESULT F_API unloadSampleData();
+				FMOD_RESULT F_API getSampleLoadingState(FMOD_STUDIO_LOADING_STATE* state) const;
+
+				FMOD_RESULT F_API setUserData(void* userdata);
+				FMOD_RESULT F_API getUserData(void** userdata) const;
+		};
+
+		class EventInstance
+		{
+			private:
+				EventInstance();
+				EventInstance(const EventInstance&);
+
+			public:
+				bool F_API isValid() const;
+				FMOD_RESULT F_API getDescription(EventDescription** description) const;
+				FMOD_RESULT F_API getSystem(System** system) const;
+
+				// Playback control
+				FMOD_RESULT F_API start();
+				FMOD_RESULT F_API stop(FMOD_STUDIO_STOP_MODE mode);
+				FMOD_RESULT F_API getPlaybackState(FMOD_STUDIO_PLAYBACK_STATE* state) const;
+				FMOD_RESULT F_API setPaused(bool paused);
+				FMOD_RESULT F_API getPaused(bool* paused) const;
+				FMOD_RESULT F_API isVirtual(bool* virtualstate) const;
+				FMOD_RESULT F_API release();
+
+				// Spatialization
+				FMOD_RESULT F_API set3DAttributes(const FMOD_3D_ATTRIBUTES* attributes);
+
+				// Parameters
+				FMOD_RESULT F_API setParameterByID(FMOD_STUDIO_PARAMETER_ID id, float value, bool ignoreseekspeed = false);
+				FMOD_RESULT F_API setParameterByName(const char* name, float value, bool ignoreseekspeed = false);
+				FMOD_RESULT F_API setParameterByNameWithLabel(const char* name, const char* label, bool ignoreseekspeed = false);
+
+				// Core
+				FMOD_RESULT F_API getChannelGroup(ChannelGroup** group) const;
+
+				// Callbacks
+				FMOD_RESULT F_API setCallback(FMOD_STUDIO_EVENT_CALLBACK callback,
+					FMOD_STUDIO_EVENT_CALLBACK_TYPE callbackmask = FMOD_STUDIO_EVENT_CALLBACK_ALL);
+				FMOD_RESULT F_API setUserData(void* userdata);
+				FMOD_RESULT F_API getUserData(void** userdata) const;
+		};
+
+		class Bus
+		{
+			private:
+				Bus();
+				Bus(const Bus&);
+
+			public:
+				bool F_API isValid() const;
+				FMOD_RESULT F_API getPath(char* path, int size, int* retrieved) const;
+
+				// Playback control
+				FMOD_RESULT F_API getVolume(float* volume, float* finalvolume = nullptr) const;
+				FMOD_RESULT F_API setVolume(float volume);
+				FMOD_RESULT F_API getPaused(bool* paused) const;
+				FMOD_RESULT F_API setPaused(bool paused);
+				FMOD_RESULT F_API getMute(bool* mute) const;
+				FMOD_RESULT F_API setMute(bool mute);
+				FMOD_RESULT F_API stopAllEvents(FMOD_STUDIO_STOP_MODE mode);
+
+				// Core
+				FMOD_RESULT F_API lockChannelGroup();
+				FMOD_RESULT F_API unlockChannelGroup();
+				FMOD_RESULT F_API getChannelGroup(FMOD::ChannelGroup** group) const;
+
+				// Profiling
+				FMOD_RESULT F_API getCPUUsage(unsigned int* exclusive, unsigned int* inclusive) const;
+		};
+
+		class VCA
+		{
+			private:
+				VCA();
+				VCA(const VCA&);
+
+			public:
+				bool F_API isValid() const;
+				FMOD_RESULT F_API getPath(char* path, int size, int* retrieved) const;
+				FMOD_RESULT F_API getVolume(float* volume, float* finalvolume = nullptr) const;
+				FMOD_RESULT F_API setVolume(float volume);
+		};
+
+		class Bank
+		{
+			private:
+				Bank();
+				Bank(const Bank&);
+
+			public:
+				bool F_API isValid() const;
+				FMOD_RESULT F_API getPath(char* path, int size, int* retrieved) const;
+
+				// Loading control
+				FMOD_RESULT F_API unload();
+				FMOD_RESULT F_API loadSampleData();
+				FMOD_RESULT F_API unloadSampleData();
+				FMOD_RESULT F_API getLoadingState(FMOD_STUDIO_LOADING_STATE* state) const;
+				FMOD_RESULT F_API getSampleLoadingState(FMOD_STUDIO_LOADING_STATE* state) const;
+
+				// Enumeration
+				FMOD_RESULT F_API getEventCount(int* count) const;
+				FMOD_RESULT F_API getEventList(EventDescription** array, int capacity, int* count) const;
+				FMOD_RESULT F_API getBusCount(int* count) const;
+				FMOD_RESULT F_API getBusList(Bus** array, int capacity, int* count) const;
+				FMOD_RESULT F_API getVCACount(int* count) const;
+				FMOD_RESULT F_API getVCAList(VCA** array, int capacity, int* count) const;
+
+				FMOD_RESULT F_API setUserData(void* userdata);
+				FMOD_RESULT F_API getUserData(void** userdata) const;
+		};
+
+		class CommandReplay
+		{
+			private:
+				CommandReplay();
+				CommandReplay(const CommandReplay&);
+
+			public:
+				bool F_API isValid() const;
+				FMOD_RESULT F_API getSystem(System** system) const;
+				FMOD_RESULT F_API getLength(float* length) const;
+				FMOD_RESULT F_API getCommandCount(int* count) const;
+				FMOD_RESULT F_API getCurrentCommand(int* commandindex, float* currenttime) const;
+				FMOD_RESULT F_API getPlaybackState(FMOD_STUDIO_PLAYBACK_STATE* state) const;
+				FMOD_RESULT F_API setBankPath(const char* bankPath);
+				FMOD_RESULT F_API setFrameCallback(FMOD_STUDIO_COMMANDREPLAY_FRAME_CALLBACK callback);
+
+				// Playback
+				FMOD_RESULT F_API start();
+				FMOD_RESULT F_API stop();
+				FMOD_RESULT F_API release();
+
+				FMOD_RESULT F_API setUserData(void* userdata);
+				FMOD_RESULT F_API getUserData(void** userdata) const;
+		};
+	}
+}
+#endif
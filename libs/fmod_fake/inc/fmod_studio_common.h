@@ -0,0 +1,211 @@
+/*
+ * Fake FMOD Studio common types, see libs/fmod_fake/readme.md
+ */
+
+#ifndef FMOD_FAKE_STUDIO_COMMON_H
+#define FMOD_FAKE_STUDIO_COMMON_H
+
+#include "fmod_common.h"
+
+typedef unsigned int FMOD_STUDIO_INITFLAGS;
+typedef unsigned int FMOD_STUDIO_PARAMETER_FLAGS;
+typedef unsigned int FMOD_STUDIO_SYSTEM_CALLBACK_TYPE;
+typedef unsigned int FMOD_STUDIO_EVENT_CALLBACK_TYPE;
+typedef unsigned int FMOD_STUDIO_LOAD_BANK_FLAGS;
+typedef unsigned int FMOD_STUDIO_COMMANDCAPTURE_FLAGS;
+typedef unsigned int FMOD_STUDIO_COMMANDREPLAY_FLAGS;
+
+typedef struct FMOD_STUDIO_SYSTEM FMOD_STUDIO_SYSTEM;
+typedef struct FMOD_STUDIO_EVENTDESCRIPTION FMOD_STUDIO_EVENTDESCRIPTION;
+typedef struct FMOD_STUDIO_EVENTINSTANCE FMOD_STUDIO_EVENTINSTANCE;
+typedef struct FMOD_STUDIO_BUS FMOD_STUDIO_BUS;
+typedef struct FMOD_STUDIO_VCA FMOD_STUDIO_VCA;
+typedef struct FMOD_STUDIO_BANK FMOD_STUDIO_BANK;
+typedef struct FMOD_STUDIO_COMMANDREPLAY FMOD_STUDIO_COMMANDREPLAY;
+
+#define FMOD_STUDIO_INIT_NORMAL                             0x00000000
+#define FMOD_STUDIO_INIT_LIVEUPDATE                         0x00000001
+#define FMOD_STUDIO_INIT_ALLOW_MISSING_PLUGINS              0x00000002
+#define FMOD_STUDIO_INIT_SYNCHRONOUS_UPDATE                 0x00000004
+#define FMOD_STUDIO_INIT_DEFERRED_CALLBACKS                 0x00000008
+#define FMOD_STUDIO_INIT_LOAD_FROM_UPDATE                   0x00000010
+#define FMOD_STUDIO_INIT_MEMORY_TRACKING                    0x00000020
+
+#define FMOD_STUDIO_PARAMETER_READONLY                      0x00000001
+#define FMOD_STUDIO_PARAMETER_AUTOMATIC                     0x00000002
+#define FMOD_STUDIO_PARAMETER_GLOBAL                        0x00000004
+#define FMOD_STUDIO_PARAMETER_DISCRETE                      0x00000008
+#define FMOD_STUDIO_PARAMETER_LABELED                       0x00000010
+
+#define FMOD_STUDIO_SYSTEM_CALLBACK_PREUPDATE               0x00000001
+#define FMOD_STUDIO_SYSTEM_CALLBACK_POSTUPDATE              0x00000002
+#define FMOD_STUDIO_SYSTEM_CALLBACK_BANK_UNLOAD             0x00000004
+#define FMOD_STUDIO_SYSTEM_CALLBACK_LIVEUPDATE_CONNECTED    0x00000008
+#define FMOD_STUDIO_SYSTEM_CALLBACK_LIVEUPDATE_DISCONNECTED 0x00000010
+#define FMOD_STUDIO_SYSTEM_CALLBACK_ALL                     0xFFFFFFFF
+
+#define FMOD_STUDIO_EVENT_CALLBACK_CREATED                  0x00000001
+#define FMOD_STUDIO_EVENT_CALLBACK_DESTROYED                0x00000002
+#define FMOD_STUDIO_EVENT_CALLBACK_STARTING                 0x00000004
+#define FMOD_STUDIO_EVENT_CALLBACK_STARTED                  0x00000008
+#define FMOD_STUDIO_EVENT_CALLBACK_RESTARTED                0x00000010
+#define FMOD_STUDIO_EVENT_CALLBACK_STOPPED                  0x00000020
+#define FMOD_STUDIO_EVENT_CALLBACK_START_FAILED             0x00000040
+#define FMOD_STUDIO_EVENT_CALLBACK_CREATE_PROGRAMMER_SOUND  0x00000080
+#define FMOD_STUDIO_EVENT_CALLBACK_DESTROY_PROGRAMMER_SOUND 0x00000100
+#define FMOD_STUDIO_EVENT_CALLBACK_PLUGIN_CREATED           0x00000200
+#define FMOD_STUDIO_EVENT_CALLBACK_PLUGIN_DESTROYED         0x00000400
+#define FMOD_STUDIO_EVENT_CALLBACK_TIMELINE_MARKER          0x00000800
+#define FMOD_STUDIO_EVENT_CALLBACK_TIMELINE_BEAT            0x00001000
+#define FMOD_STUDIO_EVENT_CALLBACK_SOUND_PLAYED             0x00002000
+#define FMOD_STUDIO_EVENT_CALLBACK_SOUND_STOPPED            0x00004000
+#define FMOD_STUDIO_EVENT_CALLBACK_REAL_TO_VIRTUAL          0x00008000
+#define FMOD_STUDIO_EVENT_CALLBACK_VIRTUAL_TO_REAL          0x00010000
+#define FMOD_STUDIO_EVENT_CALLBACK_START_EVENT_COMMAND      0x00020000
+#define FMOD_STUDIO_EVENT_CALLBACK_NESTED_TIMELINE_BEAT     0x00040000
+#define FMOD_STUDIO_EVENT_CALLBACK_ALL                      0xFFFFFFFF
+
+#define FMOD_STUDIO_LOAD_BANK_NORMAL                        0x00000000
+#define FMOD_STUDIO_LOAD_BANK_NONBLOCKING                   0x00000001
+#define FMOD_STUDIO_LOAD_BANK_DECOMPRESS_SAMPLES            0x00000002
+#define FMOD_STUDIO_LOAD_BANK_UNENCRYPTED                   0x00000004
+
+#define FMOD_STUDIO_COMMANDCAPTURE_NORMAL                   0x00000000
+#define FMOD_STUDIO_COMMANDCAPTURE_FILEFLUSH                0x00000001
+#define FMOD_STUDIO_COMMANDCAPTURE_SKIP_INITIAL_STATE       0x00000002
+
+#define FMOD_STUDIO_COMMANDREPLAY_NORMAL                    0x00000000
+#define FMOD_STUDIO_COMMANDREPLAY_SKIP_CLEANUP              0x00000001
+#define FMOD_STUDIO_COMMANDREPLAY_FAST_FORWARD              0x00000002
+#define FMOD_STUDIO_COMMANDREPLAY_SKIP_BANK_LOAD            0x00000004
+
+typedef enum FMOD_STUDIO_LOADING_STATE
+{
+	FMOD_STUDIO_LOADING_STATE_UNLOADING,
+	FMOD_STUDIO_LOADING_STATE_UNLOADED,
+	FMOD_STUDIO_LOADING_STATE_LOADING,
+	FMOD_STUDIO_LOADING_STATE_LOADED,
+	FMOD_STUDIO_LOADING_STATE_ERROR
+} FMOD_STUDIO_LOADING_STATE;
+
+typedef enum FMOD_STUDIO_PLAYBACK_STATE
+{
+	FMOD_STUDIO_PLAYBACK_PLAYING,
+	FMOD_STUDIO_PLAYBACK_SUSTAINING,
+	FMOD_STUDIO_PLAYBACK_STOPPED,
+	FMOD_STUDIO_PLAYBACK_STARTING,
+	FMOD_STUDIO_PLAYBACK_STOPPING
+} FMOD_STUDIO_PLAYBACK_STATE;
+
+typedef enum FMOD_STUDIO_STOP_MODE
+{
+	FMOD_STUDIO_STOP_ALLOWFADEOUT,
+	FMOD_STUDIO_STOP_IMMEDIATE
+} FMOD_STUDIO_STOP_MODE;
+
+typedef enum FMOD_STUDIO_PARAMETER_TYPE
+{
+	FMOD_STUDIO_PARAMETER_GAME_CONTROLLED,
+	FMOD_STUDIO_PARAMETER_AUTOMATIC_DISTANCE,
+	FMOD_STUDIO_PARAMETER_AUTOMATIC_EVENT_CONE_ANGLE,
+	FMOD_STUDIO_PARAMETER_AUTOMATIC_EVENT_ORIENTATION,
+	FMOD_STUDIO_PARAMETER_AUTOMATIC_DIRECTION,
+	FMOD_STUDIO_PARAMETER_AUTOMATIC_ELEVATION,
+	FMOD_STUDIO_PARAMETER_AUTOMATIC_LISTENER_ORIENTATION,
+	FMOD_STUDIO_PARAMETER_AUTOMATIC_SPEED,
+	FMOD_STUDIO_PARAMETER_AUTOMATIC_SPEED_ABSOLUTE,
+	FMOD_STUDIO_PARAMETER_AUTOMATIC_DISTANCE_NORMALIZED,
+	FMOD_STUDIO_PARAMETER_MAX
+} FMOD_STUDIO_PARAMETER_TYPE;
+
+typedef struct FMOD_STUDIO_ADVANCEDSETTINGS
+{
+	int cbsize;
+	unsigned int commandqueuesize;
+	unsigned int handleinitialsize;
+	int studioupdateperiod;
+	int idlesampledatapoolsize;
+	unsigned int streamingscheduledelay;
+	const char* encryptionkey;
+} FMOD_STUDIO_ADVANCEDSETTINGS;
+
+typedef struct FMOD_STUDIO_PARAMETER_ID
+{
+	unsigned int data1;
+	unsigned int data2;
+} FMOD_STUDIO_PARAMETER_ID;
+
+typedef struct FMOD_STUDIO_PARAMETER_DESCRIPTION
+{
+	const char* name;
+	FMOD_STUDIO_PARAMETER_ID id;
+	float minimum;
+	float maximum;
+	float defaultvalue;
+	FMOD_STUDIO_PARAMETER_TYPE type;
+	FMOD_STUDIO_PARAMETER_FLAGS flags;
+	FMOD_GUID guid;
+} FMOD_STUDIO_PARAMETER_DESCRIPTION;
+
+typedef struct FMOD_STUDIO_SOUND_INFO
+{
+	const char* name_or_data;
+	FMOD_MODE mode;
+	FMOD_CREATESOUNDEXINFO exinfo;
+	int subsoundindex;
+} FMOD_STUDIO_SOUND_INFO;
+
+typedef struct FMOD_STUDIO_PROGRAMMER_SOUND_PROPERTIES
+{
+	const char* name;
+	FMOD_SOUND* sound;
+	int subsoundIndex;
+} FMOD_STUDIO_PROGRAMMER_SOUND_PROPERTIES;
+
+typedef struct FMOD_STUDIO_TIMELINE_MARKER_PROPERTIES
+{
+	const char* name;
+	int position;
+} FMOD_STUDIO_TIMELINE_MARKER_PROPERTIES;
+
+typedef struct FMOD_STUDIO_TIMELINE_BEAT_PROPERTIES
+{
+	int bar;
+	int beat;
+	int position;
+	float tempo;
+	int timesignatureupper;
+	int timesignaturelower;
+} FMOD_STUDIO_TIMELINE_BEAT_PROPERTIES;
+
+typedef struct FMOD_STUDIO_BUFFER_INFO
+{
+	int currentusage;
+	int peakusage;
+	int capacity;
+	int stallcount;
+	float stalltime;
+} FMOD_STUDIO_BUFFER_INFO;
+
+typedef struct FMOD_STUDIO_BUFFER_USAGE
+{
+	FMOD_STUDIO_BUFFER_INFO studiocommandqueue;
+	FMOD_STUDIO_BUFFER_INFO studiohandle;
+} FMOD_STUDIO_BUFFER_USAGE;
+
+typedef struct FMOD_STUDIO_CPU_USAGE
+{
+	float update;
+} FMOD_STUDIO_CPU_USAGE;
+
+typedef struct FMOD_STUDIO_MEMORY_USAGE
+{
+	int exclusive;
+	int inclusive;
+	int sampledata;
+} FMOD_STUDIO_MEMORY_USAGE;
+
+typedef FMOD_RESULT (F_CALL *FMOD_STUDIO_SYSTEM_CALLBACK)(FMOD_STUDIO_SYSTEM* system, FMOD_STUDIO_SYSTEM_CALLBACK_TYPE type, void* commanddata, void* userdata);
+typedef FMOD_RESULT (F_CALL *FMOD_STUDIO_EVENT_CALLBACK)(FMOD_STUDIO_EVENT_CALLBACK_TYPE type, FMOD_STUDIO_EVENTINSTANCE* event, void* parameters);
+typedef FMOD_RESULT (F_CALL *FMOD_STUDIO_COMMANDREPLAY_FRAME_CALLBACK)(FMOD_STUDIO_COMMANDREPLAY* replay, int commandindex, float currenttime, void* userdata);
+#endif
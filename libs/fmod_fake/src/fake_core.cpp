@@ -0,0 +1,850 @@
+#include "fake_state.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+
+using namespace FMOD::Fake;
+
+namespace
+{
+	constexpr unsigned int DEFAULT_SOUND_LENGTH_MS = 1000;
+	constexpr int64_t SYSTEM_BASE_BYTES = 256 * 1024;
+	constexpr const char* DRIVER_NAME = "Fake Output";
+	constexpr const char* FADER_DSP_NAME = "Fader";
+
+	bool IsCoreSystem(const State& state, const void* system)
+	{
+		return state.coreSystem != 0 && ToHandle(system) == state.coreSystem;
+	}
+
+	int GetSpeakerModeChannels(const State& state)
+	{
+		switch (state.speakerMode)
+		{
+			case FMOD_SPEAKERMODE_MONO: return 1;
+			case FMOD_SPEAKERMODE_QUAD: return 4;
+			case FMOD_SPEAKERMODE_SURROUND: return 5;
+			case FMOD_SPEAKERMODE_5POINT1: return 6;
+			case FMOD_SPEAKERMODE_7POINT1: return 8;
+			case FMOD_SPEAKERMODE_7POINT1POINT4: return 12;
+			default: return 2;
+		}
+	}
+
+	// Accepts the file name as given or with the platform shared library prefix and suffix
+	std::string FindPluginFile(const std::string& pluginPath, const std::string& fileName)
+	{
+#if defined(_WIN32)
+		const std::string candidates[] = { fileName, fileName + ".dll" };
+#elif defined(__APPLE__)
+		const std::string candidates[] = { fileName, "lib" + fileName + ".dylib", fileName + ".dylib" };
+#else
+		const std::string candidates[] = { fileName, "lib" + fileName + ".so", fileName + ".so" };
+#endif
+		for (const std::string& candidate : candidates)
+		{
+			const std::filesystem::path path = pluginPath.empty() ? std::filesystem::path(candidate) : std::filesystem::path(pluginPath) / candidate;
+			if (std::error_code error; std::filesystem::is_regular_file(path, error)) { return path.string(); }
+		}
+		return "";
+	}
+
+	FMOD_RESULT InvalidCoreSystem(const void* system, const char* function)
+	{
+		return Report(FMOD_ERR_INVALID_HANDLE, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, system, function);
+	}
+
+	FMOD_RESULT InvalidChannelGroup(const void* channelGroup, const char* function)
+	{
+		return Report(FMOD_ERR_INVALID_HANDLE, FMOD_ERRORCALLBACK_INSTANCETYPE_CHANNELGROUP, channelGroup, function);
+	}
+
+	FMOD_RESULT InvalidDSP(const void* dsp, const char* function)
+	{
+		return Report(FMOD_ERR_INVALID_HANDLE, FMOD_ERRORCALLBACK_INSTANCETYPE_DSP, dsp, function);
+	}
+}
+
+namespace FMOD::Fake
+{
+	State& GetState()
+	{
+		static State sState;
+		return sState;
+	}
+
+	std::unique_lock<std::recursive_mutex> Lock()
+	{
+		return std::unique_lock(GetState().mutex);
+	}
+
+	FMOD_RESULT Report(const FMOD_RESULT result, const FMOD_ERRORCALLBACK_INSTANCETYPE instanceType, const void* instance,
+		const char* functionName, const std::string& functionParams)
+	{
+		State& state = GetState();
+		if (result == FMOD_OK || state.coreSystem == 0 || !state.coreCallback
+			|| (state.coreCallbackMask & FMOD_SYSTEM_CALLBACK_ERROR) == 0)
+		{
+			return result;
+		}
+
+		FMOD_ERRORCALLBACK_INFO errorInfo = {};
+		errorInfo.result = result;
+		errorInfo.instancetype = instanceType;
+		errorInfo.instance = const_cast<void*>(instance);
+		errorInfo.functionname = functionName;
+		errorInfo.functionparams = functionParams.c_str();
+		state.coreCallback(ToPointer<FMOD_SYSTEM>(state.coreSystem), FMOD_SYSTEM_CALLBACK_ERROR, &errorInfo, nullptr,
+			state.coreUserData);
+		return result;
+	}
+
+	void Log(const FMOD_DEBUG_FLAGS level, const char* function, const std::string& message)
+	{
+		const State& state = GetState();
+		if (state.debugCallback && (state.debugFlags & level) != 0)
+		{
+			state.debugCallback(level, "fmod_fake", 0, function, message.c_str());
+		}
+	}
+
+	FMOD_RESULT CopyString(const std::string& value, char* outBuffer, const int bufferSize, int* outRetrieved)
+	{
+		const int requiredSize = static_cast<int>(value.size()) + 1;
+		if (outRetrieved) { *outRetrieved = requiredSize; }
+		if (!outBuffer) { return FMOD_OK; }
+		if (bufferSize <= 0) { return FMOD_ERR_INVALID_PARAM; }
+
+		const int copySize = std::min(requiredSize, bufferSize) - 1;
+		std::memcpy(outBuffer, value.data(), static_cast<size_t>(copySize));
+		outBuffer[copySize] = '\0';
+		if (outRetrieved) { *outRetrieved = copySize + 1; }
+		return copySize + 1 < requiredSize ? FMOD_ERR_TRUNCATED : FMOD_OK;
+	}
+
+	uint64_t CreateChannelGroup(State& state, const std::string& name, const uint64_t parent, const int numChannels)
+	{
+		ChannelGroupObject channelGroupObject;
+		channelGroupObject.name = name;
+		channelGroupObject.parent = parent;
+		channelGroupObject.numChannels = numChannels;
+		const uint64_t channelGroup = state.channelGroups.Add(std::move(channelGroupObject));
+
+		DSPObject dspObject;
+		dspObject.channelGroup = channelGroup;
+		state.channelGroups.Get(ToPointer<void>(channelGroup))->dsp = state.dsps.Add(dspObject);
+
+		if (ChannelGroupObject* parentObject = state.channelGroups.Get(ToPointer<void>(parent)))
+		{
+			parentObject->children.push_back(channelGroup);
+		}
+		return channelGroup;
+	}
+
+	void ReleaseChannelGroup(State& state, const uint64_t channelGroup)
+	{
+		ChannelGroupObject* channelGroupObject = state.channelGroups.Get(ToPointer<void>(channelGroup));
+		if (!channelGroupObject) { return; }
+
+		// Children move up to the parent, like releasing a group in the real mixer
+		ChannelGroupObject* parentObject = state.channelGroups.Get(ToPointer<void>(channelGroupObject->parent));
+		for (const uint64_t child : channelGroupObject->children)
+		{
+			if (ChannelGroupObject* childObject = state.channelGroups.Get(ToPointer<void>(child)))
+			{
+				childObject->parent = channelGroupObject->parent;
+				if (parentObject) { parentObject->children.push_back(child); }
+			}
+		}
+		if (parentObject) { std::erase(parentObject->children, channelGroup); }
+
+		state.dsps.Remove(ToPointer<void>(channelGroupObject->dsp));
+		state.channelGroups.Remove(ToPointer<void>(channelGroup));
+	}
+
+	void AdvanceMixer(State& state)
+	{
+		state.mixerClock += state.dspBufferLength;
+	}
+
+	int64_t GetTrackedBytes(State& state)
+	{
+		if (state.coreSystem == 0) { return 0; }
+
+		int64_t bytes = SYSTEM_BASE_BYTES;
+		for (uint32_t i = 0; i < state.banks.GetSlotCount(); ++i)
+		{
+			if (const BankObject* bank = state.banks.GetAt(i)) { bytes += bank->sizeBytes; }
+		}
+		bytes += static_cast<int64_t>(state.channelGroups.GetCount() * (sizeof(ChannelGroupObject) + sizeof(DSPObject)));
+		bytes += static_cast<int64_t>(state.sounds.GetCount() * sizeof(SoundObject));
+		bytes += static_cast<int64_t>(state.eventDescriptions.GetCount() * sizeof(EventDescriptionObject));
+		bytes += static_cast<int64_t>(state.eventInstances.GetCount() * sizeof(EventInstanceObject));
+		bytes += static_cast<int64_t>(state.buses.GetCount() * sizeof(BusObject) + state.vcas.GetCount() * sizeof(VCAObject));
+		state.maxTrackedBytes = std::max(state.maxTrackedBytes, bytes);
+		return bytes;
+	}
+
+	void ResetCore(State& state)
+	{
+		state.channelGroups.Clear();
+		state.dsps.Clear();
+		state.sounds.Clear();
+		state.coreSystem = 0;
+		state.bCoreInitialized = false;
+		state.outputType = FMOD_OUTPUTTYPE_AUTODETECT;
+		state.speakerMode = FMOD_SPEAKERMODE_STEREO;
+		state.sampleRate = 48000;
+		state.dspBufferLength = 1024;
+		state.dspBufferCount = 4;
+		state.softwareChannels = 64;
+		state.coreCallback = nullptr;
+		state.coreCallbackMask = 0;
+		state.coreUserData = nullptr;
+		state.fileSystem = {};
+		state.pluginPath.clear();
+		state.plugins.clear();
+		state.masterChannelGroup = 0;
+		state.mixerClock = 0;
+	}
+}
+
+// Global functions
+
+FMOD_RESULT FMOD::Memory_GetStats(int* currentalloced, int* maxalloced, bool)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	const int64_t trackedBytes = GetTrackedBytes(state);
+	if (currentalloced) { *currentalloced = static_cast<int>(std::min<int64_t>(trackedBytes, INT32_MAX)); }
+	if (maxalloced) { *maxalloced = static_cast<int>(std::min<int64_t>(state.maxTrackedBytes, INT32_MAX)); }
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Debug_Initialize(const FMOD_DEBUG_FLAGS flags, const FMOD_DEBUG_MODE mode, const FMOD_DEBUG_CALLBACK callback,
+	const char*)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (mode == FMOD_DEBUG_MODE_CALLBACK && !callback) { return FMOD_ERR_INVALID_PARAM; }
+
+	// TTY and file modes have nothing to write to, the fake only logs through the callback
+	state.debugFlags = flags;
+	state.debugCallback = mode == FMOD_DEBUG_MODE_CALLBACK ? callback : nullptr;
+	return FMOD_OK;
+}
+
+// System
+
+FMOD_RESULT FMOD::System::release()
+{
+	const auto lock = Lock();
+	if (!IsCoreSystem(GetState(), this)) { return InvalidCoreSystem(this, "System::release"); }
+
+	// Owned by the Studio System, which releases it
+	return Report(FMOD_ERR_UNSUPPORTED, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::release");
+}
+
+FMOD_RESULT FMOD::System::setOutput(const FMOD_OUTPUTTYPE output)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!IsCoreSystem(state, this)) { return InvalidCoreSystem(this, "System::setOutput"); }
+	if (output < FMOD_OUTPUTTYPE_AUTODETECT || output >= FMOD_OUTPUTTYPE_MAX)
+	{
+		return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::setOutput");
+	}
+
+	state.outputType = output;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::getOutput(FMOD_OUTPUTTYPE* output)
+{
+	const auto lock = Lock();
+	const State& state = GetState();
+	if (!IsCoreSystem(state, this)) { return InvalidCoreSystem(this, "System::getOutput"); }
+	if (!output) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::getOutput"); }
+
+	*output = state.outputType;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::getNumDrivers(int* numdrivers)
+{
+	const auto lock = Lock();
+	if (!IsCoreSystem(GetState(), this)) { return InvalidCoreSystem(this, "System::getNumDrivers"); }
+	if (!numdrivers) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::getNumDrivers"); }
+
+	*numdrivers = 1;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::getDriverInfo(const int id, char* name, const int namelen, FMOD_GUID* guid, int* systemrate,
+	FMOD_SPEAKERMODE* speakermode, int* speakermodechannels)
+{
+	const auto lock = Lock();
+	const State& state = GetState();
+	if (!IsCoreSystem(state, this)) { return InvalidCoreSystem(this, "System::getDriverInfo"); }
+	if (id != 0)
+	{
+		return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::getDriverInfo", std::to_string(id));
+	}
+
+	if (guid) { *guid = {}; }
+	if (systemrate) { *systemrate = state.sampleRate; }
+	if (speakermode) { *speakermode = state.speakerMode; }
+	if (speakermodechannels) { *speakermodechannels = GetSpeakerModeChannels(state); }
+	if (name && namelen > 0) { CopyString(DRIVER_NAME, name, namelen, nullptr); }
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::setDriver(const int driver)
+{
+	const auto lock = Lock();
+	if (!IsCoreSystem(GetState(), this)) { return InvalidCoreSystem(this, "System::setDriver"); }
+	if (driver != 0)
+	{
+		return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::setDriver", std::to_string(driver));
+	}
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::setSoftwareChannels(const int numsoftwarechannels)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!IsCoreSystem(state, this)) { return InvalidCoreSystem(this, "System::setSoftwareChannels"); }
+	if (state.bCoreInitialized) { return Report(FMOD_ERR_INITIALIZED, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::setSoftwareChannels"); }
+	if (numsoftwarechannels < 0)
+	{
+		return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::setSoftwareChannels");
+	}
+
+	state.softwareChannels = numsoftwarechannels;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::setSoftwareFormat(const int samplerate, const FMOD_SPEAKERMODE speakermode, const int)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!IsCoreSystem(state, this)) { return InvalidCoreSystem(this, "System::setSoftwareFormat"); }
+	if (state.bCoreInitialized) { return Report(FMOD_ERR_INITIALIZED, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::setSoftwareFormat"); }
+	if (samplerate < 8000 || samplerate > 192000 || speakermode < FMOD_SPEAKERMODE_DEFAULT || speakermode >= FMOD_SPEAKERMODE_MAX)
+	{
+		return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::setSoftwareFormat");
+	}
+
+	state.sampleRate = samplerate;
+	state.speakerMode = speakermode == FMOD_SPEAKERMODE_DEFAULT ? FMOD_SPEAKERMODE_STEREO : speakermode;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::getSoftwareFormat(int* samplerate, FMOD_SPEAKERMODE* speakermode, int* numrawspeakers)
+{
+	const auto lock = Lock();
+	const State& state = GetState();
+	if (!IsCoreSystem(state, this)) { return InvalidCoreSystem(this, "System::getSoftwareFormat"); }
+
+	if (samplerate) { *samplerate = state.sampleRate; }
+	if (speakermode) { *speakermode = state.speakerMode; }
+	if (numrawspeakers) { *numrawspeakers = 0; }
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::setDSPBufferSize(const unsigned int bufferlength, const int numbuffers)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!IsCoreSystem(state, this)) { return InvalidCoreSystem(this, "System::setDSPBufferSize"); }
+	if (state.bCoreInitialized) { return Report(FMOD_ERR_INITIALIZED, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::setDSPBufferSize"); }
+	if (bufferlength == 0 || numbuffers < 2)
+	{
+		return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::setDSPBufferSize");
+	}
+
+	state.dspBufferLength = bufferlength;
+	state.dspBufferCount = numbuffers;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::getDSPBufferSize(unsigned int* bufferlength, int* numbuffers)
+{
+	const auto lock = Lock();
+	const State& state = GetState();
+	if (!IsCoreSystem(state, this)) { return InvalidCoreSystem(this, "System::getDSPBufferSize"); }
+
+	if (bufferlength) { *bufferlength = state.dspBufferLength; }
+	if (numbuffers) { *numbuffers = state.dspBufferCount; }
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::setFileSystem(const FMOD_FILE_OPEN_CALLBACK useropen, const FMOD_FILE_CLOSE_CALLBACK userclose,
+	const FMOD_FILE_READ_CALLBACK userread, FMOD_FILE_SEEK_CALLBACK, FMOD_FILE_ASYNCREAD_CALLBACK, FMOD_FILE_ASYNCCANCEL_CALLBACK, int)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!IsCoreSystem(state, this)) { return InvalidCoreSystem(this, "System::setFileSystem"); }
+	if (state.bCoreInitialized) { return Report(FMOD_ERR_INITIALIZED, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::setFileSystem"); }
+
+	// Bank loads read sequentially through these, seeking and async reads are never needed
+	state.fileSystem.open = useropen;
+	state.fileSystem.close = userclose;
+	state.fileSystem.read = userread;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::attachFileSystem(FMOD_FILE_OPEN_CALLBACK, FMOD_FILE_CLOSE_CALLBACK, FMOD_FILE_READ_CALLBACK,
+	FMOD_FILE_SEEK_CALLBACK)
+{
+	const auto lock = Lock();
+	if (!IsCoreSystem(GetState(), this)) { return InvalidCoreSystem(this, "System::attachFileSystem"); }
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::setAdvancedSettings(FMOD_ADVANCEDSETTINGS* settings)
+{
+	const auto lock = Lock();
+	const State& state = GetState();
+	if (!IsCoreSystem(state, this)) { return InvalidCoreSystem(this, "System::setAdvancedSettings"); }
+	if (state.bCoreInitialized) { return Report(FMOD_ERR_INITIALIZED, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::setAdvancedSettings"); }
+	if (!settings || settings->cbSize != sizeof(FMOD_ADVANCEDSETTINGS))
+	{
+		return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::setAdvancedSettings");
+	}
+
+	// Nothing in the fake is random or depends on codecs, the settings are only validated
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::setCallback(const FMOD_SYSTEM_CALLBACK callback, const FMOD_SYSTEM_CALLBACK_TYPE callbackmask)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!IsCoreSystem(state, this)) { return InvalidCoreSystem(this, "System::setCallback"); }
+
+	state.coreCallback = callback;
+	state.coreCallbackMask = callback ? callbackmask : 0;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::setPluginPath(const char* path)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!IsCoreSystem(state, this)) { return InvalidCoreSystem(this, "System::setPluginPath"); }
+
+	state.pluginPath = path ? path : "";
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::loadPlugin(const char* filename, unsigned int* handle, unsigned int)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!IsCoreSystem(state, this)) { return InvalidCoreSystem(this, "System::loadPlugin"); }
+	if (!filename || !handle) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::loadPlugin"); }
+
+	// The file must exist, it is never loaded
+	const std::string pluginFile = FindPluginFile(state.pluginPath, filename);
+	if (pluginFile.empty()) { return Report(FMOD_ERR_FILE_NOTFOUND, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::loadPlugin", filename); }
+
+	state.plugins.push_back(pluginFile);
+	*handle = static_cast<unsigned int>(state.plugins.size());
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::unloadPlugin(const unsigned int handle)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!IsCoreSystem(state, this)) { return InvalidCoreSystem(this, "System::unloadPlugin"); }
+	if (handle == 0 || handle > state.plugins.size() || state.plugins[handle - 1].empty())
+	{
+		return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::unloadPlugin", std::to_string(handle));
+	}
+
+	state.plugins[handle - 1].clear();
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::update()
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!IsCoreSystem(state, this)) { return InvalidCoreSystem(this, "System::update"); }
+	if (!state.bCoreInitialized) { return Report(FMOD_ERR_UNINITIALIZED, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::update"); }
+
+	AdvanceMixer(state);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::getCPUUsage(FMOD_CPU_USAGE* usage)
+{
+	const auto lock = Lock();
+	if (!IsCoreSystem(GetState(), this)) { return InvalidCoreSystem(this, "System::getCPUUsage"); }
+	if (!usage) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::getCPUUsage"); }
+
+	*usage = {};
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::createSound(const char* name_or_data, FMOD_MODE, FMOD_CREATESOUNDEXINFO* exinfo, Sound** sound)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!IsCoreSystem(state, this)) { return InvalidCoreSystem(this, "System::createSound"); }
+	if (!sound) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::createSound"); }
+	*sound = nullptr;
+	if (!state.bCoreInitialized) { return Report(FMOD_ERR_UNINITIALIZED, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::createSound"); }
+	if (!name_or_data) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::createSound"); }
+
+	// Never opens the file, an explicit length in PCM samples is the only format information used
+	SoundObject soundObject;
+	soundObject.name = name_or_data;
+	soundObject.lengthMs = DEFAULT_SOUND_LENGTH_MS;
+	if (exinfo && exinfo->cbsize >= static_cast<int>(sizeof(FMOD_CREATESOUNDEXINFO)) && exinfo->length > 0)
+	{
+		soundObject.lengthMs = static_cast<unsigned int>(static_cast<uint64_t>(exinfo->length) * 1000 / static_cast<uint64_t>(state.sampleRate));
+	}
+	*sound = ToPointer<Sound>(state.sounds.Add(std::move(soundObject)));
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::getChannelsPlaying(int* channels, int* realchannels)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!IsCoreSystem(state, this)) { return InvalidCoreSystem(this, "System::getChannelsPlaying"); }
+
+	// One channel per playing event instance, virtual ones are not real
+	int playingCount = 0;
+	int realCount = 0;
+	for (uint32_t i = 0; i < state.eventInstances.GetSlotCount(); ++i)
+	{
+		if (const EventInstanceObject* instance = state.eventInstances.GetAt(i); instance && instance->channelGroup != 0)
+		{
+			++playingCount;
+			if (!instance->bVirtual) { ++realCount; }
+		}
+	}
+	if (channels) { *channels = playingCount; }
+	if (realchannels) { *realchannels = realCount; }
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::getMasterChannelGroup(ChannelGroup** channelgroup)
+{
+	const auto lock = Lock();
+	const State& state = GetState();
+	if (!IsCoreSystem(state, this)) { return InvalidCoreSystem(this, "System::getMasterChannelGroup"); }
+	if (!channelgroup) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::getMasterChannelGroup"); }
+	*channelgroup = nullptr;
+	if (!state.bCoreInitialized) { return Report(FMOD_ERR_UNINITIALIZED, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::getMasterChannelGroup"); }
+
+	*channelgroup = ToPointer<ChannelGroup>(state.masterChannelGroup);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::setUserData(void* userdata)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!IsCoreSystem(state, this)) { return InvalidCoreSystem(this, "System::setUserData"); }
+
+	state.coreUserData = userdata;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::System::getUserData(void** userdata)
+{
+	const auto lock = Lock();
+	const State& state = GetState();
+	if (!IsCoreSystem(state, this)) { return InvalidCoreSystem(this, "System::getUserData"); }
+	if (!userdata) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_SYSTEM, this, "System::getUserData"); }
+
+	*userdata = state.coreUserData;
+	return FMOD_OK;
+}
+
+// Sound
+
+FMOD_RESULT FMOD::Sound::release()
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!state.sounds.Get(this)) { return Report(FMOD_ERR_INVALID_HANDLE, FMOD_ERRORCALLBACK_INSTANCETYPE_SOUND, this, "Sound::release"); }
+
+	state.sounds.Remove(this);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Sound::getName(char* name, const int namelen)
+{
+	const auto lock = Lock();
+	const SoundObject* sound = GetState().sounds.Get(this);
+	if (!sound) { return Report(FMOD_ERR_INVALID_HANDLE, FMOD_ERRORCALLBACK_INSTANCETYPE_SOUND, this, "Sound::getName"); }
+	if (!name || namelen <= 0) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_SOUND, this, "Sound::getName"); }
+
+	// Like the real API, a long name is cut without an error
+	CopyString(sound->name, name, namelen, nullptr);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Sound::getLength(unsigned int* length, const FMOD_TIMEUNIT lengthtype)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	const SoundObject* sound = state.sounds.Get(this);
+	if (!sound) { return Report(FMOD_ERR_INVALID_HANDLE, FMOD_ERRORCALLBACK_INSTANCETYPE_SOUND, this, "Sound::getLength"); }
+	if (!length) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_SOUND, this, "Sound::getLength"); }
+
+	const uint64_t samples = static_cast<uint64_t>(sound->lengthMs) * static_cast<uint64_t>(state.sampleRate) / 1000;
+	switch (lengthtype)
+	{
+		case FMOD_TIMEUNIT_MS: *length = sound->lengthMs; return FMOD_OK;
+		case FMOD_TIMEUNIT_PCM: *length = static_cast<unsigned int>(samples); return FMOD_OK;
+		case FMOD_TIMEUNIT_PCMBYTES: *length = static_cast<unsigned int>(samples * 2 * sizeof(int16_t)); return FMOD_OK;
+		default: return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_SOUND, this, "Sound::getLength");
+	}
+}
+
+// ChannelControl, every channel control is a channel group
+
+FMOD_RESULT FMOD::ChannelControl::getSystemObject(System** system)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!state.channelGroups.Get(this)) { return InvalidChannelGroup(this, "ChannelControl::getSystemObject"); }
+	if (!system) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_CHANNELCONTROL, this, "ChannelControl::getSystemObject"); }
+
+	*system = ToPointer<System>(state.coreSystem);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::ChannelControl::getVolume(float* volume)
+{
+	const auto lock = Lock();
+	if (!GetState().channelGroups.Get(this)) { return InvalidChannelGroup(this, "ChannelControl::getVolume"); }
+	if (!volume) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_CHANNELCONTROL, this, "ChannelControl::getVolume"); }
+
+	*volume = 1.0f;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::ChannelControl::getDSPClock(unsigned long long* dspclock, unsigned long long* parentclock)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!state.channelGroups.Get(this)) { return InvalidChannelGroup(this, "ChannelControl::getDSPClock"); }
+
+	if (dspclock) { *dspclock = state.mixerClock; }
+	if (parentclock) { *parentclock = state.mixerClock; }
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::ChannelControl::getDSP(const int index, DSP** dsp)
+{
+	const auto lock = Lock();
+	const ChannelGroupObject* channelGroup = GetState().channelGroups.Get(this);
+	if (!channelGroup) { return InvalidChannelGroup(this, "ChannelControl::getDSP"); }
+	if (!dsp) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_CHANNELCONTROL, this, "ChannelControl::getDSP"); }
+	*dsp = nullptr;
+
+	// The fader is the only DSP, so it is also the head and the tail
+	if (index != 0 && index != FMOD_CHANNELCONTROL_DSP_HEAD && index != FMOD_CHANNELCONTROL_DSP_FADER && index != FMOD_CHANNELCONTROL_DSP_TAIL)
+	{
+		return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_CHANNELCONTROL, this, "ChannelControl::getDSP", std::to_string(index));
+	}
+
+	*dsp = ToPointer<DSP>(channelGroup->dsp);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::ChannelControl::getNumDSPs(int* numdsps)
+{
+	const auto lock = Lock();
+	if (!GetState().channelGroups.Get(this)) { return InvalidChannelGroup(this, "ChannelControl::getNumDSPs"); }
+	if (!numdsps) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_CHANNELCONTROL, this, "ChannelControl::getNumDSPs"); }
+
+	*numdsps = 1;
+	return FMOD_OK;
+}
+
+// ChannelGroup
+
+FMOD_RESULT FMOD::ChannelGroup::getNumGroups(int* numgroups)
+{
+	const auto lock = Lock();
+	const ChannelGroupObject* channelGroup = GetState().channelGroups.Get(this);
+	if (!channelGroup) { return InvalidChannelGroup(this, "ChannelGroup::getNumGroups"); }
+	if (!numgroups) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_CHANNELGROUP, this, "ChannelGroup::getNumGroups"); }
+
+	*numgroups = static_cast<int>(channelGroup->children.size());
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::ChannelGroup::getGroup(const int index, ChannelGroup** group)
+{
+	const auto lock = Lock();
+	const ChannelGroupObject* channelGroup = GetState().channelGroups.Get(this);
+	if (!channelGroup) { return InvalidChannelGroup(this, "ChannelGroup::getGroup"); }
+	if (!group || index < 0 || index >= static_cast<int>(channelGroup->children.size()))
+	{
+		return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_CHANNELGROUP, this, "ChannelGroup::getGroup", std::to_string(index));
+	}
+
+	*group = ToPointer<ChannelGroup>(channelGroup->children[index]);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::ChannelGroup::getName(char* name, const int namelen)
+{
+	const auto lock = Lock();
+	const ChannelGroupObject* channelGroup = GetState().channelGroups.Get(this);
+	if (!channelGroup) { return InvalidChannelGroup(this, "ChannelGroup::getName"); }
+	if (!name || namelen <= 0) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_CHANNELGROUP, this, "ChannelGroup::getName"); }
+
+	CopyString(channelGroup->name, name, namelen, nullptr);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::ChannelGroup::getNumChannels(int* numchannels)
+{
+	const auto lock = Lock();
+	const ChannelGroupObject* channelGroup = GetState().channelGroups.Get(this);
+	if (!channelGroup) { return InvalidChannelGroup(this, "ChannelGroup::getNumChannels"); }
+	if (!numchannels) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_CHANNELGROUP, this, "ChannelGroup::getNumChannels"); }
+
+	*numchannels = channelGroup->numChannels;
+	return FMOD_OK;
+}
+
+// DSP, one fader per channel group whose inputs are the faders of the child groups
+
+FMOD_RESULT FMOD::DSP::getNumInputs(int* numinputs)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	const DSPObject* dsp = state.dsps.Get(this);
+	if (!dsp) { return InvalidDSP(this, "DSP::getNumInputs"); }
+	if (!numinputs) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_DSP, this, "DSP::getNumInputs"); }
+
+	const ChannelGroupObject* channelGroup = state.channelGroups.Get(ToPointer<void>(dsp->channelGroup));
+	*numinputs = channelGroup ? static_cast<int>(channelGroup->children.size()) : 0;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::DSP::getInput(const int index, DSP** input, DSPConnection** inputconnection)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	const DSPObject* dsp = state.dsps.Get(this);
+	if (!dsp) { return InvalidDSP(this, "DSP::getInput"); }
+
+	const ChannelGroupObject* channelGroup = state.channelGroups.Get(ToPointer<void>(dsp->channelGroup));
+	if (!channelGroup || index < 0 || index >= static_cast<int>(channelGroup->children.size()))
+	{
+		return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_DSP, this, "DSP::getInput", std::to_string(index));
+	}
+
+	const ChannelGroupObject* child = state.channelGroups.Get(ToPointer<void>(channelGroup->children[index]));
+	if (input) { *input = child ? ToPointer<DSP>(child->dsp) : nullptr; }
+	if (inputconnection) { *inputconnection = nullptr; }
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::DSP::getActive(bool* active)
+{
+	const auto lock = Lock();
+	if (!GetState().dsps.Get(this)) { return InvalidDSP(this, "DSP::getActive"); }
+	if (!active) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_DSP, this, "DSP::getActive"); }
+
+	*active = true;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::DSP::getBypass(bool* bypass)
+{
+	const auto lock = Lock();
+	if (!GetState().dsps.Get(this)) { return InvalidDSP(this, "DSP::getBypass"); }
+	if (!bypass) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_DSP, this, "DSP::getBypass"); }
+
+	*bypass = false;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::DSP::getInfo(char* name, unsigned int* version, int* channels, int* configwidth, int* configheight)
+{
+	const auto lock = Lock();
+	if (!GetState().dsps.Get(this)) { return InvalidDSP(this, "DSP::getInfo"); }
+
+	// Real DSP names are at most 32 bytes with the terminator
+	if (name) { CopyString(FADER_DSP_NAME, name, 32, nullptr); }
+	if (version) { *version = 0x00010000; }
+	if (channels) { *channels = 0; }
+	if (configwidth) { *configwidth = 0; }
+	if (configheight) { *configheight = 0; }
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::DSP::getType(FMOD_DSP_TYPE* type)
+{
+	const auto lock = Lock();
+	if (!GetState().dsps.Get(this)) { return InvalidDSP(this, "DSP::getType"); }
+	if (!type) { return Report(FMOD_ERR_INVALID_PARAM, FMOD_ERRORCALLBACK_INSTANCETYPE_DSP, this, "DSP::getType"); }
+
+	*type = FMOD_DSP_TYPE_FADER;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::DSP::getCPUUsage(unsigned int* exclusive, unsigned int* inclusive)
+{
+	const auto lock = Lock();
+	if (!GetState().dsps.Get(this)) { return InvalidDSP(this, "DSP::getCPUUsage"); }
+
+	if (exclusive) { *exclusive = 0; }
+	if (inclusive) { *inclusive = 0; }
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::DSP::setMeteringEnabled(const bool inputEnabled, const bool outputEnabled)
+{
+	const auto lock = Lock();
+	DSPObject* dsp = GetState().dsps.Get(this);
+	if (!dsp) { return InvalidDSP(this, "DSP::setMeteringEnabled"); }
+
+	dsp->bMeteringInput = inputEnabled;
+	dsp->bMeteringOutput = outputEnabled;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::DSP::getMeteringEnabled(bool* inputEnabled, bool* outputEnabled)
+{
+	const auto lock = Lock();
+	const DSPObject* dsp = GetState().dsps.Get(this);
+	if (!dsp) { return InvalidDSP(this, "DSP::getMeteringEnabled"); }
+
+	if (inputEnabled) { *inputEnabled = dsp->bMeteringInput; }
+	if (outputEnabled) { *outputEnabled = dsp->bMeteringOutput; }
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::DSP::getMeteringInfo(FMOD_DSP_METERING_INFO* inputInfo, FMOD_DSP_METERING_INFO* outputInfo)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!state.dsps.Get(this)) { return InvalidDSP(this, "DSP::getMeteringInfo"); }
+
+	// Nothing is mixed, every level is silence
+	for (FMOD_DSP_METERING_INFO* info : { inputInfo, outputInfo })
+	{
+		if (!info) { continue; }
+		*info = {};
+		info->numsamples = static_cast<int>(state.dspBufferLength);
+		info->numchannels = static_cast<short>(GetSpeakerModeChannels(state));
+	}
+	return FMOD_OK;
+}
@@ -0,0 +1,326 @@
+#ifndef FMOD_FAKE_STATE_H
+#define FMOD_FAKE_STATE_H
+
+#include "fmod_studio.hpp"
+
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace FMOD::Fake
+{
+	static_assert(sizeof(void*) == sizeof(uint64_t), "Fake FMOD handles need 64-bit pointers");
+
+	enum class HandleType : uint64_t
+	{
+		CoreSystem = 1,
+		StudioSystem,
+		ChannelGroup,
+		DSP,
+		Sound,
+		Bank,
+		EventDescription,
+		EventInstance,
+		Bus,
+		VCA,
+		CommandReplay
+	};
+
+	/*
+	 * Handle bits: 63-56 type, 55-32 slot generation, 31-0 slot index + 1
+	 * The generation is bumped when a slot is freed, so a stale handle stays invalid after the slot is reused.
+	 */
+	constexpr uint64_t HANDLE_TYPE_SHIFT = 56;
+	constexpr uint64_t HANDLE_GENERATION_SHIFT = 32;
+	constexpr uint64_t HANDLE_GENERATION_MASK = 0xFFFFFF;
+	constexpr uint64_t HANDLE_INDEX_MASK = 0xFFFFFFFF;
+
+	inline uint64_t MakeHandle(const HandleType type, const uint32_t generation, const uint32_t index)
+	{
+		return static_cast<uint64_t>(type) << HANDLE_TYPE_SHIFT
+			| (static_cast<uint64_t>(generation) & HANDLE_GENERATION_MASK) << HANDLE_GENERATION_SHIFT
+			| (static_cast<uint64_t>(index) + 1);
+	}
+
+	template <typename T>
+	T* ToPointer(const uint64_t handle)
+	{
+		return reinterpret_cast<T*>(static_cast<uintptr_t>(handle));
+	}
+
+	inline uint64_t ToHandle(const void* pointer)
+	{
+		return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer));
+	}
+
+	/**
+	 * @brief Slot storage for one object type, addressed by encoded handles
+	 * Slots live in a deque so references stay valid while callbacks add objects during an iteration.
+	 */
+	template <typename TObject, HandleType Type>
+	class HandlePool
+	{
+		public:
+			uint64_t Add(TObject object)
+			{
+				uint32_t index = 0;
+				if (!mFreeIndices.empty())
+				{
+					index = mFreeIndices.back();
+					mFreeIndices.pop_back();
+				}
+				else
+				{
+					index = static_cast<uint32_t>(mSlots.size());
+					mSlots.emplace_back();
+				}
+
+				Slot& slot = mSlots[index];
+				slot.object = std::move(object);
+				slot.bUsed = true;
+				++mCount;
+				return MakeHandle(Type, slot.generation, index);
+			}
+
+			TObject* Get(const void* pointer)
+			{
+				const uint64_t handle = ToHandle(pointer);
+				if (handle >> HANDLE_TYPE_SHIFT != static_cast<uint64_t>(Type)) { return nullptr; }
+
+				const uint64_t indexPlusOne = handle & HANDLE_INDEX_MASK;
+				if (indexPlusOne == 0 || indexPlusOne > mSlots.size()) { return nullptr; }
+
+				Slot& slot = mSlots[indexPlusOne - 1];
+				const uint32_t generation = static_cast<uint32_t>(handle >> HANDLE_GENERATION_SHIFT & HANDLE_GENERATION_MASK);
+				return slot.bUsed && slot.generation == generation ? &slot.object : nullptr;
+			}
+
+			void Remove(const void* pointer)
+			{
+				if (Get(pointer) == nullptr) { return; }
+
+				const auto index = static_cast<uint32_t>((ToHandle(pointer) & HANDLE_INDEX_MASK) - 1);
+				Slot& slot = mSlots[index];
+				slot.object = TObject();
+				slot.bUsed = false;
+				slot.generation = (slot.generation + 1) & HANDLE_GENERATION_MASK;
+				if (slot.generation == 0) { slot.generation = 1; }
+				mFreeIndices.push_back(index);
+				--mCount;
+			}
+
+			void Clear()
+			{
+				for (uint32_t i = 0; i < mSlots.size(); ++i)
+				{
+					if (mSlots[i].bUsed) { Remove(ToPointer<void>(GetHandleAt(i))); }
+				}
+			}
+
+			/** Iterate with GetAt(0..GetSlotCount()), freed slots return nullptr */
+			[[nodiscard]] uint32_t GetSlotCount() const { return static_cast<uint32_t>(mSlots.size()); }
+			[[nodiscard]] size_t GetCount() const { return mCount; }
+			TObject* GetAt(const uint32_t index) { return mSlots[index].bUsed ? &mSlots[index].object : nullptr; }
+			[[nodiscard]] uint64_t GetHandleAt(const uint32_t index) const { return MakeHandle(Type, mSlots[index].generation, index); }
+
+		private:
+			struct Slot
+			{
+				TObject object;
+				uint32_t generation = 1;
+				bool bUsed = false;
+			};
+
+			std::deque<Slot> mSlots;
+			std::vector<uint32_t> mFreeIndices;
+			size_t mCount = 0;
+	};
+
+	struct ChannelGroupObject
+	{
+		std::string name;
+		uint64_t parent = 0;
+		uint64_t dsp = 0;
+		std::vector<uint64_t> children;
+		int numChannels = 0;
+	};
+
+	struct DSPObject
+	{
+		uint64_t channelGroup = 0;
+		bool bMeteringInput = false;
+		bool bMeteringOutput = false;
+	};
+
+	struct SoundObject
+	{
+		std::string name;
+		unsigned int lengthMs = 0;
+	};
+
+	struct BankObject
+	{
+		std::string filePath;
+		std::string path; // bank:/<file name without .bank>
+		int64_t sizeBytes = 0;
+		FMOD_STUDIO_LOADING_STATE loadingState = FMOD_STUDIO_LOADING_STATE_UNLOADED;
+		bool bSampleDataLoaded = false;
+		bool bHasContent = false; // Not a .strings bank, so paths can resolve to it
+		void* userData = nullptr;
+	};
+
+	struct EventDescriptionObject
+	{
+		std::string path;
+		uint64_t bank = 0;
+		int instanceCount = 0;
+		bool bSampleDataLoaded = false;
+		void* userData = nullptr;
+	};
+
+	struct EventInstanceObject
+	{
+		uint64_t description = 0;
+		uint64_t channelGroup = 0;
+		FMOD_STUDIO_PLAYBACK_STATE state = FMOD_STUDIO_PLAYBACK_STOPPED;
+		FMOD_STUDIO_EVENT_CALLBACK callback = nullptr;
+		FMOD_STUDIO_EVENT_CALLBACK_TYPE callbackMask = 0;
+		void* userData = nullptr;
+		FMOD_3D_ATTRIBUTES attributes = {};
+		std::vector<std::pair<unsigned int, float>> parameters; // Parameter ID data1, value
+		uint64_t timelineSamples = 0;
+		bool bCreatedNotified = false;
+		bool bStartPending = false;
+		bool bRestartPending = false;
+		bool bStopPending = false;
+		bool bSoundPlaying = false;
+		bool bPaused = false;
+		bool bVirtual = false;
+		bool bReleased = false;
+	};
+
+	struct BusObject
+	{
+		std::string path;
+		uint64_t bank = 0;
+		uint64_t channelGroup = 0;
+		int lockCount = 0;
+		float volume = 1.0f;
+		bool bMute = false;
+		bool bPaused = false;
+	};
+
+	struct VCAObject
+	{
+		std::string path;
+		uint64_t bank = 0;
+		float volume = 1.0f;
+	};
+
+	struct CommandReplayObject
+	{
+		std::string filePath;
+		std::string bankPath;
+		std::vector<float> commandTimes; // Seconds since the capture started
+		FMOD_STUDIO_COMMANDREPLAY_FLAGS flags = FMOD_STUDIO_COMMANDREPLAY_NORMAL;
+		FMOD_STUDIO_PLAYBACK_STATE state = FMOD_STUDIO_PLAYBACK_STOPPED;
+		FMOD_STUDIO_COMMANDREPLAY_FRAME_CALLBACK frameCallback = nullptr;
+		void* userData = nullptr;
+		uint64_t startClock = 0;
+		int currentCommand = 0;
+		float currentTime = 0;
+	};
+
+	struct FileSystemCallbacks
+	{
+		FMOD_FILE_OPEN_CALLBACK open = nullptr;
+		FMOD_FILE_CLOSE_CALLBACK close = nullptr;
+		FMOD_FILE_READ_CALLBACK read = nullptr;
+	};
+
+	/** Everything behind the API, one Studio System (and its Core System) at a time */
+	struct State
+	{
+		std::recursive_mutex mutex;
+
+		// Debug, kept across systems like the real Debug_Initialize
+		FMOD_DEBUG_FLAGS debugFlags = FMOD_DEBUG_LEVEL_NONE;
+		FMOD_DEBUG_CALLBACK debugCallback = nullptr;
+
+		// Core
+		uint64_t coreSystem = 0;
+		uint32_t systemGeneration = 0;
+		bool bCoreInitialized = false;
+		FMOD_OUTPUTTYPE outputType = FMOD_OUTPUTTYPE_AUTODETECT;
+		FMOD_SPEAKERMODE speakerMode = FMOD_SPEAKERMODE_STEREO;
+		int sampleRate = 48000;
+		unsigned int dspBufferLength = 1024;
+		int dspBufferCount = 4;
+		int softwareChannels = 64;
+		FMOD_SYSTEM_CALLBACK coreCallback = nullptr;
+		FMOD_SYSTEM_CALLBACK_TYPE coreCallbackMask = 0;
+		void* coreUserData = nullptr;
+		FileSystemCallbacks fileSystem;
+		std::string pluginPath;
+		std::vector<std::string> plugins; // Handle is the index + 1, empty once unloaded
+		uint64_t masterChannelGroup = 0;
+		uint64_t mixerClock = 0;
+		int64_t maxTrackedBytes = 0;
+
+		// Studio
+		uint64_t studioSystem = 0;
+		bool bStudioInitialized = false;
+		FMOD_STUDIO_ADVANCEDSETTINGS studioAdvancedSettings = {};
+		FMOD_STUDIO_SYSTEM_CALLBACK studioCallback = nullptr;
+		FMOD_STUDIO_SYSTEM_CALLBACK_TYPE studioCallbackMask = 0;
+		void* studioUserData = nullptr;
+		std::ofstream captureFile;
+		bool bCaptureFlush = false;
+		uint64_t captureStartClock = 0;
+		int commandsSinceUpdate = 0; // Queued commands, the command queue usage
+		int peakCommandsPerUpdate = 0;
+		int commandQueueStalls = 0;
+		int peakHandleBytes = 0;
+		unsigned int handleCapacity = 0; // Grows like the real handle table, every growth counts as a stall
+		int handleStalls = 0;
+		std::unordered_map<std::string, uint64_t> eventsByPath;
+		std::unordered_map<std::string, uint64_t> busesByPath;
+		std::unordered_map<std::string, uint64_t> vcasByPath;
+		std::set<std::string> internedStrings; // Returned as const char*, stable until release
+
+		HandlePool<ChannelGroupObject, HandleType::ChannelGroup> channelGroups;
+		HandlePool<DSPObject, HandleType::DSP> dsps;
+		HandlePool<SoundObject, HandleType::Sound> sounds;
+		HandlePool<BankObject, HandleType::Bank> banks;
+		HandlePool<EventDescriptionObject, HandleType::EventDescription> eventDescriptions;
+		HandlePool<EventInstanceObject, HandleType::EventInstance> eventInstances;
+		HandlePool<BusObject, HandleType::Bus> buses;
+		HandlePool<VCAObject, HandleType::VCA> vcas;
+		HandlePool<CommandReplayObject, HandleType::CommandReplay> commandReplays;
+	};
+
+	State& GetState();
+	std::unique_lock<std::recursive_mutex> Lock();
+
+	/** Passes errors to the Core System error callback, like the real API. Returns the result. */
+	FMOD_RESULT Report(FMOD_RESULT result, FMOD_ERRORCALLBACK_INSTANCETYPE instanceType, const void* instance,
+		const char* functionName, const std::string& functionParams = "");
+	void Log(FMOD_DEBUG_FLAGS level, const char* function, const std::string& message);
+
+	/** Copies into a user buffer with the real API's truncation rules (retrieved counts the terminator) */
+	FMOD_RESULT CopyString(const std::string& value, char* outBuffer, int bufferSize, int* outRetrieved);
+
+	// Core objects the Studio side drives
+	uint64_t CreateChannelGroup(State& state, const std::string& name, uint64_t parent, int numChannels);
+	void ReleaseChannelGroup(State& state, uint64_t channelGroup);
+	void AdvanceMixer(State& state);
+	int64_t GetTrackedBytes(State& state);
+	void ResetCore(State& state);
+}
+#endif
@@ -0,0 +1,1880 @@
+#include "fake_state.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <sstream>
+
+using namespace FMOD::Fake;
+
+namespace
+{
+	constexpr auto INSTANCE_STUDIO_SYSTEM = FMOD_ERRORCALLBACK_INSTANCETYPE_STUDIO_SYSTEM;
+	constexpr auto INSTANCE_EVENT_DESCRIPTION = FMOD_ERRORCALLBACK_INSTANCETYPE_STUDIO_EVENTDESCRIPTION;
+	constexpr auto INSTANCE_EVENT_INSTANCE = FMOD_ERRORCALLBACK_INSTANCETYPE_STUDIO_EVENTINSTANCE;
+	constexpr auto INSTANCE_BUS = FMOD_ERRORCALLBACK_INSTANCETYPE_STUDIO_BUS;
+	constexpr auto INSTANCE_VCA = FMOD_ERRORCALLBACK_INSTANCETYPE_STUDIO_VCA;
+	constexpr auto INSTANCE_BANK = FMOD_ERRORCALLBACK_INSTANCETYPE_STUDIO_BANK;
+	constexpr auto INSTANCE_COMMAND_REPLAY = FMOD_ERRORCALLBACK_INSTANCETYPE_STUDIO_COMMANDREPLAY;
+
+	constexpr auto EVENT_PATH_PREFIX = "event:/";
+	constexpr auto BUS_PATH_PREFIX = "bus:/";
+	constexpr auto VCA_PATH_PREFIX = "vca:/";
+	constexpr auto BANK_PATH_PREFIX = "bank:/";
+	constexpr auto STRINGS_BANK_SUFFIX = ".strings.bank";
+	constexpr auto CAPTURE_HEADER = "FMOD fake command capture 1";
+
+	// Real defaults, 0 in the advanced settings selects them
+	constexpr unsigned int DEFAULT_COMMAND_QUEUE_SIZE = 32768;
+	constexpr unsigned int DEFAULT_HANDLE_INITIAL_SIZE = 8192 * sizeof(void*);
+	constexpr int DEFAULT_STUDIO_UPDATE_PERIOD_MS = 20;
+	constexpr int DEFAULT_IDLE_SAMPLE_DATA_POOL_SIZE = 256 * 1024;
+	constexpr unsigned int DEFAULT_STREAMING_SCHEDULE_DELAY = 8192;
+
+	constexpr int COMMAND_BYTES = 32;
+	constexpr int HANDLE_BYTES = 16;
+	constexpr unsigned int FILE_READ_CHUNK_BYTES = 64 * 1024;
+
+	// Every playing instance runs a 4/4 timeline at this tempo for the beat callbacks
+	constexpr int TIMELINE_TEMPO = 120;
+	constexpr int TIMELINE_BEATS_PER_BAR = 4;
+
+	bool IsStudioSystem(const State& state, const void* system)
+	{
+		return state.studioSystem != 0 && ToHandle(system) == state.studioSystem;
+	}
+
+	/** Invalid handle, or a valid system that was not initialized yet */
+	FMOD_RESULT CheckStudioSystem(const State& state, const void* system, const char* function, const bool bNeedsInitialize = true)
+	{
+		if (!IsStudioSystem(state, system)) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_STUDIO_SYSTEM, system, function); }
+		if (bNeedsInitialize && !state.bStudioInitialized) { return Report(FMOD_ERR_STUDIO_UNINITIALIZED, INSTANCE_STUDIO_SYSTEM, system, function); }
+		return FMOD_OK;
+	}
+
+	const char* Intern(State& state, const std::string& value)
+	{
+		return state.internedStrings.insert(value).first->c_str();
+	}
+
+	bool IsPathUnder(const std::string& path, const std::string& prefix, const bool bAllowRoot)
+	{
+		return path.starts_with(prefix) && (bAllowRoot || path.size() > prefix.size());
+	}
+
+	/** Same name, same ID, so IDs looked up once keep working across instances and runs */
+	FMOD_STUDIO_PARAMETER_ID GetParameterID(const char* name)
+	{
+		uint64_t hash = 14695981039346656037ull; // FNV-1a
+		for (const char* character = name; *character != '\0'; ++character)
+		{
+			hash ^= static_cast<unsigned char>(*character);
+			hash *= 1099511628211ull;
+		}
+		return { static_cast<unsigned int>(hash), static_cast<unsigned int>(hash >> 32) };
+	}
+
+	void FillParameterDescription(State& state, const char* name, const bool bGlobal, FMOD_STUDIO_PARAMETER_DESCRIPTION& outDescription)
+	{
+		outDescription = {};
+		outDescription.name = Intern(state, name);
+		outDescription.id = GetParameterID(name);
+		outDescription.minimum = 0.0f;
+		outDescription.maximum = 1.0f;
+		outDescription.defaultvalue = 0.0f;
+		outDescription.type = FMOD_STUDIO_PARAMETER_GAME_CONTROLLED;
+		outDescription.flags = bGlobal ? FMOD_STUDIO_PARAMETER_GLOBAL : 0;
+	}
+
+	void UpdateHandleUsage(State& state)
+	{
+		const size_t handleCount = state.eventDescriptions.GetCount() + state.eventInstances.GetCount()
+			+ state.buses.GetCount() + state.vcas.GetCount() + state.banks.GetCount() + state.commandReplays.GetCount();
+		const int handleBytes = static_cast<int>(handleCount) * HANDLE_BYTES;
+		while (static_cast<unsigned int>(handleBytes) > state.handleCapacity)
+		{
+			state.handleCapacity *= 2;
+			++state.handleStalls;
+		}
+		state.peakHandleBytes = std::max(state.peakHandleBytes, handleBytes);
+	}
+
+	/** Commands run right away, they are only counted for the buffer usage and written to the capture */
+	void QueueCommand(State& state, const char* command, const std::string& argument = "")
+	{
+		if ((state.commandsSinceUpdate + 1) * COMMAND_BYTES > static_cast<int>(state.studioAdvancedSettings.commandqueuesize))
+		{
+			// A full queue makes the real API wait for the update thread to drain it
+			++state.commandQueueStalls;
+			state.commandsSinceUpdate = 0;
+		}
+		++state.commandsSinceUpdate;
+		state.peakCommandsPerUpdate = std::max(state.peakCommandsPerUpdate, state.commandsSinceUpdate);
+
+		if (state.captureFile.is_open())
+		{
+			const double seconds = static_cast<double>(state.mixerClock - state.captureStartClock) / state.sampleRate;
+			state.captureFile << std::fixed << std::setprecision(6) << seconds << ' ' << command;
+			if (!argument.empty()) { state.captureFile << ' ' << argument; }
+			state.captureFile << '\n';
+			if (state.bCaptureFlush) { state.captureFile.flush(); }
+		}
+	}
+
+	void NotifySystem(const State& state, const FMOD_STUDIO_SYSTEM_CALLBACK_TYPE type, void* commandData)
+	{
+		if (state.studioCallback && (state.studioCallbackMask & type) != 0)
+		{
+			state.studioCallback(ToPointer<FMOD_STUDIO_SYSTEM>(state.studioSystem), type, commandData, state.studioUserData);
+		}
+	}
+
+	/** Returns the instance again, or nullptr when the callback destroyed it (e.g. by unloading its bank) */
+	EventInstanceObject* NotifyEvent(State& state, const uint64_t handle, const FMOD_STUDIO_EVENT_CALLBACK_TYPE type,
+		void* parameters = nullptr)
+	{
+		EventInstanceObject* instance = state.eventInstances.Get(ToPointer<void>(handle));
+		if (instance && instance->callback && (instance->callbackMask & type) != 0)
+		{
+			instance->callback(type, ToPointer<FMOD_STUDIO_EVENTINSTANCE>(handle), parameters);
+			instance = state.eventInstances.Get(ToPointer<void>(handle));
+		}
+		return instance;
+	}
+
+	uint64_t FindContentBank(State& state)
+	{
+		for (uint32_t i = 0; i < state.banks.GetSlotCount(); ++i)
+		{
+			if (const BankObject* bank = state.banks.GetAt(i);
+				bank && bank->bHasContent && bank->loadingState == FMOD_STUDIO_LOADING_STATE_LOADED)
+			{
+				return state.banks.GetHandleAt(i);
+			}
+		}
+		return 0;
+	}
+
+	/** The catalog is lazy: a path resolves on first use and belongs to the first loaded bank with content */
+	template <typename TObject, HandleType Type>
+	uint64_t Resolve(State& state, HandlePool<TObject, Type>& pool, std::unordered_map<std::string, uint64_t>& byPath,
+		const std::string& path)
+	{
+		if (const auto it = byPath.find(path); it != byPath.end()) { return it->second; }
+
+		const uint64_t bank = FindContentBank(state);
+		if (bank == 0) { return 0; }
+
+		TObject object;
+		object.path = path;
+		object.bank = bank;
+		const uint64_t handle = pool.Add(std::move(object));
+		byPath.emplace(path, handle);
+		UpdateHandleUsage(state);
+		return handle;
+	}
+
+	template <typename TObject, HandleType Type, typename THandle>
+	FMOD_RESULT GetBankContent(HandlePool<TObject, Type>& pool, const uint64_t bank, THandle** outArray,
+		const int capacity, int* outCount)
+	{
+		int count = 0;
+		for (uint32_t i = 0; i < pool.GetSlotCount(); ++i)
+		{
+			const TObject* object = pool.GetAt(i);
+			if (!object || object->bank != bank) { continue; }
+			if (outArray && count < capacity) { outArray[count] = ToPointer<THandle>(pool.GetHandleAt(i)); }
+			++count;
+		}
+		if (outCount) { *outCount = outArray ? std::min(count, capacity) : count; }
+		return FMOD_OK;
+	}
+
+	void DestroyInstance(State& state, const uint64_t handle)
+	{
+		const EventInstanceObject* instance = state.eventInstances.Get(ToPointer<void>(handle));
+		if (!instance) { return; }
+
+		ReleaseChannelGroup(state, instance->channelGroup);
+		if (EventDescriptionObject* description = state.eventDescriptions.Get(ToPointer<void>(instance->description)))
+		{
+			--description->instanceCount;
+		}
+		state.eventInstances.Remove(ToPointer<void>(handle));
+	}
+
+	void StopInstance(EventInstanceObject& instance, const FMOD_STUDIO_STOP_MODE mode)
+	{
+		if (instance.state == FMOD_STUDIO_PLAYBACK_STARTING)
+		{
+			instance.bStartPending = false;
+			instance.bRestartPending = false;
+			instance.state = FMOD_STUDIO_PLAYBACK_STOPPED;
+			instance.bStopPending = true;
+		}
+		else if (instance.state == FMOD_STUDIO_PLAYBACK_PLAYING || instance.state == FMOD_STUDIO_PLAYBACK_SUSTAINING)
+		{
+			instance.bStartPending = false;
+			instance.bRestartPending = false;
+			instance.state = mode == FMOD_STUDIO_STOP_IMMEDIATE ? FMOD_STUDIO_PLAYBACK_STOPPED : FMOD_STUDIO_PLAYBACK_STOPPING;
+			instance.bStopPending = true;
+		}
+	}
+
+	/** Removes what resolved to the bank, the next lookups resolve to another loaded bank if there is one */
+	void RemoveBankContent(State& state, const uint64_t bank)
+	{
+		for (uint32_t i = 0; i < state.eventInstances.GetSlotCount(); ++i)
+		{
+			const EventInstanceObject* instance = state.eventInstances.GetAt(i);
+			const EventDescriptionObject* description = instance ? state.eventDescriptions.Get(ToPointer<void>(instance->description)) : nullptr;
+			if (description && description->bank == bank) { DestroyInstance(state, state.eventInstances.GetHandleAt(i)); }
+		}
+		for (uint32_t i = 0; i < state.eventDescriptions.GetSlotCount(); ++i)
+		{
+			if (const EventDescriptionObject* description = state.eventDescriptions.GetAt(i); description && description->bank == bank)
+			{
+				state.eventsByPath.erase(description->path);
+				state.eventDescriptions.Remove(ToPointer<void>(state.eventDescriptions.GetHandleAt(i)));
+			}
+		}
+		for (uint32_t i = 0; i < state.buses.GetSlotCount(); ++i)
+		{
+			if (const BusObject* bus = state.buses.GetAt(i); bus && bus->bank == bank)
+			{
+				if (bus->channelGroup != state.masterChannelGroup) { ReleaseChannelGroup(state, bus->channelGroup); }
+				state.busesByPath.erase(bus->path);
+				state.buses.Remove(ToPointer<void>(state.buses.GetHandleAt(i)));
+			}
+		}
+		for (uint32_t i = 0; i < state.vcas.GetSlotCount(); ++i)
+		{
+			if (const VCAObject* vca = state.vcas.GetAt(i); vca && vca->bank == bank)
+			{
+				state.vcasByPath.erase(vca->path);
+				state.vcas.Remove(ToPointer<void>(state.vcas.GetHandleAt(i)));
+			}
+		}
+	}
+
+	/** Reads the whole bank through the Core file system callbacks when set, so file tracing sees the load */
+	FMOD_RESULT ReadBankFile(const State& state, const char* fileName, int64_t& outSizeBytes)
+	{
+		char header[12] = {};
+		if (state.fileSystem.open && state.fileSystem.read)
+		{
+			unsigned int fileSize = 0;
+			void* handle = nullptr;
+			if (const FMOD_RESULT result = state.fileSystem.open(fileName, &fileSize, &handle, nullptr); result != FMOD_OK) { return result; }
+
+			std::vector<char> buffer(FILE_READ_CHUNK_BYTES);
+			FMOD_RESULT result = FMOD_OK;
+			int64_t totalBytes = 0;
+			while (totalBytes < fileSize && result == FMOD_OK)
+			{
+				unsigned int bytesRead = 0;
+				const auto chunkBytes = static_cast<unsigned int>(std::min<int64_t>(FILE_READ_CHUNK_BYTES, fileSize - totalBytes));
+				result = state.fileSystem.read(handle, buffer.data(), chunkBytes, &bytesRead, nullptr);
+				if (totalBytes == 0) { std::memcpy(header, buffer.data(), std::min<size_t>(bytesRead, sizeof(header))); }
+				totalBytes += bytesRead;
+				if (bytesRead == 0) { break; }
+			}
+			if (state.fileSystem.close) { state.fileSystem.close(handle, nullptr); }
+			if (result != FMOD_OK && result != FMOD_ERR_FILE_EOF) { return result; }
+			outSizeBytes = totalBytes;
+		}
+		else
+		{
+			std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+			if (!file.is_open()) { return FMOD_ERR_FILE_NOTFOUND; }
+			outSizeBytes = static_cast<int64_t>(file.tellg());
+			file.seekg(0);
+			file.read(header, sizeof(header));
+		}
+
+		// Studio banks are RIFF files with the FEV form type
+		return std::memcmp(header, "RIFF", 4) == 0 && std::memcmp(header + 8, "FEV ", 4) == 0 ? FMOD_OK : FMOD_ERR_FORMAT;
+	}
+
+	EventInstanceObject* AdvanceTimeline(State& state, const uint64_t handle, EventInstanceObject* instance)
+	{
+		const uint64_t fromSamples = instance->timelineSamples;
+		const uint64_t toSamples = fromSamples + state.dspBufferLength;
+		instance->timelineSamples = toSamples;
+		if (!instance->callback || (instance->callbackMask & FMOD_STUDIO_EVENT_CALLBACK_TIMELINE_BEAT) == 0) { return instance; }
+
+		const uint64_t beatSamples = static_cast<uint64_t>(state.sampleRate) * 60 / TIMELINE_TEMPO;
+		for (uint64_t beatIndex = (fromSamples + beatSamples - 1) / beatSamples; beatIndex * beatSamples < toSamples; ++beatIndex)
+		{
+			FMOD_STUDIO_TIMELINE_BEAT_PROPERTIES beat = {};
+			beat.bar = static_cast<int>(beatIndex / TIMELINE_BEATS_PER_BAR) + 1;
+			beat.beat = static_cast<int>(beatIndex % TIMELINE_BEATS_PER_BAR) + 1;
+			beat.position = static_cast<int>(beatIndex * beatSamples * 1000 / static_cast<uint64_t>(state.sampleRate));
+			beat.tempo = static_cast<float>(TIMELINE_TEMPO);
+			beat.timesignatureupper = TIMELINE_BEATS_PER_BAR;
+			beat.timesignaturelower = 4;
+			instance = NotifyEvent(state, handle, FMOD_STUDIO_EVENT_CALLBACK_TIMELINE_BEAT, &beat);
+			if (!instance) { return nullptr; }
+		}
+		return instance;
+	}
+
+	/*
+	 * One update of the instance lifecycle, the same callback order as the real API:
+	 * CREATED on the first update, STARTING STARTED SOUND_PLAYED after start (RESTARTED when already playing),
+	 * TIMELINE_BEAT while playing, SOUND_STOPPED STOPPED after stop, DESTROYED once released and stopped.
+	 */
+	void UpdateInstance(State& state, const uint64_t handle, const bool bMasterPaused)
+	{
+		EventInstanceObject* instance = state.eventInstances.Get(ToPointer<void>(handle));
+		if (!instance->bCreatedNotified)
+		{
+			instance->bCreatedNotified = true;
+			if (!(instance = NotifyEvent(state, handle, FMOD_STUDIO_EVENT_CALLBACK_CREATED))) { return; }
+		}
+
+		if (instance->bStartPending)
+		{
+			instance->bStartPending = false;
+			instance->state = FMOD_STUDIO_PLAYBACK_PLAYING;
+			instance->timelineSamples = 0;
+			if (instance->channelGroup == 0)
+			{
+				const EventDescriptionObject* description = state.eventDescriptions.Get(ToPointer<void>(instance->description));
+				instance->channelGroup = CreateChannelGroup(state, description ? description->path : "", state.masterChannelGroup, 1);
+			}
+
+			if (instance->bRestartPending)
+			{
+				instance->bRestartPending = false;
+				if (!(instance = NotifyEvent(state, handle, FMOD_STUDIO_EVENT_CALLBACK_RESTARTED))) { return; }
+			}
+			else
+			{
+				if (!(instance = NotifyEvent(state, handle, FMOD_STUDIO_EVENT_CALLBACK_STARTING))) { return; }
+				if (!(instance = NotifyEvent(state, handle, FMOD_STUDIO_EVENT_CALLBACK_STARTED))) { return; }
+				if (!instance->bSoundPlaying)
+				{
+					instance->bSoundPlaying = true;
+					if (!(instance = NotifyEvent(state, handle, FMOD_STUDIO_EVENT_CALLBACK_SOUND_PLAYED))) { return; }
+				}
+			}
+		}
+		else if (instance->state == FMOD_STUDIO_PLAYBACK_PLAYING && !instance->bPaused && !bMasterPaused)
+		{
+			if (!(instance = AdvanceTimeline(state, handle, instance))) { return; }
+		}
+
+		if (instance->bStopPending)
+		{
+			instance->bStopPending = false;
+			instance->state = FMOD_STUDIO_PLAYBACK_STOPPED;
+			instance->bVirtual = false;
+			ReleaseChannelGroup(state, instance->channelGroup);
+			instance->channelGroup = 0;
+			if (instance->bSoundPlaying)
+			{
+				instance->bSoundPlaying = false;
+				if (!(instance = NotifyEvent(state, handle, FMOD_STUDIO_EVENT_CALLBACK_SOUND_STOPPED))) { return; }
+			}
+			if (!(instance = NotifyEvent(state, handle, FMOD_STUDIO_EVENT_CALLBACK_STOPPED))) { return; }
+		}
+
+		if (instance->bReleased && instance->state == FMOD_STUDIO_PLAYBACK_STOPPED && !instance->bStartPending)
+		{
+			NotifyEvent(state, handle, FMOD_STUDIO_EVENT_CALLBACK_DESTROYED);
+			DestroyInstance(state, handle);
+		}
+	}
+
+	/** Playing instances beyond the software channel count are virtual, in handle slot order */
+	void UpdateVirtualization(State& state)
+	{
+		int realCount = 0;
+		for (uint32_t i = 0; i < state.eventInstances.GetSlotCount(); ++i)
+		{
+			EventInstanceObject* instance = state.eventInstances.GetAt(i);
+			if (!instance || instance->channelGroup == 0) { continue; }
+
+			const bool bVirtual = realCount >= state.softwareChannels;
+			if (!bVirtual) { ++realCount; }
+			if (bVirtual == instance->bVirtual) { continue; }
+
+			instance->bVirtual = bVirtual;
+			if (ChannelGroupObject* channelGroup = state.channelGroups.Get(ToPointer<void>(instance->channelGroup)))
+			{
+				channelGroup->numChannels = bVirtual ? 0 : 1;
+			}
+			NotifyEvent(state, state.eventInstances.GetHandleAt(i),
+				bVirtual ? FMOD_STUDIO_EVENT_CALLBACK_REAL_TO_VIRTUAL : FMOD_STUDIO_EVENT_CALLBACK_VIRTUAL_TO_REAL);
+		}
+	}
+
+	void UpdateCommandReplays(State& state)
+	{
+		for (uint32_t i = 0; i < state.commandReplays.GetSlotCount(); ++i)
+		{
+			CommandReplayObject* replay = state.commandReplays.GetAt(i);
+			if (!replay || replay->state != FMOD_STUDIO_PLAYBACK_PLAYING) { continue; }
+
+			const float lengthSeconds = replay->commandTimes.empty() ? 0.0f : replay->commandTimes.back();
+			const bool bFastForward = (replay->flags & FMOD_STUDIO_COMMANDREPLAY_FAST_FORWARD) != 0;
+			const float elapsedSeconds = bFastForward ? lengthSeconds
+				: static_cast<float>(static_cast<double>(state.mixerClock - replay->startClock) / state.sampleRate);
+
+			const int commandCount = static_cast<int>(replay->commandTimes.size());
+			while (replay->currentCommand < commandCount && replay->commandTimes[replay->currentCommand] <= elapsedSeconds)
+			{
+				++replay->currentCommand;
+			}
+			replay->currentTime = std::min(elapsedSeconds, lengthSeconds);
+
+			const uint64_t handle = state.commandReplays.GetHandleAt(i);
+			if (replay->frameCallback)
+			{
+				replay->frameCallback(ToPointer<FMOD_STUDIO_COMMANDREPLAY>(handle), replay->currentCommand, replay->currentTime, replay->userData);
+				replay = state.commandReplays.Get(ToPointer<void>(handle));
+			}
+			if (replay && replay->currentCommand >= commandCount) { replay->state = FMOD_STUDIO_PLAYBACK_STOPPED; }
+		}
+	}
+
+	FMOD_RESULT SetInstanceParameter(State& state, const void* handle, const FMOD_STUDIO_PARAMETER_ID id, const float value,
+		const char* function)
+	{
+		EventInstanceObject* instance = state.eventInstances.Get(handle);
+		if (!instance) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_INSTANCE, handle, function); }
+
+		const float clampedValue = std::clamp(value, 0.0f, 1.0f);
+		const auto it = std::find_if(instance->parameters.begin(), instance->parameters.end(),
+			[id](const std::pair<unsigned int, float>& parameter) { return parameter.first == id.data1; });
+		if (it != instance->parameters.end()) { it->second = clampedValue; }
+		else { instance->parameters.emplace_back(id.data1, clampedValue); }
+
+		QueueCommand(state, function);
+		return FMOD_OK;
+	}
+}
+
+// Studio::System
+
+FMOD_RESULT FMOD::Studio::System::create(System** system, const unsigned int headerversion)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!system) { return FMOD_ERR_INVALID_PARAM; }
+	*system = nullptr;
+	if (headerversion != FMOD_VERSION) { return FMOD_ERR_HEADER_MISMATCH; }
+	if (state.studioSystem != 0) { return FMOD_ERR_UNSUPPORTED; } // One system at a time
+
+	++state.systemGeneration;
+	state.studioSystem = MakeHandle(HandleType::StudioSystem, state.systemGeneration, 0);
+	state.coreSystem = MakeHandle(HandleType::CoreSystem, state.systemGeneration, 0);
+	state.studioAdvancedSettings = {};
+	state.studioAdvancedSettings.cbsize = sizeof(FMOD_STUDIO_ADVANCEDSETTINGS);
+	state.studioAdvancedSettings.commandqueuesize = DEFAULT_COMMAND_QUEUE_SIZE;
+	state.studioAdvancedSettings.handleinitialsize = DEFAULT_HANDLE_INITIAL_SIZE;
+	state.studioAdvancedSettings.studioupdateperiod = DEFAULT_STUDIO_UPDATE_PERIOD_MS;
+	state.studioAdvancedSettings.idlesampledatapoolsize = DEFAULT_IDLE_SAMPLE_DATA_POOL_SIZE;
+	state.studioAdvancedSettings.streamingscheduledelay = DEFAULT_STREAMING_SCHEDULE_DELAY;
+	*system = ToPointer<System>(state.studioSystem);
+	return FMOD_OK;
+}
+
+bool FMOD::Studio::System::isValid() const
+{
+	const auto lock = Lock();
+	return IsStudioSystem(GetState(), this);
+}
+
+FMOD_RESULT FMOD::Studio::System::setAdvancedSettings(FMOD_STUDIO_ADVANCEDSETTINGS* settings)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::setAdvancedSettings", false); result != FMOD_OK) { return result; }
+	if (state.bStudioInitialized) { return Report(FMOD_ERR_INITIALIZED, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::setAdvancedSettings"); }
+	if (!settings || settings->cbsize != sizeof(FMOD_STUDIO_ADVANCEDSETTINGS))
+	{
+		return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::setAdvancedSettings");
+	}
+
+	FMOD_STUDIO_ADVANCEDSETTINGS& current = state.studioAdvancedSettings;
+	current.commandqueuesize = settings->commandqueuesize != 0 ? settings->commandqueuesize : DEFAULT_COMMAND_QUEUE_SIZE;
+	current.handleinitialsize = settings->handleinitialsize != 0 ? settings->handleinitialsize : DEFAULT_HANDLE_INITIAL_SIZE;
+	current.studioupdateperiod = settings->studioupdateperiod > 0 ? settings->studioupdateperiod : DEFAULT_STUDIO_UPDATE_PERIOD_MS;
+	current.idlesampledatapoolsize = settings->idlesampledatapoolsize != 0 ? settings->idlesampledatapoolsize : DEFAULT_IDLE_SAMPLE_DATA_POOL_SIZE;
+	current.streamingscheduledelay = settings->streamingscheduledelay != 0 ? settings->streamingscheduledelay : DEFAULT_STREAMING_SCHEDULE_DELAY;
+	current.encryptionkey = nullptr; // Banks are never decrypted
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::getAdvancedSettings(FMOD_STUDIO_ADVANCEDSETTINGS* settings)
+{
+	const auto lock = Lock();
+	const State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::getAdvancedSettings", false); result != FMOD_OK) { return result; }
+	if (!settings || settings->cbsize != sizeof(FMOD_STUDIO_ADVANCEDSETTINGS))
+	{
+		return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::getAdvancedSettings");
+	}
+
+	*settings = state.studioAdvancedSettings;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::initialize(const int maxchannels, FMOD_STUDIO_INITFLAGS, FMOD_INITFLAGS, void*)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::initialize", false); result != FMOD_OK) { return result; }
+	if (state.bStudioInitialized) { return Report(FMOD_ERR_INITIALIZED, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::initialize"); }
+	if (maxchannels <= 0) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::initialize"); }
+
+	state.bCoreInitialized = true;
+	state.bStudioInitialized = true;
+	state.masterChannelGroup = CreateChannelGroup(state, "Master", 0, 0);
+	state.handleCapacity = state.studioAdvancedSettings.handleinitialsize;
+	state.maxTrackedBytes = GetTrackedBytes(state);
+
+	Log(FMOD_DEBUG_LEVEL_LOG, "Studio::System::initialize", "Fake FMOD backend initialized, nothing is mixed or played");
+	if (state.outputType == FMOD_OUTPUTTYPE_WAVWRITER || state.outputType == FMOD_OUTPUTTYPE_WAVWRITER_NRT)
+	{
+		Log(FMOD_DEBUG_LEVEL_WARNING, "Studio::System::initialize", "Fake FMOD backend does not write WavWriter output");
+	}
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::release()
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::release", false); result != FMOD_OK) { return result; }
+
+	// Handles of everything released become invalid, no callbacks are called
+	if (state.captureFile.is_open()) { state.captureFile.close(); }
+	state.commandReplays.Clear();
+	state.eventInstances.Clear();
+	state.eventDescriptions.Clear();
+	state.buses.Clear();
+	state.vcas.Clear();
+	state.banks.Clear();
+	state.eventsByPath.clear();
+	state.busesByPath.clear();
+	state.vcasByPath.clear();
+	state.internedStrings.clear();
+	state.studioSystem = 0;
+	state.bStudioInitialized = false;
+	state.studioCallback = nullptr;
+	state.studioCallbackMask = 0;
+	state.studioUserData = nullptr;
+	state.commandsSinceUpdate = 0;
+	state.peakCommandsPerUpdate = 0;
+	state.commandQueueStalls = 0;
+	state.peakHandleBytes = 0;
+	state.handleStalls = 0;
+	ResetCore(state);
+	state.maxTrackedBytes = 0;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::update()
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::update"); result != FMOD_OK) { return result; }
+
+	NotifySystem(state, FMOD_STUDIO_SYSTEM_CALLBACK_PREUPDATE, nullptr);
+
+	for (uint32_t i = 0; i < state.banks.GetSlotCount(); ++i)
+	{
+		if (BankObject* bank = state.banks.GetAt(i); bank && bank->loadingState == FMOD_STUDIO_LOADING_STATE_LOADING)
+		{
+			bank->loadingState = FMOD_STUDIO_LOADING_STATE_LOADED;
+		}
+	}
+
+	const auto masterBus = state.busesByPath.find(BUS_PATH_PREFIX);
+	const BusObject* masterBusObject = masterBus != state.busesByPath.end() ? state.buses.Get(ToPointer<void>(masterBus->second)) : nullptr;
+	const bool bMasterPaused = masterBusObject && masterBusObject->bPaused;
+
+	// Instances created by callbacks during this update start on the next one
+	for (uint32_t i = 0, slotCount = state.eventInstances.GetSlotCount(); i < slotCount; ++i)
+	{
+		if (state.eventInstances.GetAt(i)) { UpdateInstance(state, state.eventInstances.GetHandleAt(i), bMasterPaused); }
+	}
+	UpdateVirtualization(state);
+
+	// Every update mixes one DSP buffer, like NRT output with synchronous updates
+	AdvanceMixer(state);
+	UpdateCommandReplays(state);
+
+	state.commandsSinceUpdate = 0;
+	UpdateHandleUsage(state);
+	GetTrackedBytes(state);
+
+	NotifySystem(state, FMOD_STUDIO_SYSTEM_CALLBACK_POSTUPDATE, nullptr);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::getCoreSystem(FMOD::System** coresystem) const
+{
+	const auto lock = Lock();
+	const State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::getCoreSystem", false); result != FMOD_OK) { return result; }
+	if (!coresystem) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::getCoreSystem"); }
+
+	*coresystem = ToPointer<FMOD::System>(state.coreSystem);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::getEvent(const char* path, EventDescription** event) const
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::getEvent"); result != FMOD_OK) { return result; }
+	if (!path || !event) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::getEvent"); }
+	*event = nullptr;
+
+	const uint64_t handle = IsPathUnder(path, EVENT_PATH_PREFIX, false)
+		? Resolve(state, state.eventDescriptions, state.eventsByPath, path) : 0;
+	if (handle == 0) { return Report(FMOD_ERR_EVENT_NOTFOUND, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::getEvent", path); }
+
+	*event = ToPointer<EventDescription>(handle);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::getBus(const char* path, Bus** bus) const
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::getBus"); result != FMOD_OK) { return result; }
+	if (!path || !bus) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::getBus"); }
+	*bus = nullptr;
+
+	const uint64_t handle = IsPathUnder(path, BUS_PATH_PREFIX, true) ? Resolve(state, state.buses, state.busesByPath, path) : 0;
+	if (handle == 0) { return Report(FMOD_ERR_EVENT_NOTFOUND, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::getBus", path); }
+
+	*bus = ToPointer<Bus>(handle);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::getVCA(const char* path, VCA** vca) const
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::getVCA"); result != FMOD_OK) { return result; }
+	if (!path || !vca) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::getVCA"); }
+	*vca = nullptr;
+
+	const uint64_t handle = IsPathUnder(path, VCA_PATH_PREFIX, false) ? Resolve(state, state.vcas, state.vcasByPath, path) : 0;
+	if (handle == 0) { return Report(FMOD_ERR_EVENT_NOTFOUND, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::getVCA", path); }
+
+	*vca = ToPointer<VCA>(handle);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::getBank(const char* path, Bank** bank) const
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::getBank"); result != FMOD_OK) { return result; }
+	if (!path || !bank) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::getBank"); }
+	*bank = nullptr;
+
+	for (uint32_t i = 0; i < state.banks.GetSlotCount(); ++i)
+	{
+		if (const BankObject* bankObject = state.banks.GetAt(i); bankObject && (bankObject->path == path || bankObject->filePath == path))
+		{
+			*bank = ToPointer<Bank>(state.banks.GetHandleAt(i));
+			return FMOD_OK;
+		}
+	}
+	return Report(FMOD_ERR_EVENT_NOTFOUND, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::getBank", path);
+}
+
+FMOD_RESULT FMOD::Studio::System::getSoundInfo(const char* key, FMOD_STUDIO_SOUND_INFO* info) const
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::getSoundInfo"); result != FMOD_OK) { return result; }
+	if (!key || !info) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::getSoundInfo"); }
+
+	// Any key is in the audio tables of a loaded bank, the key itself stands for the sound
+	if (FindContentBank(state) == 0) { return Report(FMOD_ERR_EVENT_NOTFOUND, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::getSoundInfo", key); }
+
+	*info = {};
+	info->name_or_data = Intern(state, key);
+	info->mode = FMOD_LOOP_OFF | FMOD_CREATESTREAM | FMOD_NONBLOCKING;
+	info->exinfo.cbsize = sizeof(FMOD_CREATESOUNDEXINFO);
+	info->subsoundindex = -1;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::getParameterDescriptionByName(const char* name, FMOD_STUDIO_PARAMETER_DESCRIPTION* parameter) const
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::getParameterDescriptionByName"); result != FMOD_OK) { return result; }
+	if (!name || !parameter) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::getParameterDescriptionByName"); }
+
+	FillParameterDescription(state, name, true, *parameter);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::setParameterByID(const FMOD_STUDIO_PARAMETER_ID, const float, bool)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::setParameterByID"); result != FMOD_OK) { return result; }
+
+	QueueCommand(state, "Studio::System::setParameterByID");
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::setParameterByName(const char* name, const float, bool)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::setParameterByName"); result != FMOD_OK) { return result; }
+	if (!name) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::setParameterByName"); }
+
+	QueueCommand(state, "Studio::System::setParameterByName", name);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::setParameterByNameWithLabel(const char* name, const char* label, bool)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::setParameterByNameWithLabel"); result != FMOD_OK) { return result; }
+	if (!name || !label) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::setParameterByNameWithLabel"); }
+
+	QueueCommand(state, "Studio::System::setParameterByNameWithLabel", name);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::flushCommands()
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::flushCommands"); result != FMOD_OK) { return result; }
+
+	for (uint32_t i = 0; i < state.banks.GetSlotCount(); ++i)
+	{
+		if (BankObject* bank = state.banks.GetAt(i); bank && bank->loadingState == FMOD_STUDIO_LOADING_STATE_LOADING)
+		{
+			bank->loadingState = FMOD_STUDIO_LOADING_STATE_LOADED;
+		}
+	}
+	state.commandsSinceUpdate = 0;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::flushSampleLoading()
+{
+	const auto lock = Lock();
+	return CheckStudioSystem(GetState(), this, "Studio::System::flushSampleLoading");
+}
+
+FMOD_RESULT FMOD::Studio::System::startCommandCapture(const char* filename, const FMOD_STUDIO_COMMANDCAPTURE_FLAGS flags)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::startCommandCapture"); result != FMOD_OK) { return result; }
+	if (!filename) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::startCommandCapture"); }
+	if (state.captureFile.is_open()) { return Report(FMOD_ERR_BADCOMMAND, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::startCommandCapture", filename); }
+
+	// One line per command: seconds since the capture started, the command and its main argument
+	state.captureFile.open(filename, std::ios::trunc);
+	if (!state.captureFile.is_open()) { return Report(FMOD_ERR_FILE_BAD, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::startCommandCapture", filename); }
+
+	state.captureFile << CAPTURE_HEADER << '\n';
+	state.bCaptureFlush = (flags & FMOD_STUDIO_COMMANDCAPTURE_FILEFLUSH) != 0;
+	state.captureStartClock = state.mixerClock;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::stopCommandCapture()
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::stopCommandCapture"); result != FMOD_OK) { return result; }
+
+	if (state.captureFile.is_open()) { state.captureFile.close(); }
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::loadCommandReplay(const char* filename, const FMOD_STUDIO_COMMANDREPLAY_FLAGS flags,
+	CommandReplay** replay)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::loadCommandReplay"); result != FMOD_OK) { return result; }
+	if (!filename || !replay) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::loadCommandReplay"); }
+	*replay = nullptr;
+
+	std::ifstream file(filename);
+	if (!file.is_open()) { return Report(FMOD_ERR_FILE_NOTFOUND, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::loadCommandReplay", filename); }
+
+	// Only captures of the fake can be replayed, their commands are timed but not executed again
+	std::string line;
+	if (!std::getline(file, line) || line != CAPTURE_HEADER)
+	{
+		return Report(FMOD_ERR_FORMAT, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::loadCommandReplay", filename);
+	}
+
+	CommandReplayObject replayObject;
+	replayObject.filePath = filename;
+	replayObject.flags = flags;
+	while (std::getline(file, line))
+	{
+		float seconds = 0;
+		if (std::istringstream(line) >> seconds) { replayObject.commandTimes.push_back(seconds); }
+	}
+
+	*replay = ToPointer<CommandReplay>(state.commandReplays.Add(std::move(replayObject)));
+	UpdateHandleUsage(state);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::loadBankFile(const char* filename, const FMOD_STUDIO_LOAD_BANK_FLAGS flags, Bank** bank)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::loadBankFile"); result != FMOD_OK) { return result; }
+	if (!filename || !bank) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::loadBankFile"); }
+	*bank = nullptr;
+
+	for (uint32_t i = 0; i < state.banks.GetSlotCount(); ++i)
+	{
+		if (const BankObject* bankObject = state.banks.GetAt(i); bankObject && bankObject->filePath == filename)
+		{
+			*bank = ToPointer<Bank>(state.banks.GetHandleAt(i));
+			return Report(FMOD_ERR_EVENT_ALREADY_LOADED, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::loadBankFile", filename);
+		}
+	}
+
+	BankObject bankObject;
+	if (const FMOD_RESULT result = ReadBankFile(state, filename, bankObject.sizeBytes); result != FMOD_OK)
+	{
+		return Report(result, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::loadBankFile", filename);
+	}
+
+	const std::string fileName = std::filesystem::path(filename).filename().string();
+	bankObject.filePath = filename;
+	bankObject.path = BANK_PATH_PREFIX + fileName.substr(0, fileName.size() - (fileName.ends_with(".bank") ? 5 : 0));
+	bankObject.bHasContent = !fileName.ends_with(STRINGS_BANK_SUFFIX);
+	bankObject.loadingState = (flags & FMOD_STUDIO_LOAD_BANK_NONBLOCKING) != 0
+		? FMOD_STUDIO_LOADING_STATE_LOADING : FMOD_STUDIO_LOADING_STATE_LOADED;
+
+	*bank = ToPointer<Bank>(state.banks.Add(std::move(bankObject)));
+	QueueCommand(state, "Studio::System::loadBankFile", filename);
+	UpdateHandleUsage(state);
+	GetTrackedBytes(state);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::getBankCount(int* count) const
+{
+	const auto lock = Lock();
+	const State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::getBankCount"); result != FMOD_OK) { return result; }
+	if (!count) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::getBankCount"); }
+
+	*count = static_cast<int>(state.banks.GetCount());
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::getBankList(Bank** array, const int capacity, int* count) const
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::getBankList"); result != FMOD_OK) { return result; }
+	if (!array || capacity < 0) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::getBankList"); }
+
+	int bankCount = 0;
+	for (uint32_t i = 0; i < state.banks.GetSlotCount() && bankCount < capacity; ++i)
+	{
+		if (state.banks.GetAt(i)) { array[bankCount++] = ToPointer<Bank>(state.banks.GetHandleAt(i)); }
+	}
+	if (count) { *count = bankCount; }
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::getCPUUsage(FMOD_STUDIO_CPU_USAGE* usage, FMOD_CPU_USAGE* usage_core) const
+{
+	const auto lock = Lock();
+	if (const FMOD_RESULT result = CheckStudioSystem(GetState(), this, "Studio::System::getCPUUsage"); result != FMOD_OK) { return result; }
+
+	if (usage) { *usage = {}; }
+	if (usage_core) { *usage_core = {}; }
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::getBufferUsage(FMOD_STUDIO_BUFFER_USAGE* usage) const
+{
+	const auto lock = Lock();
+	const State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::getBufferUsage"); result != FMOD_OK) { return result; }
+	if (!usage) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::getBufferUsage"); }
+
+	*usage = {};
+	usage->studiocommandqueue.currentusage = state.commandsSinceUpdate * COMMAND_BYTES;
+	usage->studiocommandqueue.peakusage = state.peakCommandsPerUpdate * COMMAND_BYTES;
+	usage->studiocommandqueue.capacity = static_cast<int>(state.studioAdvancedSettings.commandqueuesize);
+	usage->studiocommandqueue.stallcount = state.commandQueueStalls;
+	const size_t handleCount = state.eventDescriptions.GetCount() + state.eventInstances.GetCount()
+		+ state.buses.GetCount() + state.vcas.GetCount() + state.banks.GetCount() + state.commandReplays.GetCount();
+	usage->studiohandle.currentusage = static_cast<int>(handleCount) * HANDLE_BYTES;
+	usage->studiohandle.peakusage = state.peakHandleBytes;
+	usage->studiohandle.capacity = static_cast<int>(state.handleCapacity);
+	usage->studiohandle.stallcount = state.handleStalls;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::resetBufferUsage()
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::resetBufferUsage"); result != FMOD_OK) { return result; }
+
+	state.peakCommandsPerUpdate = state.commandsSinceUpdate;
+	state.commandQueueStalls = 0;
+	state.peakHandleBytes = 0;
+	state.handleStalls = 0;
+	UpdateHandleUsage(state);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::getMemoryUsage(FMOD_STUDIO_MEMORY_USAGE* memoryusage) const
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::getMemoryUsage"); result != FMOD_OK) { return result; }
+	if (!memoryusage) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::getMemoryUsage"); }
+
+	int64_t sampleDataBytes = 0;
+	for (uint32_t i = 0; i < state.banks.GetSlotCount(); ++i)
+	{
+		if (const BankObject* bank = state.banks.GetAt(i); bank && bank->bSampleDataLoaded) { sampleDataBytes += bank->sizeBytes; }
+	}
+	const auto trackedBytes = static_cast<int>(std::min<int64_t>(GetTrackedBytes(state), INT32_MAX));
+	memoryusage->exclusive = trackedBytes;
+	memoryusage->inclusive = trackedBytes;
+	memoryusage->sampledata = static_cast<int>(std::min<int64_t>(sampleDataBytes, INT32_MAX));
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::setCallback(const FMOD_STUDIO_SYSTEM_CALLBACK callback, const FMOD_STUDIO_SYSTEM_CALLBACK_TYPE callbackmask)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::setCallback", false); result != FMOD_OK) { return result; }
+
+	state.studioCallback = callback;
+	state.studioCallbackMask = callback ? callbackmask : 0;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::setUserData(void* userdata)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::setUserData", false); result != FMOD_OK) { return result; }
+
+	state.studioUserData = userdata;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::System::getUserData(void** userdata) const
+{
+	const auto lock = Lock();
+	const State& state = GetState();
+	if (const FMOD_RESULT result = CheckStudioSystem(state, this, "Studio::System::getUserData", false); result != FMOD_OK) { return result; }
+	if (!userdata) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_STUDIO_SYSTEM, this, "Studio::System::getUserData"); }
+
+	*userdata = state.studioUserData;
+	return FMOD_OK;
+}
+
+// Studio::EventDescription
+
+bool FMOD::Studio::EventDescription::isValid() const
+{
+	const auto lock = Lock();
+	return GetState().eventDescriptions.Get(this) != nullptr;
+}
+
+FMOD_RESULT FMOD::Studio::EventDescription::getPath(char* path, const int size, int* retrieved) const
+{
+	const auto lock = Lock();
+	const EventDescriptionObject* description = GetState().eventDescriptions.Get(this);
+	if (!description) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::getPath"); }
+
+	return CopyString(description->path, path, size, retrieved);
+}
+
+FMOD_RESULT FMOD::Studio::EventDescription::getParameterDescriptionByName(const char* name,
+	FMOD_STUDIO_PARAMETER_DESCRIPTION* parameter) const
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!state.eventDescriptions.Get(this))
+	{
+		return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::getParameterDescriptionByName");
+	}
+	if (!name || !parameter)
+	{
+		return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::getParameterDescriptionByName");
+	}
+
+	FillParameterDescription(state, name, false, *parameter);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventDescription::getLength(int* length) const
+{
+	const auto lock = Lock();
+	if (!GetState().eventDescriptions.Get(this)) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::getLength"); }
+	if (!length) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::getLength"); }
+
+	*length = 0; // Events play until stopped
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventDescription::isOneshot(bool* oneshot) const
+{
+	const auto lock = Lock();
+	if (!GetState().eventDescriptions.Get(this)) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::isOneshot"); }
+	if (!oneshot) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::isOneshot"); }
+
+	*oneshot = false;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventDescription::is3D(bool* is3D) const
+{
+	const auto lock = Lock();
+	if (!GetState().eventDescriptions.Get(this)) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::is3D"); }
+	if (!is3D) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::is3D"); }
+
+	*is3D = false;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventDescription::createInstance(EventInstance** instance) const
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	EventDescriptionObject* description = state.eventDescriptions.Get(this);
+	if (!description) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::createInstance"); }
+	if (!instance) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::createInstance"); }
+
+	EventInstanceObject instanceObject;
+	instanceObject.description = ToHandle(this);
+	++description->instanceCount;
+	description->bSampleDataLoaded = true;
+	QueueCommand(state, "Studio::EventDescription::createInstance", description->path);
+
+	*instance = ToPointer<EventInstance>(state.eventInstances.Add(std::move(instanceObject)));
+	UpdateHandleUsage(state);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventDescription::getInstanceCount(int* count) const
+{
+	const auto lock = Lock();
+	const EventDescriptionObject* description = GetState().eventDescriptions.Get(this);
+	if (!description) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::getInstanceCount"); }
+	if (!count) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::getInstanceCount"); }
+
+	*count = description->instanceCount;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventDescription::releaseAllInstances()
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!state.eventDescriptions.Get(this)) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::releaseAllInstances"); }
+
+	for (uint32_t i = 0; i < state.eventInstances.GetSlotCount(); ++i)
+	{
+		if (EventInstanceObject* instance = state.eventInstances.GetAt(i); instance && instance->description == ToHandle(this))
+		{
+			StopInstance(*instance, FMOD_STUDIO_STOP_IMMEDIATE);
+			instance->bReleased = true;
+		}
+	}
+	QueueCommand(state, "Studio::EventDescription::releaseAllInstances");
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventDescription::loadSampleData()
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	EventDescriptionObject* description = state.eventDescriptions.Get(this);
+	if (!description) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::loadSampleData"); }
+
+	description->bSampleDataLoaded = true;
+	if (BankObject* bank = state.banks.Get(ToPointer<void>(description->bank))) { bank->bSampleDataLoaded = true; }
+	QueueCommand(state, "Studio::EventDescription::loadSampleData", description->path);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventDescription::unloadSampleData()
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	EventDescriptionObject* description = state.eventDescriptions.Get(this);
+	if (!description) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::unloadSampleData"); }
+
+	// The bank keeps its sample data, other events of the bank may still need it
+	description->bSampleDataLoaded = false;
+	QueueCommand(state, "Studio::EventDescription::unloadSampleData", description->path);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventDescription::getSampleLoadingState(FMOD_STUDIO_LOADING_STATE* state) const
+{
+	const auto lock = Lock();
+	State& fakeState = GetState();
+	const EventDescriptionObject* description = fakeState.eventDescriptions.Get(this);
+	if (!description) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::getSampleLoadingState"); }
+	if (!state) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::getSampleLoadingState"); }
+
+	const BankObject* bank = fakeState.banks.Get(ToPointer<void>(description->bank));
+	*state = description->bSampleDataLoaded || (bank && bank->bSampleDataLoaded) ? FMOD_STUDIO_LOADING_STATE_LOADED : FMOD_STUDIO_LOADING_STATE_UNLOADED;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventDescription::setUserData(void* userdata)
+{
+	const auto lock = Lock();
+	EventDescriptionObject* description = GetState().eventDescriptions.Get(this);
+	if (!description) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::setUserData"); }
+
+	description->userData = userdata;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventDescription::getUserData(void** userdata) const
+{
+	const auto lock = Lock();
+	const EventDescriptionObject* description = GetState().eventDescriptions.Get(this);
+	if (!description) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::getUserData"); }
+	if (!userdata) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_EVENT_DESCRIPTION, this, "Studio::EventDescription::getUserData"); }
+
+	*userdata = description->userData;
+	return FMOD_OK;
+}
+
+// Studio::EventInstance
+
+bool FMOD::Studio::EventInstance::isValid() const
+{
+	const auto lock = Lock();
+	return GetState().eventInstances.Get(this) != nullptr;
+}
+
+FMOD_RESULT FMOD::Studio::EventInstance::getDescription(EventDescription** description) const
+{
+	const auto lock = Lock();
+	const EventInstanceObject* instance = GetState().eventInstances.Get(this);
+	if (!instance) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::getDescription"); }
+	if (!description) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::getDescription"); }
+
+	*description = ToPointer<EventDescription>(instance->description);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventInstance::getSystem(System** system) const
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!state.eventInstances.Get(this)) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::getSystem"); }
+	if (!system) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::getSystem"); }
+
+	*system = ToPointer<System>(state.studioSystem);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventInstance::start()
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	EventInstanceObject* instance = state.eventInstances.Get(this);
+	if (!instance) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::start"); }
+
+	if (instance->state == FMOD_STUDIO_PLAYBACK_PLAYING || instance->state == FMOD_STUDIO_PLAYBACK_SUSTAINING)
+	{
+		instance->bRestartPending = true;
+	}
+	else if (instance->state != FMOD_STUDIO_PLAYBACK_STARTING)
+	{
+		instance->state = FMOD_STUDIO_PLAYBACK_STARTING;
+		instance->bStopPending = false;
+	}
+	instance->bStartPending = true;
+	QueueCommand(state, "Studio::EventInstance::start");
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventInstance::stop(const FMOD_STUDIO_STOP_MODE mode)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	EventInstanceObject* instance = state.eventInstances.Get(this);
+	if (!instance) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::stop"); }
+
+	StopInstance(*instance, mode);
+	QueueCommand(state, "Studio::EventInstance::stop");
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventInstance::getPlaybackState(FMOD_STUDIO_PLAYBACK_STATE* state) const
+{
+	const auto lock = Lock();
+	const EventInstanceObject* instance = GetState().eventInstances.Get(this);
+	if (!instance) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::getPlaybackState"); }
+	if (!state) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::getPlaybackState"); }
+
+	*state = instance->state;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventInstance::setPaused(const bool paused)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	EventInstanceObject* instance = state.eventInstances.Get(this);
+	if (!instance) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::setPaused"); }
+
+	instance->bPaused = paused;
+	QueueCommand(state, "Studio::EventInstance::setPaused");
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventInstance::getPaused(bool* paused) const
+{
+	const auto lock = Lock();
+	const EventInstanceObject* instance = GetState().eventInstances.Get(this);
+	if (!instance) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::getPaused"); }
+	if (!paused) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::getPaused"); }
+
+	*paused = instance->bPaused;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventInstance::isVirtual(bool* virtualstate) const
+{
+	const auto lock = Lock();
+	const EventInstanceObject* instance = GetState().eventInstances.Get(this);
+	if (!instance) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::isVirtual"); }
+	if (!virtualstate) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::isVirtual"); }
+
+	*virtualstate = instance->bVirtual;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventInstance::release()
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	EventInstanceObject* instance = state.eventInstances.Get(this);
+	if (!instance) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::release"); }
+
+	// Destroyed by the update once stopped, the handle stays valid until then
+	instance->bReleased = true;
+	QueueCommand(state, "Studio::EventInstance::release");
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventInstance::set3DAttributes(const FMOD_3D_ATTRIBUTES* attributes)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	EventInstanceObject* instance = state.eventInstances.Get(this);
+	if (!instance) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::set3DAttributes"); }
+	if (!attributes) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::set3DAttributes"); }
+
+	instance->attributes = *attributes;
+	QueueCommand(state, "Studio::EventInstance::set3DAttributes");
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventInstance::setParameterByID(const FMOD_STUDIO_PARAMETER_ID id, const float value, bool)
+{
+	const auto lock = Lock();
+	return SetInstanceParameter(GetState(), this, id, value, "Studio::EventInstance::setParameterByID");
+}
+
+FMOD_RESULT FMOD::Studio::EventInstance::setParameterByName(const char* name, const float value, bool)
+{
+	const auto lock = Lock();
+	if (!name) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::setParameterByName"); }
+	return SetInstanceParameter(GetState(), this, GetParameterID(name), value, "Studio::EventInstance::setParameterByName");
+}
+
+FMOD_RESULT FMOD::Studio::EventInstance::setParameterByNameWithLabel(const char* name, const char* label, bool)
+{
+	const auto lock = Lock();
+	if (!name || !label) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::setParameterByNameWithLabel"); }
+
+	// Labels are not known, every label selects the first value
+	return SetInstanceParameter(GetState(), this, GetParameterID(name), 0.0f, "Studio::EventInstance::setParameterByNameWithLabel");
+}
+
+FMOD_RESULT FMOD::Studio::EventInstance::getChannelGroup(ChannelGroup** group) const
+{
+	const auto lock = Lock();
+	const EventInstanceObject* instance = GetState().eventInstances.Get(this);
+	if (!instance) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::getChannelGroup"); }
+	if (!group) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::getChannelGroup"); }
+	*group = nullptr;
+
+	// Only exists while playing, like the real one before the first update after start
+	if (instance->channelGroup == 0) { return FMOD_ERR_STUDIO_NOT_LOADED; }
+
+	*group = ToPointer<ChannelGroup>(instance->channelGroup);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventInstance::setCallback(const FMOD_STUDIO_EVENT_CALLBACK callback,
+	const FMOD_STUDIO_EVENT_CALLBACK_TYPE callbackmask)
+{
+	const auto lock = Lock();
+	EventInstanceObject* instance = GetState().eventInstances.Get(this);
+	if (!instance) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::setCallback"); }
+
+	instance->callback = callback;
+	instance->callbackMask = callback ? callbackmask : 0;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventInstance::setUserData(void* userdata)
+{
+	const auto lock = Lock();
+	EventInstanceObject* instance = GetState().eventInstances.Get(this);
+	if (!instance) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::setUserData"); }
+
+	instance->userData = userdata;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::EventInstance::getUserData(void** userdata) const
+{
+	const auto lock = Lock();
+	const EventInstanceObject* instance = GetState().eventInstances.Get(this);
+	if (!instance) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::getUserData"); }
+	if (!userdata) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_EVENT_INSTANCE, this, "Studio::EventInstance::getUserData"); }
+
+	*userdata = instance->userData;
+	return FMOD_OK;
+}
+
+// Studio::Bus, every event routes to the master bus (bus:/)
+
+bool FMOD::Studio::Bus::isValid() const
+{
+	const auto lock = Lock();
+	return GetState().buses.Get(this) != nullptr;
+}
+
+FMOD_RESULT FMOD::Studio::Bus::getPath(char* path, const int size, int* retrieved) const
+{
+	const auto lock = Lock();
+	const BusObject* bus = GetState().buses.Get(this);
+	if (!bus) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BUS, this, "Studio::Bus::getPath"); }
+
+	return CopyString(bus->path, path, size, retrieved);
+}
+
+FMOD_RESULT FMOD::Studio::Bus::getVolume(float* volume, float* finalvolume) const
+{
+	const auto lock = Lock();
+	const BusObject* bus = GetState().buses.Get(this);
+	if (!bus) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BUS, this, "Studio::Bus::getVolume"); }
+
+	if (volume) { *volume = bus->volume; }
+	if (finalvolume) { *finalvolume = bus->bMute ? 0.0f : bus->volume; }
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::Bus::setVolume(const float volume)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	BusObject* bus = state.buses.Get(this);
+	if (!bus) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BUS, this, "Studio::Bus::setVolume"); }
+	if (volume < 0.0f || volume != volume) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_BUS, this, "Studio::Bus::setVolume", bus->path); }
+
+	bus->volume = volume;
+	QueueCommand(state, "Studio::Bus::setVolume", bus->path);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::Bus::getPaused(bool* paused) const
+{
+	const auto lock = Lock();
+	const BusObject* bus = GetState().buses.Get(this);
+	if (!bus) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BUS, this, "Studio::Bus::getPaused"); }
+	if (!paused) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_BUS, this, "Studio::Bus::getPaused"); }
+
+	*paused = bus->bPaused;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::Bus::setPaused(const bool paused)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	BusObject* bus = state.buses.Get(this);
+	if (!bus) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BUS, this, "Studio::Bus::setPaused"); }
+
+	bus->bPaused = paused;
+	QueueCommand(state, "Studio::Bus::setPaused", bus->path);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::Bus::getMute(bool* mute) const
+{
+	const auto lock = Lock();
+	const BusObject* bus = GetState().buses.Get(this);
+	if (!bus) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BUS, this, "Studio::Bus::getMute"); }
+	if (!mute) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_BUS, this, "Studio::Bus::getMute"); }
+
+	*mute = bus->bMute;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::Bus::setMute(const bool mute)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	BusObject* bus = state.buses.Get(this);
+	if (!bus) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BUS, this, "Studio::Bus::setMute"); }
+
+	bus->bMute = mute;
+	QueueCommand(state, "Studio::Bus::setMute", bus->path);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::Bus::stopAllEvents(const FMOD_STUDIO_STOP_MODE mode)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	const BusObject* bus = state.buses.Get(this);
+	if (!bus) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BUS, this, "Studio::Bus::stopAllEvents"); }
+
+	if (bus->path == BUS_PATH_PREFIX)
+	{
+		for (uint32_t i = 0; i < state.eventInstances.GetSlotCount(); ++i)
+		{
+			if (EventInstanceObject* instance = state.eventInstances.GetAt(i)) { StopInstance(*instance, mode); }
+		}
+	}
+	QueueCommand(state, "Studio::Bus::stopAllEvents", bus->path);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::Bus::lockChannelGroup()
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	BusObject* bus = state.buses.Get(this);
+	if (!bus) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BUS, this, "Studio::Bus::lockChannelGroup"); }
+
+	if (bus->channelGroup == 0)
+	{
+		bus->channelGroup = bus->path == BUS_PATH_PREFIX ? state.masterChannelGroup
+			: CreateChannelGroup(state, bus->path, state.masterChannelGroup, 0);
+	}
+	++bus->lockCount;
+	QueueCommand(state, "Studio::Bus::lockChannelGroup", bus->path);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::Bus::unlockChannelGroup()
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	BusObject* bus = state.buses.Get(this);
+	if (!bus) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BUS, this, "Studio::Bus::unlockChannelGroup"); }
+	if (bus->lockCount == 0) { return Report(FMOD_ERR_NOT_LOCKED, INSTANCE_BUS, this, "Studio::Bus::unlockChannelGroup", bus->path); }
+
+	if (--bus->lockCount == 0 && bus->path != BUS_PATH_PREFIX)
+	{
+		ReleaseChannelGroup(state, bus->channelGroup);
+		bus->channelGroup = 0;
+	}
+	QueueCommand(state, "Studio::Bus::unlockChannelGroup", bus->path);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::Bus::getChannelGroup(FMOD::ChannelGroup** group) const
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	const BusObject* bus = state.buses.Get(this);
+	if (!bus) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BUS, this, "Studio::Bus::getChannelGroup"); }
+	if (!group) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_BUS, this, "Studio::Bus::getChannelGroup"); }
+	*group = nullptr;
+
+	// The master bus always mixes into the master channel group, other buses need lockChannelGroup
+	const uint64_t channelGroup = bus->path == BUS_PATH_PREFIX ? state.masterChannelGroup : bus->channelGroup;
+	if (channelGroup == 0) { return Report(FMOD_ERR_STUDIO_NOT_LOADED, INSTANCE_BUS, this, "Studio::Bus::getChannelGroup", bus->path); }
+
+	*group = ToPointer<FMOD::ChannelGroup>(channelGroup);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::Bus::getCPUUsage(unsigned int* exclusive, unsigned int* inclusive) const
+{
+	const auto lock = Lock();
+	if (!GetState().buses.Get(this)) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BUS, this, "Studio::Bus::getCPUUsage"); }
+
+	if (exclusive) { *exclusive = 0; }
+	if (inclusive) { *inclusive = 0; }
+	return FMOD_OK;
+}
+
+// Studio::VCA
+
+bool FMOD::Studio::VCA::isValid() const
+{
+	const auto lock = Lock();
+	return GetState().vcas.Get(this) != nullptr;
+}
+
+FMOD_RESULT FMOD::Studio::VCA::getPath(char* path, const int size, int* retrieved) const
+{
+	const auto lock = Lock();
+	const VCAObject* vca = GetState().vcas.Get(this);
+	if (!vca) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_VCA, this, "Studio::VCA::getPath"); }
+
+	return CopyString(vca->path, path, size, retrieved);
+}
+
+FMOD_RESULT FMOD::Studio::VCA::getVolume(float* volume, float* finalvolume) const
+{
+	const auto lock = Lock();
+	const VCAObject* vca = GetState().vcas.Get(this);
+	if (!vca) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_VCA, this, "Studio::VCA::getVolume"); }
+
+	if (volume) { *volume = vca->volume; }
+	if (finalvolume) { *finalvolume = vca->volume; }
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::VCA::setVolume(const float volume)
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	VCAObject* vca = state.vcas.Get(this);
+	if (!vca) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_VCA, this, "Studio::VCA::setVolume"); }
+	if (volume < 0.0f || volume != volume) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_VCA, this, "Studio::VCA::setVolume", vca->path); }
+
+	vca->volume = volume;
+	QueueCommand(state, "Studio::VCA::setVolume", vca->path);
+	return FMOD_OK;
+}
+
+// Studio::Bank
+
+bool FMOD::Studio::Bank::isValid() const
+{
+	const auto lock = Lock();
+	return GetState().banks.Get(this) != nullptr;
+}
+
+FMOD_RESULT FMOD::Studio::Bank::getPath(char* path, const int size, int* retrieved) const
+{
+	const auto lock = Lock();
+	const BankObject* bank = GetState().banks.Get(this);
+	if (!bank) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BANK, this, "Studio::Bank::getPath"); }
+
+	return CopyString(bank->path, path, size, retrieved);
+}
+
+FMOD_RESULT FMOD::Studio::Bank::unload()
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	const BankObject* bank = state.banks.Get(this);
+	if (!bank) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BANK, this, "Studio::Bank::unload"); }
+
+	QueueCommand(state, "Studio::Bank::unload", bank->filePath);
+	RemoveBankContent(state, ToHandle(this));
+	NotifySystem(state, FMOD_STUDIO_SYSTEM_CALLBACK_BANK_UNLOAD, const_cast<Bank*>(this));
+	state.banks.Remove(this);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::Bank::loadSampleData()
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	BankObject* bank = state.banks.Get(this);
+	if (!bank) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BANK, this, "Studio::Bank::loadSampleData"); }
+
+	bank->bSampleDataLoaded = true;
+	QueueCommand(state, "Studio::Bank::loadSampleData", bank->filePath);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::Bank::unloadSampleData()
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	BankObject* bank = state.banks.Get(this);
+	if (!bank) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BANK, this, "Studio::Bank::unloadSampleData"); }
+
+	bank->bSampleDataLoaded = false;
+	QueueCommand(state, "Studio::Bank::unloadSampleData", bank->filePath);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::Bank::getLoadingState(FMOD_STUDIO_LOADING_STATE* state) const
+{
+	const auto lock = Lock();
+	const BankObject* bank = GetState().banks.Get(this);
+	if (!state) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_BANK, this, "Studio::Bank::getLoadingState"); }
+
+	// An unloaded bank reports its state with an invalid handle error, like the real API
+	*state = bank ? bank->loadingState : FMOD_STUDIO_LOADING_STATE_UNLOADED;
+	return bank ? FMOD_OK : FMOD_ERR_INVALID_HANDLE;
+}
+
+FMOD_RESULT FMOD::Studio::Bank::getSampleLoadingState(FMOD_STUDIO_LOADING_STATE* state) const
+{
+	const auto lock = Lock();
+	const BankObject* bank = GetState().banks.Get(this);
+	if (!bank) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BANK, this, "Studio::Bank::getSampleLoadingState"); }
+	if (!state) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_BANK, this, "Studio::Bank::getSampleLoadingState"); }
+
+	*state = bank->bSampleDataLoaded ? FMOD_STUDIO_LOADING_STATE_LOADED : FMOD_STUDIO_LOADING_STATE_UNLOADED;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::Bank::getEventCount(int* count) const
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!state.banks.Get(this)) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BANK, this, "Studio::Bank::getEventCount"); }
+	if (!count) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_BANK, this, "Studio::Bank::getEventCount"); }
+
+	return GetBankContent<EventDescriptionObject, HandleType::EventDescription, EventDescription>(
+		state.eventDescriptions, ToHandle(this), nullptr, 0, count);
+}
+
+FMOD_RESULT FMOD::Studio::Bank::getEventList(EventDescription** array, const int capacity, int* count) const
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!state.banks.Get(this)) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BANK, this, "Studio::Bank::getEventList"); }
+	if (!array || capacity < 0) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_BANK, this, "Studio::Bank::getEventList"); }
+
+	return GetBankContent(state.eventDescriptions, ToHandle(this), array, capacity, count);
+}
+
+FMOD_RESULT FMOD::Studio::Bank::getBusCount(int* count) const
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!state.banks.Get(this)) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BANK, this, "Studio::Bank::getBusCount"); }
+	if (!count) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_BANK, this, "Studio::Bank::getBusCount"); }
+
+	return GetBankContent<BusObject, HandleType::Bus, Bus>(state.buses, ToHandle(this), nullptr, 0, count);
+}
+
+FMOD_RESULT FMOD::Studio::Bank::getBusList(Bus** array, const int capacity, int* count) const
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!state.banks.Get(this)) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BANK, this, "Studio::Bank::getBusList"); }
+	if (!array || capacity < 0) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_BANK, this, "Studio::Bank::getBusList"); }
+
+	return GetBankContent(state.buses, ToHandle(this), array, capacity, count);
+}
+
+FMOD_RESULT FMOD::Studio::Bank::getVCACount(int* count) const
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!state.banks.Get(this)) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BANK, this, "Studio::Bank::getVCACount"); }
+	if (!count) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_BANK, this, "Studio::Bank::getVCACount"); }
+
+	return GetBankContent<VCAObject, HandleType::VCA, VCA>(state.vcas, ToHandle(this), nullptr, 0, count);
+}
+
+FMOD_RESULT FMOD::Studio::Bank::getVCAList(VCA** array, const int capacity, int* count) const
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!state.banks.Get(this)) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BANK, this, "Studio::Bank::getVCAList"); }
+	if (!array || capacity < 0) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_BANK, this, "Studio::Bank::getVCAList"); }
+
+	return GetBankContent(state.vcas, ToHandle(this), array, capacity, count);
+}
+
+FMOD_RESULT FMOD::Studio::Bank::setUserData(void* userdata)
+{
+	const auto lock = Lock();
+	BankObject* bank = GetState().banks.Get(this);
+	if (!bank) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BANK, this, "Studio::Bank::setUserData"); }
+
+	bank->userData = userdata;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::Bank::getUserData(void** userdata) const
+{
+	const auto lock = Lock();
+	const BankObject* bank = GetState().banks.Get(this);
+	if (!bank) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_BANK, this, "Studio::Bank::getUserData"); }
+	if (!userdata) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_BANK, this, "Studio::Bank::getUserData"); }
+
+	*userdata = bank->userData;
+	return FMOD_OK;
+}
+
+// Studio::CommandReplay
+
+bool FMOD::Studio::CommandReplay::isValid() const
+{
+	const auto lock = Lock();
+	return GetState().commandReplays.Get(this) != nullptr;
+}
+
+FMOD_RESULT FMOD::Studio::CommandReplay::getSystem(System** system) const
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!state.commandReplays.Get(this)) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_COMMAND_REPLAY, this, "Studio::CommandReplay::getSystem"); }
+	if (!system) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_COMMAND_REPLAY, this, "Studio::CommandReplay::getSystem"); }
+
+	*system = ToPointer<System>(state.studioSystem);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::CommandReplay::getLength(float* length) const
+{
+	const auto lock = Lock();
+	const CommandReplayObject* replay = GetState().commandReplays.Get(this);
+	if (!replay) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_COMMAND_REPLAY, this, "Studio::CommandReplay::getLength"); }
+	if (!length) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_COMMAND_REPLAY, this, "Studio::CommandReplay::getLength"); }
+
+	*length = replay->commandTimes.empty() ? 0.0f : replay->commandTimes.back();
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::CommandReplay::getCommandCount(int* count) const
+{
+	const auto lock = Lock();
+	const CommandReplayObject* replay = GetState().commandReplays.Get(this);
+	if (!replay) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_COMMAND_REPLAY, this, "Studio::CommandReplay::getCommandCount"); }
+	if (!count) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_COMMAND_REPLAY, this, "Studio::CommandReplay::getCommandCount"); }
+
+	*count = static_cast<int>(replay->commandTimes.size());
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::CommandReplay::getCurrentCommand(int* commandindex, float* currenttime) const
+{
+	const auto lock = Lock();
+	const CommandReplayObject* replay = GetState().commandReplays.Get(this);
+	if (!replay) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_COMMAND_REPLAY, this, "Studio::CommandReplay::getCurrentCommand"); }
+
+	if (commandindex) { *commandindex = replay->currentCommand; }
+	if (currenttime) { *currenttime = replay->currentTime; }
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::CommandReplay::getPlaybackState(FMOD_STUDIO_PLAYBACK_STATE* state) const
+{
+	const auto lock = Lock();
+	const CommandReplayObject* replay = GetState().commandReplays.Get(this);
+	if (!replay) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_COMMAND_REPLAY, this, "Studio::CommandReplay::getPlaybackState"); }
+	if (!state) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_COMMAND_REPLAY, this, "Studio::CommandReplay::getPlaybackState"); }
+
+	*state = replay->state;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::CommandReplay::setBankPath(const char* bankPath)
+{
+	const auto lock = Lock();
+	CommandReplayObject* replay = GetState().commandReplays.Get(this);
+	if (!replay) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_COMMAND_REPLAY, this, "Studio::CommandReplay::setBankPath"); }
+
+	replay->bankPath = bankPath ? bankPath : "";
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::CommandReplay::setFrameCallback(const FMOD_STUDIO_COMMANDREPLAY_FRAME_CALLBACK callback)
+{
+	const auto lock = Lock();
+	CommandReplayObject* replay = GetState().commandReplays.Get(this);
+	if (!replay) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_COMMAND_REPLAY, this, "Studio::CommandReplay::setFrameCallback"); }
+
+	replay->frameCallback = callback;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::CommandReplay::start()
+{
+	const auto lock = Lock();
+	const State& state = GetState();
+	CommandReplayObject* replay = GetState().commandReplays.Get(this);
+	if (!replay) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_COMMAND_REPLAY, this, "Studio::CommandReplay::start"); }
+
+	replay->state = FMOD_STUDIO_PLAYBACK_PLAYING;
+	replay->startClock = state.mixerClock;
+	replay->currentCommand = 0;
+	replay->currentTime = 0;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::CommandReplay::stop()
+{
+	const auto lock = Lock();
+	CommandReplayObject* replay = GetState().commandReplays.Get(this);
+	if (!replay) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_COMMAND_REPLAY, this, "Studio::CommandReplay::stop"); }
+
+	replay->state = FMOD_STUDIO_PLAYBACK_STOPPED;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::CommandReplay::release()
+{
+	const auto lock = Lock();
+	State& state = GetState();
+	if (!state.commandReplays.Get(this)) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_COMMAND_REPLAY, this, "Studio::CommandReplay::release"); }
+
+	state.commandReplays.Remove(this);
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::CommandReplay::setUserData(void* userdata)
+{
+	const auto lock = Lock();
+	CommandReplayObject* replay = GetState().commandReplays.Get(this);
+	if (!replay) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_COMMAND_REPLAY, this, "Studio::CommandReplay::setUserData"); }
+
+	replay->userData = userdata;
+	return FMOD_OK;
+}
+
+FMOD_RESULT FMOD::Studio::CommandReplay::getUserData(void** userdata) const
+{
+	const auto lock = Lock();
+	const CommandReplayObject* replay = GetState().commandReplays.Get(this);
+	if (!replay) { return Report(FMOD_ERR_INVALID_HANDLE, INSTANCE_COMMAND_REPLAY, this, "Studio::CommandReplay::getUserData"); }
+	if (!userdata) { return Report(FMOD_ERR_INVALID_PARAM, INSTANCE_COMMAND_REPLAY, this, "Studio::CommandReplay::getUserData"); }
+
+	*userdata = replay->userData;
+	return FMOD_OK;
+}
@@ -1,16 +1,49 @@
 #include "app.h"
 
+#include "app_clock.h"
 #include "audio/audio_engine.h"
 #include "gui/gui.h"
 #include "media/media_framework.h"
 #include "media/media_framework_data.h"
 #include "pages/page_cover.h"
 #include "pages/page_programmer_sounds.h"
+#include "profiling/allocation_tracker.h"
+#include "profiling/frame_profiler.h"
+#include "profiling/hitch_watchdog.h"
+#include "profiling/lock_profiler.h"
+#include "profiling/metrics_server.h"
+#include "profiling/telemetry_writer.h"
 
 namespace
 {
 	const MediaWindowSettings INIT_WINDOW_SETTINGS{"FMOD is Alive!", 1024, 768, 60};
 
+	constexpr auto SCENARIO_RESULTS_DEFAULT_PATH = "scenario_results.json";
+	// What FMOD_CMAKE_AUTO_EXIT used to do before scenarios
+	constexpr auto SCENARIO_AUTO_EXIT = "wait 10\n";
+	// Any fixed seed makes randomized event modulators render the same on every run
+	constexpr auto DETERMINISTIC_RANDOM_SEED = "1";
+
+	bool IsEnvFlagSet(const char* name)
+	{
+		const char* env = std::getenv(name);
+		if (!env) { return false; }
+
+		const std::string_view envString(TextToLower(env));
+		return envString == "1" || envString == "true";
+	}
+
+	/** Non-realtime output mixes one DSP buffer per AudioEngine::Update, nothing else may change what or when it mixes */
+	void SetDeterministicAudioOverrides(const std::string& outputType)
+	{
+		AudioConfig::SetOverride("System", "OutputType", outputType);
+		AudioConfig::SetOverride("System", "EnableLiveUpdate", "false");
+		AudioConfig::SetOverride("Advanced", "EnableSynchronousUpdate", "true");
+		AudioConfig::SetOverride("Advanced", "EnableAdaptiveUpdate", "false");
+		AudioConfig::SetOverride("Advanced", "RandomSeed", DETERMINISTIC_RANDOM_SEED);
+		AudioConfig::SetOverride("Advanced", "PreloadSampleData", "true");
+	}
+
 	const std::unordered_map<std::string_view, std::function<std::unique_ptr<IPage>()>> pages = {
 		{"Cover", []{ return std::make_unique<PageCover>(); }},
 		{"ProgrammerSounds", []{ return std::make_unique<PageProgrammerSounds>(); }},
@@ -19,7 +52,8 @@ namespace
 
 Application::Application()
 : mIsRunning(false)
-, bIsAutoExitEnabled(false)
+, bScenarioFailed(false)
+, bVirtualClock(false)
 , currentPageName(pages.begin()->first)
 , currentPage(pages.find(currentPageName)->second())
 {
@@ -28,15 +62,28 @@ Application::Application()
 
 void Application::Initialize()
 {
-	if (!(AudioEngine::Initialize() && MediaFramework::Initialize(INIT_WINDOW_SETTINGS)))
+	SetupVirtualClock();
+	SetupBounce();
+
+	MediaWindowSettings windowSettings = INIT_WINDOW_SETTINGS;
+	// Frames are paced by the virtual clock, not by the display, so it runs as fast as it can
+	if (bVirtualClock) { windowSettings.fps = 0; }
+	if (!(AudioEngine::Initialize() && MediaFramework::Initialize(windowSettings)))
 	{
 		assert(!"Failed to initialize application");
 	}
+	AppClock::Initialize(bVirtualClock);
 
 	GUI::Initialize();
+	HitchWatchdog::Initialize();
+	LockProfiler::Initialize();
+	AllocationTracker::Initialize();
+	TelemetryWriter::Initialize();
+	MetricsServer::Initialize();
 	mIsRunning = true;
 
-	SetupAutoExit();
+	SetupScenario();
+	SetupInputSession();
 
 	std::cout << "Game Initialized" << std::endl;
 }
@@ -46,19 +93,40 @@ void Application::Run()
 	Start();
 	while (IsRunning())
 	{
+		HitchWatchdog::Heartbeat(WatchdogChannel::MainLoop);
+		AppClock::Tick();
 		ProcessEvents();
 		Update();
 		Render();
+		FrameProfiler::EndFrame();
+		AllocationTracker::EndFrame();
+		if (mScenarioRunner) { mScenarioRunner->EndFrame(); }
+		TelemetryWriter::Publish();
 	}
 }
 
-void Application::Terminate() const
+int Application::Terminate() const
 {
+	bool bScenarioPassed = !bScenarioFailed;
+	if (mScenarioRunner)
+	{
+		const char* resultsPath = std::getenv("FMOD_CMAKE_SCENARIO_RESULTS");
+		bScenarioPassed = mScenarioRunner->WriteResults(resultsPath ? resultsPath : SCENARIO_RESULTS_DEFAULT_PATH) && bScenarioPassed;
+	}
+
+	if (mInputSession) { mInputSession->Close(); }
+
+	const bool bAllocationTestPassed = AllocationTracker::Terminate();
+	MetricsServer::Terminate();
+	TelemetryWriter::Terminate();
+	HitchWatchdog::Terminate();
 	GUI::Terminate();
 	AudioEngine::Terminate();
+	LockProfiler::Terminate();
 	MediaFramework::Terminate();
 
 	std::cout << "Game destroyed" << std::endl;
+	return bAllocationTestPassed && bScenarioPassed ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
 bool Application::IsRunning() const
@@ -68,17 +136,26 @@ bool Application::IsRunning() const
 
 void Application::Update()
 {
+	WatchdogPhase phase("Application::Update");
 	AudioEngine::Update();
 	HandlePagesPendingDestroy();
-	HandleAutoExit();
 }
 
 void Application::ProcessEvents()
 {
+	WatchdogPhase phase("Application::ProcessEvents");
 	MediaFramework::PollEvents(mInputEventsCurrent);
+	if (mScenarioRunner) { mScenarioRunner->Update(mInputEventsCurrent); }
+	if (mInputSession) { mInputSession->ProcessFrame(mInputEventsCurrent); }
+
 	for (auto& inputEvent : mInputEventsCurrent)
 	{
 		if (std::holds_alternative<QuitRequestedEvent>(inputEvent)) { mIsRunning = false; }
+		if (std::holds_alternative<ToggleCommandCaptureEvent>(inputEvent))
+		{
+			if (AudioEngine::IsCommandCaptureActive()) { AudioEngine::StopCommandCapture(); }
+			else { AudioEngine::StartCommandCapture(); }
+		}
 		if (std::holds_alternative<OpenPageEvent>(inputEvent))
 		{
 			std::string& newPageName = std::get<OpenPageEvent>(inputEvent).page_name;
@@ -88,21 +165,27 @@ void Application::ProcessEvents()
 			}
 		}
 	}
+
+	// Page and GUI widget events from the previous frame's Render, and the scripted or replayed ones
+	currentPage->ConsumeInputEvents(mInputEventsCurrent);
+	GUI::HandleInputEvents(mInputEventsCurrent);
 	mInputEventsCurrent.clear();
 }
 
 void Application::Start() const
 {
 	MediaFramework::Start();
+	AudioEngine::SetActiveOwner(currentPageName);
 	currentPage->Initialize();
 	std::cout << "Game Started" << std::endl;
 }
 
 void Application::Render()
 {
+	WatchdogPhase phase("Application::Render");
 	MediaFramework::RenderClear(DARKGRAY);
 
-	MediaFramework::RenderStage();
+	MediaFramework::RenderStage(mInputEventsCurrent);
 	GUI::RenderStage(mInputEventsCurrent);
 
 	MediaFramework::RenderPresent();
@@ -110,8 +193,11 @@ void Application::Render()
 
 void Application::ChangePage(const std::string_view& pageName)
 {
+	WatchdogPhase phase("Application::ChangePage");
 	if (const auto it = pages.find(pageName); it != pages.end())
 	{
+		AllocationTracker::ResetSteadyState();
+
 		std::unique_ptr newPage = it->second();
 
 		if (currentPage)
@@ -122,6 +208,7 @@ void Application::ChangePage(const std::string_view& pageName)
 
 		if (currentPage = std::move(newPage); currentPage)
 		{
+			AudioEngine::SetActiveOwner(std::string(pageName));
 			currentPage->Initialize();
 			currentPageName = pageName;
 		}
@@ -148,21 +235,69 @@ void Application::HandlePagesPendingDestroy()
 	}
 }
 
-void Application::SetupAutoExit()
+void Application::SetupVirtualClock()
 {
-	if (const char* env = std::getenv("FMOD_CMAKE_AUTO_EXIT"))
+	// FMOD_CMAKE_VIRTUAL_CLOCK=1 mixes without a sound card and times the application with the mixer clock
+	if (!IsEnvFlagSet("FMOD_CMAKE_VIRTUAL_CLOCK")) { return; }
+
+	SetDeterministicAudioOverrides("NoSoundNRT");
+	bVirtualClock = true;
+}
+
+void Application::SetupBounce()
+{
+	// FMOD_CMAKE_BOUNCE=1 renders to [System] WavWriterPath, any other value is the WAV path. Implies the virtual clock.
+	const char* env = std::getenv("FMOD_CMAKE_BOUNCE");
+	if (!env || env[0] == '\0') { return; }
+
+	const std::string_view envString(TextToLower(env));
+	if (envString == "0" || envString == "false") { return; }
+	if (envString != "1" && envString != "true") { AudioConfig::SetOverride("System", "WavWriterPath", env); }
+
+	SetDeterministicAudioOverrides("WavWriterNRT");
+	bVirtualClock = true;
+	std::cout << "Bouncing the audio output to a WAV file" << std::endl;
+}
+
+void Application::SetupScenario()
+{
+	// FMOD_CMAKE_SCENARIO=<script path> runs a script, FMOD_CMAKE_AUTO_EXIT=1 only waits and quits
+	std::unique_ptr<ScenarioRunner> runner = std::make_unique<ScenarioRunner>();
+	if (const char* scenarioPath = std::getenv("FMOD_CMAKE_SCENARIO"))
+	{
+		if (!runner->LoadFile(scenarioPath))
+		{
+			bScenarioFailed = true;
+			mIsRunning = false;
+			return;
+		}
+	}
+	else if (const char* env = std::getenv("FMOD_CMAKE_AUTO_EXIT"))
 	{
 		const std::string_view envString(TextToLower(env));
-		bIsAutoExitEnabled = envString == "1" || envString == "true";
+		if (envString != "1" && envString != "true") { return; }
+		runner->LoadText(SCENARIO_AUTO_EXIT, "auto_exit");
 	}
+	else
+	{
+		return;
+	}
+	mScenarioRunner = std::move(runner);
 }
 
-void Application::HandleAutoExit()
+void Application::SetupInputSession()
 {
-	if (bIsAutoExitEnabled)
+	// FMOD_CMAKE_INPUT_RECORD=<path> records every input event, FMOD_CMAKE_INPUT_REPLAY=<path> replays a recording
+	if (const char* recordPath = std::getenv("FMOD_CMAKE_INPUT_RECORD"))
+	{
+		mInputSession = InputSession::CreateRecorder(recordPath);
+	}
+	else if (const char* replayPath = std::getenv("FMOD_CMAKE_INPUT_REPLAY"))
 	{
-		if (GetTime() > 10)
+		mInputSession = InputSession::CreateReplayer(replayPath);
+		if (!mInputSession)
 		{
+			bScenarioFailed = true;
 			mIsRunning = false;
 		}
 	}
@@ -1,8 +1,11 @@
 #ifndef APP_HPP
 #define APP_HPP
 
+#include "scenario_runner.h"
+
 #include "audio/audio_engine.h"
 #include "input/input_events.h"
+#include "input/input_session.h"
 #include "pages/page.h"
 
 class Application
@@ -12,17 +15,21 @@ class Application
 
 		void Initialize();
 		void Run();
-		void Terminate() const;
+		/** Returns the process exit code */
+		int Terminate() const;
 		[[nodiscard]] bool IsRunning() const;
 
 	private:
 		bool mIsRunning;
-		bool bIsAutoExitEnabled;
+		bool bScenarioFailed;
+		bool bVirtualClock;
 
 		std::string currentPageName;
 		std::shared_ptr<IPage> currentPage;
 		std::vector<std::shared_ptr<IPage>> mPagesPendingDestroy;
 		std::vector<InputEvent> mInputEventsCurrent;
+		std::unique_ptr<ScenarioRunner> mScenarioRunner;
+		std::unique_ptr<InputSession> mInputSession;
 
 		void Update();
 		void ProcessEvents();
@@ -33,7 +40,9 @@ class Application
 		void HandlePagesPendingDestroy();
 
 		// For CI/CD only
-		void SetupAutoExit();
-		void HandleAutoExit();
+		void SetupVirtualClock();
+		void SetupBounce();
+		void SetupScenario();
+		void SetupInputSession();
 };
 #endif
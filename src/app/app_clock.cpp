@@ -0,0 +1,90 @@
+#include "app_clock.h"
+
+#include "audio/audio_engine.h"
+#include "profiling/steady_time.h"
+
+std::unique_ptr<AppClock> AppClock::sInstance(nullptr);
+
+namespace
+{
+	constexpr uint64_t NS_PER_SECOND = 1000000000;
+}
+
+AppClock::AppClock()
+: bVirtual(false)
+, mStartNs(0)
+, mStartSamples(0)
+, mLastSamples(0)
+, mExpectedStepSamples(0)
+, bWarnedUnevenStep(false)
+, mTimeNs(0)
+{}
+
+AppClock& AppClock::Get()
+{
+	if (!sInstance)
+	{
+		sInstance = std::unique_ptr<AppClock>(new AppClock());
+	}
+	return *sInstance;
+}
+
+void AppClock::Initialize(const bool bVirtual)
+{
+	AppClock& clock = Get();
+	clock.bVirtual = bVirtual;
+	clock.mStartNs = GetSteadyTimeNs();
+	clock.mTimeNs = 0;
+	if (!bVirtual) { return; }
+
+	int sampleRate = 0;
+	if (!AudioEngine::GetMixerClock(clock.mStartSamples, sampleRate))
+	{
+		std::cout << "AppClock: the mixer clock is not available, using the real clock" << std::endl;
+		clock.bVirtual = false;
+		return;
+	}
+	clock.mLastSamples = clock.mStartSamples;
+	clock.mExpectedStepSamples = static_cast<uint64_t>(std::max(AudioConfig::Get().GetInt("System", "DSPBufferLength"), 0));
+	std::cout << std::format("AppClock: virtual, {} samples per frame at {} Hz", clock.mExpectedStepSamples, sampleRate) << std::endl;
+}
+
+void AppClock::Tick()
+{
+	AppClock& clock = Get();
+	if (!clock.bVirtual)
+	{
+		clock.mTimeNs = GetSteadyTimeNs() - clock.mStartNs;
+		return;
+	}
+
+	uint64_t samples = 0;
+	int sampleRate = 0;
+	if (!AudioEngine::GetMixerClock(samples, sampleRate) || sampleRate <= 0) { return; }
+
+	// Only the first frame has no mix before it
+	const uint64_t stepSamples = samples - clock.mLastSamples;
+	if (clock.mExpectedStepSamples > 0 && stepSamples != clock.mExpectedStepSamples && clock.mLastSamples != clock.mStartSamples && !clock.bWarnedUnevenStep)
+	{
+		std::cout << std::format("AppClock: the mixer advanced {} samples in a frame instead of {}, is the output non-realtime?",
+			stepSamples, clock.mExpectedStepSamples) << std::endl;
+		clock.bWarnedUnevenStep = true;
+	}
+	clock.mLastSamples = samples;
+	clock.mTimeNs = static_cast<int64_t>((samples - clock.mStartSamples) * NS_PER_SECOND / static_cast<uint64_t>(sampleRate));
+}
+
+int64_t AppClock::GetTimeNs()
+{
+	return Get().mTimeNs;
+}
+
+double AppClock::GetTimeSeconds()
+{
+	return static_cast<double>(Get().mTimeNs) * 1e-9;
+}
+
+bool AppClock::IsVirtual()
+{
+	return Get().bVirtual;
+}
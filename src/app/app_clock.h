@@ -0,0 +1,40 @@
+#ifndef APP_CLOCK_H
+#define APP_CLOCK_H
+
+/**
+ * @brief Application time, sampled once per frame by Application::Run
+ * Real mode follows the steady clock. Virtual mode follows the mixer clock of non-realtime output, where every
+ * AudioEngine::Update mixes one DSP buffer ([System] DSPBufferLength samples), so every frame advances the
+ * application time by exactly that many samples, however long the frame took to run.
+ * Anything that times application behavior (scenario waits, overlay refreshes) reads this clock instead of
+ * the wall clock, so a virtual clock run is reproducible and runs faster than realtime.
+ */
+class AppClock
+{
+	public:
+		static AppClock& Get();
+
+		/** After AudioEngine::Initialize */
+		static void Initialize(bool bVirtual);
+		/** Main thread, at the start of every frame */
+		static void Tick();
+
+		/** Time of the current frame since Initialize */
+		[[nodiscard]] static int64_t GetTimeNs();
+		[[nodiscard]] static double GetTimeSeconds();
+		[[nodiscard]] static bool IsVirtual();
+
+	private:
+		static std::unique_ptr<AppClock> sInstance;
+
+		bool bVirtual;
+		int64_t mStartNs;
+		uint64_t mStartSamples;
+		uint64_t mLastSamples;
+		uint64_t mExpectedStepSamples;
+		bool bWarnedUnevenStep;
+		int64_t mTimeNs;
+
+		AppClock();
+};
+#endif
@@ -0,0 +1,316 @@
+#include "scenario_runner.h"
+
+#include "app_clock.h"
+#include "profiling/allocation_tracker.h"
+#include "profiling/steady_time.h"
+
+#include <sstream>
+
+namespace
+{
+	const std::unordered_map<std::string_view, InputEvent> OVERLAY_TOGGLES = {
+		{"audio_info", ToggleAudioInfoOverlayEvent()},
+		{"volume", ToggleAudioVolumeWindowEvent()},
+		{"dsp_graph", ToggleDSPGraphOverlayEvent()},
+		{"profiler", ToggleProfilerOverlayEvent()},
+	};
+
+	std::string EscapeJson(const std::string_view value)
+	{
+		std::string escaped;
+		escaped.reserve(value.size());
+		for (const char c : value)
+		{
+			if (static_cast<unsigned char>(c) < 0x20)
+			{
+				escaped += std::format("\\u{:04x}", static_cast<unsigned char>(c));
+				continue;
+			}
+			if (c == '\\' || c == '"') { escaped += '\\'; }
+			escaped += c;
+		}
+		return escaped;
+	}
+
+	std::string FormatHistogramUs(const HdrHistogram& histogram)
+	{
+		return std::format(R"({{"count":{},"p50":{},"p99":{},"max":{}}})", histogram.GetCount(),
+			histogram.GetPercentile(50), histogram.GetPercentile(99), histogram.GetMax());
+	}
+}
+
+ScenarioRunner::ScenarioRunner()
+: mNextAction(0)
+, mFrameFirstAction(0)
+, mStartNs(0)
+, mEndNs(0)
+, mWaitUntilNs(0)
+, mLastFrameEndNs(0)
+, mWaitUntilFrame(0)
+, mFrameIndex(0)
+, bStarted(false)
+, bFinished(false)
+, mAllocations(0)
+, mMaxFrameAllocations(0)
+, mPreviousBankCount(0)
+{}
+
+bool ScenarioRunner::LoadFile(const std::string& filePath)
+{
+	std::ifstream file(filePath);
+	if (!file.is_open())
+	{
+		std::cout << "Scenario: cannot open " << filePath << std::endl;
+		return false;
+	}
+
+	std::stringstream text;
+	text << file.rdbuf();
+	return LoadText(text.str(), filePath);
+}
+
+bool ScenarioRunner::LoadText(const std::string& text, const std::string& name)
+{
+	std::vector<ScenarioAction> actions;
+	std::istringstream stream(text);
+	std::string line;
+	for (int lineNumber = 1; std::getline(stream, line); ++lineNumber)
+	{
+		line.erase(0, line.find_first_not_of(" \t"));
+		line.erase(line.find_last_not_of(" \t\r") + 1);
+		if (line.empty() || line.starts_with('#')) { continue; }
+
+		ScenarioAction action;
+		if (!ParseAction(line, action))
+		{
+			std::cout << std::format("Scenario: {}:{}: cannot parse \"{}\"", name, lineNumber, line) << std::endl;
+			return false;
+		}
+		action.line = lineNumber;
+		action.text = line;
+		actions.push_back(std::move(action));
+	}
+
+	mName = name;
+	mActions = std::move(actions);
+	mResults = std::vector<ScenarioActionResult>(mActions.size());
+	std::cout << std::format("Scenario: {} loaded, {} actions", mName, mActions.size()) << std::endl;
+	return true;
+}
+
+bool ScenarioRunner::ParseAction(const std::string& line, ScenarioAction& outAction)
+{
+	const size_t nameEnd = line.find_first_of(" \t");
+	const std::string name = line.substr(0, nameEnd);
+	const std::string argument = nameEnd == std::string::npos ? std::string() : line.substr(line.find_first_not_of(" \t", nameEnd));
+
+	if (name == "quit")
+	{
+		outAction.type = ScenarioActionType::Quit;
+		return argument.empty();
+	}
+	if (argument.empty()) { return false; }
+
+	if (name == "wait")
+	{
+		outAction.type = ScenarioActionType::Wait;
+		char* end = nullptr;
+		outAction.seconds = std::strtod(argument.c_str(), &end);
+		return *end == '\0' && outAction.seconds >= 0;
+	}
+	if (name == "wait_frames")
+	{
+		outAction.type = ScenarioActionType::WaitFrames;
+		char* end = nullptr;
+		outAction.frames = std::strtoull(argument.c_str(), &end, 10);
+		return *end == '\0';
+	}
+
+	outAction.type = ScenarioActionType::Event;
+	if (name == "open_page") { outAction.event = OpenPageEvent{ argument }; }
+	else if (name == "play_key") { outAction.event = PlayProgrammerSoundEvent{ argument }; }
+	else if (name == "set_locale") { outAction.event = SelectLocaleEvent{ argument }; }
+	else if (name == "set_volume")
+	{
+		// The volume is the last token, the path is everything before it
+		const size_t volumeIndex = argument.find_last_of(" \t");
+		if (volumeIndex == std::string::npos) { return false; }
+
+		char* end = nullptr;
+		const float volume = std::strtof(argument.c_str() + volumeIndex + 1, &end);
+		if (*end != '\0') { return false; }
+
+		outAction.event = SetVolumeEvent{ argument.substr(0, argument.find_last_not_of(" \t", volumeIndex) + 1), volume };
+	}
+	else if (name == "toggle_overlay")
+	{
+		const auto it = OVERLAY_TOGGLES.find(argument);
+		if (it == OVERLAY_TOGGLES.end()) { return false; }
+		outAction.event = it->second;
+	}
+	else { return false; }
+
+	return true;
+}
+
+void ScenarioRunner::Update(std::vector<InputEvent>& outEvents)
+{
+	if (bFinished) { return; }
+
+	const int64_t nowNs = AppClock::GetTimeNs();
+	if (!bStarted)
+	{
+		bStarted = true;
+		mStartNs = nowNs;
+		mEndNs = nowNs;
+		mLastFrameEndNs = GetSteadyTimeNs();
+	}
+
+	if (nowNs < mWaitUntilNs || mFrameIndex < mWaitUntilFrame) { return; }
+
+	while (mNextAction < mActions.size())
+	{
+		const ScenarioAction& action = mActions[mNextAction];
+		ScenarioActionResult& result = mResults[mNextAction];
+		result.bStarted = true;
+		result.startNs = nowNs - mStartNs;
+		result.startFrame = mFrameIndex;
+		++mNextAction;
+
+		switch (action.type)
+		{
+			case ScenarioActionType::Event:
+				outEvents.push_back(action.event);
+				break;
+			case ScenarioActionType::Wait:
+				mWaitUntilNs = nowNs + static_cast<int64_t>(action.seconds * 1e9);
+				return;
+			case ScenarioActionType::WaitFrames:
+				mWaitUntilFrame = mFrameIndex + action.frames;
+				return;
+			case ScenarioActionType::Quit:
+				Finish(outEvents, nowNs);
+				return;
+		}
+	}
+	Finish(outEvents, nowNs);
+}
+
+void ScenarioRunner::Finish(std::vector<InputEvent>& outEvents, const int64_t nowNs)
+{
+	outEvents.emplace_back(QuitRequestedEvent());
+	mEndNs = nowNs;
+	bFinished = true;
+	std::cout << std::format("Scenario: {} finished after {} frames", mName, mFrameIndex) << std::endl;
+}
+
+void ScenarioRunner::EndFrame()
+{
+	if (!bStarted) { return; }
+	if (!bFinished) { mEndNs = AppClock::GetTimeNs(); }
+
+	const int64_t nowNs = GetSteadyTimeNs();
+	const auto frameNs = static_cast<uint64_t>(std::max<int64_t>(nowNs - mLastFrameEndNs, 0));
+	const uint64_t allocations = AllocationTracker::GetLastFrame().allocations;
+	mLastFrameEndNs = nowNs;
+
+	mFrameNs.Record(frameNs);
+	mAllocations += allocations;
+	mMaxFrameAllocations = std::max(mMaxFrameAllocations, allocations);
+
+	for (size_t i = mFrameFirstAction; i < mNextAction; ++i)
+	{
+		mResults[i].actionFrameNs = static_cast<int64_t>(frameNs);
+	}
+	mFrameFirstAction = mNextAction;
+
+	if (mNextAction > 0)
+	{
+		ScenarioActionResult& result = mResults[mNextAction - 1];
+		++result.frames;
+		result.frameNs.Record(frameNs);
+		result.allocations += allocations;
+		result.maxFrameAllocations = std::max(result.maxFrameAllocations, allocations);
+	}
+
+	RecordBankLoads();
+	++mFrameIndex;
+}
+
+void ScenarioRunner::RecordBankLoads()
+{
+	if (!AudioEngine::GetStatsSnapshot(mAudioStats)) { return; }
+
+	// A bank that was not listed last frame has just been loaded, banks are few so a linear search is enough
+	for (int i = 0; i < mAudioStats.bankCount; ++i)
+	{
+		const AudioBankStats& bank = mAudioStats.banks[i];
+		bool bWasLoaded = false;
+		for (int j = 0; j < mPreviousBankCount && !bWasLoaded; ++j)
+		{
+			bWasLoaded = std::strcmp(bank.path, mPreviousBanks[j].path) == 0;
+		}
+		if (!bWasLoaded)
+		{
+			mBankLoads.push_back({ bank.path, bank.loadTimeMs, mFrameIndex });
+		}
+	}
+
+	mPreviousBankCount = mAudioStats.bankCount;
+	std::copy_n(mAudioStats.banks, mAudioStats.bankCount, mPreviousBanks);
+}
+
+bool ScenarioRunner::IsFinished() const
+{
+	return bFinished;
+}
+
+bool ScenarioRunner::WriteResults(const std::string& filePath) const
+{
+	std::ofstream file(filePath);
+	if (!file.is_open())
+	{
+		std::cout << "Scenario: cannot write " << filePath << std::endl;
+		return false;
+	}
+
+	const double frameCount = static_cast<double>(std::max<uint64_t>(mFrameIndex, 1));
+	file << std::format(R"({{"scenario":"{}","completed":{},"virtualClock":{},"frames":{},"durationSeconds":{:.4f},"frameMs":{},)",
+		EscapeJson(mName), bFinished, AppClock::IsVirtual(), mFrameIndex, static_cast<double>(mEndNs - mStartNs) * 1e-9,
+		FormatHistogramMs(mFrameNs));
+	file << std::format(R"("allocationsPerFrame":{{"tracked":{},"mean":{:.2f},"max":{}}},"actions":[)",
+		AllocationTracker::IsEnabled(), static_cast<double>(mAllocations) / frameCount, mMaxFrameAllocations);
+
+	for (size_t i = 0; i < mActions.size() && mResults[i].bStarted; ++i)
+	{
+		const ScenarioAction& action = mActions[i];
+		const ScenarioActionResult& result = mResults[i];
+		file << std::format(R"({}{{"line":{},"action":"{}","startSeconds":{:.4f},"startFrame":{},"actionFrameMs":{:.4f},)"
+			R"("frames":{},"frameMs":{},"allocationsPerFrame":{{"mean":{:.2f},"max":{}}}}})",
+			i == 0 ? "\n" : ",\n", action.line, EscapeJson(action.text), static_cast<double>(result.startNs) * 1e-9,
+			result.startFrame, static_cast<double>(result.actionFrameNs) * 1e-6, result.frames, FormatHistogramMs(result.frameNs),
+			static_cast<double>(result.allocations) / static_cast<double>(std::max<uint64_t>(result.frames, 1)),
+			result.maxFrameAllocations);
+	}
+
+	file << "\n],\"bankLoads\":[";
+	for (size_t i = 0; i < mBankLoads.size(); ++i)
+	{
+		file << std::format(R"({}{{"path":"{}","loadTimeMs":{:.3f},"frame":{}}})", i == 0 ? "\n" : ",\n",
+			EscapeJson(mBankLoads[i].path), mBankLoads[i].loadTimeMs, mBankLoads[i].frame);
+	}
+
+	std::vector<const AudioEventLatencyStats*> latencyStats;
+	AudioEngine::GetEventLatencyStats(latencyStats);
+	file << "\n],\"firstPlayLatency\":[";
+	for (size_t i = 0; i < latencyStats.size(); ++i)
+	{
+		file << std::format(R"({}{{"event":"{}","startedUs":{},"soundPlayedUs":{}}})", i == 0 ? "\n" : ",\n",
+			EscapeJson(latencyStats[i]->path), FormatHistogramUs(latencyStats[i]->startedUs),
+			FormatHistogramUs(latencyStats[i]->soundPlayedUs));
+	}
+	file << "\n]}" << std::endl;
+
+	std::cout << "Scenario: results written to " << filePath << std::endl;
+	return true;
+}
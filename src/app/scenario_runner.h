@@ -0,0 +1,104 @@
+#ifndef SCENARIO_RUNNER_H
+#define SCENARIO_RUNNER_H
+
+#include "audio/audio_engine.h"
+#include "input/input_events.h"
+#include "profiling/histogram.h"
+
+enum class ScenarioActionType : uint8_t
+{
+	Event, // Injects its InputEvent
+	Wait,
+	WaitFrames,
+	Quit
+};
+
+struct ScenarioAction
+{
+	ScenarioActionType type = ScenarioActionType::Event;
+	InputEvent event;
+	double seconds = 0;
+	uint64_t frames = 0;
+	int line = 0;
+	std::string text; // As written in the script
+};
+
+/** Frames are attributed to the last action started, so a wait reports the frames that follow the actions before it */
+struct ScenarioActionResult
+{
+	bool bStarted = false;
+	int64_t startNs = 0; // AppClock time since the scenario started
+	uint64_t startFrame = 0;
+	int64_t actionFrameNs = 0; // The frame that injected and handled the action
+	uint64_t frames = 0;
+	uint64_t allocations = 0;
+	uint64_t maxFrameAllocations = 0;
+	HdrHistogram frameNs;
+};
+
+struct ScenarioBankLoad
+{
+	std::string path;
+	float loadTimeMs = 0;
+	uint64_t frame = 0;
+};
+
+/**
+ * @brief Drives the application from a script of timed actions and records per-action frame timings
+ * One action per line, empty lines and lines starting with # are ignored:
+ *   open_page <name>              toggle_overlay <audio_info|volume|dsp_graph|profiler>
+ *   play_key <programmer key>     set_volume <vca path> <0-1>
+ *   set_locale <locale or code>   wait <seconds>
+ *   wait_frames <count>           quit
+ * Actions are injected as InputEvents at the start of Application::ProcessEvents, so they take the same path as
+ * the GUI. Consecutive actions run in the same frame until a wait. The end of the script quits the application.
+ * Waits and action start times follow AppClock, so they are exact under the virtual clock; frame times are always
+ * measured with the steady clock since they measure the cost of the frames.
+ */
+class ScenarioRunner
+{
+	public:
+		ScenarioRunner();
+
+		bool LoadFile(const std::string& filePath);
+		bool LoadText(const std::string& text, const std::string& name);
+
+		// Main thread only
+		/** Before the frame's events are handled. Appends the events of the actions that are due. */
+		void Update(std::vector<InputEvent>& outEvents);
+		/** After AllocationTracker::EndFrame, so the frame's allocation count is closed */
+		void EndFrame();
+
+		[[nodiscard]] bool IsFinished() const;
+		/** Before AudioEngine::Terminate, the first-play latency stats are read from the engine */
+		bool WriteResults(const std::string& filePath) const;
+
+	private:
+		std::string mName;
+		std::vector<ScenarioAction> mActions;
+		std::vector<ScenarioActionResult> mResults;
+		std::vector<ScenarioBankLoad> mBankLoads;
+
+		size_t mNextAction;
+		size_t mFrameFirstAction; // First action started in the current frame
+		int64_t mStartNs;         // AppClock
+		int64_t mEndNs;           // AppClock
+		int64_t mWaitUntilNs;     // AppClock
+		int64_t mLastFrameEndNs;  // Steady clock
+		uint64_t mWaitUntilFrame;
+		uint64_t mFrameIndex;
+		bool bStarted;
+		bool bFinished;
+
+		HdrHistogram mFrameNs;
+		uint64_t mAllocations;
+		uint64_t mMaxFrameAllocations;
+		AudioEngineStats mAudioStats;
+		int mPreviousBankCount;
+		AudioBankStats mPreviousBanks[AUDIO_STATS_MAX_BANKS];
+
+		static bool ParseAction(const std::string& line, ScenarioAction& outAction);
+		void Finish(std::vector<InputEvent>& outEvents, int64_t nowNs);
+		void RecordBankLoads();
+};
+#endif
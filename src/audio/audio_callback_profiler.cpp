@@ -0,0 +1,125 @@
+#include "audio_callback_profiler.h"
+
+namespace
+{
+	struct CallbackTypeName
+	{
+		AudioCallbackKind kind;
+		uint32_t type;
+		const char* name;
+	};
+
+	constexpr CallbackTypeName CALLBACK_TYPE_NAMES[] = {
+		{AudioCallbackKind::Event, FMOD_STUDIO_EVENT_CALLBACK_CREATED, "CREATED"},
+		{AudioCallbackKind::Event, FMOD_STUDIO_EVENT_CALLBACK_DESTROYED, "DESTROYED"},
+		{AudioCallbackKind::Event, FMOD_STUDIO_EVENT_CALLBACK_STARTING, "STARTING"},
+		{AudioCallbackKind::Event, FMOD_STUDIO_EVENT_CALLBACK_STARTED, "STARTED"},
+		{AudioCallbackKind::Event, FMOD_STUDIO_EVENT_CALLBACK_RESTARTED, "RESTARTED"},
+		{AudioCallbackKind::Event, FMOD_STUDIO_EVENT_CALLBACK_STOPPED, "STOPPED"},
+		{AudioCallbackKind::Event, FMOD_STUDIO_EVENT_CALLBACK_START_FAILED, "START_FAILED"},
+		{AudioCallbackKind::Event, FMOD_STUDIO_EVENT_CALLBACK_CREATE_PROGRAMMER_SOUND, "CREATE_PROGRAMMER_SOUND"},
+		{AudioCallbackKind::Event, FMOD_STUDIO_EVENT_CALLBACK_DESTROY_PROGRAMMER_SOUND, "DESTROY_PROGRAMMER_SOUND"},
+		{AudioCallbackKind::Event, FMOD_STUDIO_EVENT_CALLBACK_PLUGIN_CREATED, "PLUGIN_CREATED"},
+		{AudioCallbackKind::Event, FMOD_STUDIO_EVENT_CALLBACK_PLUGIN_DESTROYED, "PLUGIN_DESTROYED"},
+		{AudioCallbackKind::Event, FMOD_STUDIO_EVENT_CALLBACK_TIMELINE_MARKER, "TIMELINE_MARKER"},
+		{AudioCallbackKind::Event, FMOD_STUDIO_EVENT_CALLBACK_TIMELINE_BEAT, "TIMELINE_BEAT"},
+		{AudioCallbackKind::Event, FMOD_STUDIO_EVENT_CALLBACK_SOUND_PLAYED, "SOUND_PLAYED"},
+		{AudioCallbackKind::Event, FMOD_STUDIO_EVENT_CALLBACK_SOUND_STOPPED, "SOUND_STOPPED"},
+		{AudioCallbackKind::Event, FMOD_STUDIO_EVENT_CALLBACK_REAL_TO_VIRTUAL, "REAL_TO_VIRTUAL"},
+		{AudioCallbackKind::Event, FMOD_STUDIO_EVENT_CALLBACK_VIRTUAL_TO_REAL, "VIRTUAL_TO_REAL"},
+		{AudioCallbackKind::Event, FMOD_STUDIO_EVENT_CALLBACK_START_EVENT_COMMAND, "START_EVENT_COMMAND"},
+		{AudioCallbackKind::Event, FMOD_STUDIO_EVENT_CALLBACK_NESTED_TIMELINE_BEAT, "NESTED_TIMELINE_BEAT"},
+		{AudioCallbackKind::StudioSystem, FMOD_STUDIO_SYSTEM_CALLBACK_PREUPDATE, "PREUPDATE"},
+		{AudioCallbackKind::StudioSystem, FMOD_STUDIO_SYSTEM_CALLBACK_POSTUPDATE, "POSTUPDATE"},
+		{AudioCallbackKind::StudioSystem, FMOD_STUDIO_SYSTEM_CALLBACK_BANK_UNLOAD, "BANK_UNLOAD"},
+		{AudioCallbackKind::StudioSystem, FMOD_STUDIO_SYSTEM_CALLBACK_LIVEUPDATE_CONNECTED, "LIVEUPDATE_CONNECTED"},
+		{AudioCallbackKind::StudioSystem, FMOD_STUDIO_SYSTEM_CALLBACK_LIVEUPDATE_DISCONNECTED, "LIVEUPDATE_DISCONNECTED"},
+		{AudioCallbackKind::CoreSystem, FMOD_SYSTEM_CALLBACK_ERROR, "ERROR"},
+		{AudioCallbackKind::Debug, FMOD_DEBUG_LEVEL_ERROR, "LEVEL_ERROR"},
+		{AudioCallbackKind::Debug, FMOD_DEBUG_LEVEL_WARNING, "LEVEL_WARNING"},
+		{AudioCallbackKind::Debug, FMOD_DEBUG_LEVEL_LOG, "LEVEL_LOG"},
+	};
+}
+
+AudioCallbackProfiler::AudioCallbackProfiler(const uint64_t budgetUs)
+: mBudgetNs(budgetUs * 1000)
+, mOverBudgetTotal(0)
+, mReportedOverBudgetTotal(0)
+, mSlotCount(0)
+{
+	for (auto& slotByTypeBit : mSlotByTypeBit)
+	{
+		slotByTypeBit.fill(-1);
+	}
+
+	for (const auto& [kind, type, name] : CALLBACK_TYPE_NAMES)
+	{
+		if (mSlotCount >= MAX_SLOTS || !std::has_single_bit(type)) { continue; }
+
+		Slot& slot = mSlots[mSlotCount];
+		slot.kind = kind;
+		slot.type = type;
+		slot.name = name;
+		mSlotByTypeBit[static_cast<size_t>(kind)][std::countr_zero(type)] = static_cast<int8_t>(mSlotCount);
+		++mSlotCount;
+	}
+}
+
+void AudioCallbackProfiler::Record(const AudioCallbackKind kind, const uint32_t type, const uint64_t durationNs,
+	AudioEventCallbackStats* eventStats)
+{
+	const bool bIsOverBudget = mBudgetNs > 0 && durationNs > mBudgetNs;
+
+	if (Slot* slot = FindSlot(kind, type))
+	{
+		slot->durationNs.Record(durationNs);
+		if (bIsOverBudget) { slot->overBudgetCount.fetch_add(1, std::memory_order_relaxed); }
+	}
+
+	if (eventStats)
+	{
+		eventStats->durationNs.Record(durationNs);
+		if (bIsOverBudget) { eventStats->overBudgetCount.fetch_add(1, std::memory_order_relaxed); }
+	}
+
+	if (bIsOverBudget) { mOverBudgetTotal.fetch_add(1, std::memory_order_release); }
+}
+
+void AudioCallbackProfiler::ReportBudgetOverruns(std::ostream& stream)
+{
+	const uint64_t overBudgetTotal = mOverBudgetTotal.load(std::memory_order_acquire);
+	if (overBudgetTotal == mReportedOverBudgetTotal) { return; }
+	mReportedOverBudgetTotal = overBudgetTotal;
+
+	for (size_t i = 0; i < mSlotCount; ++i)
+	{
+		Slot& slot = mSlots[i];
+		const uint64_t overBudgetCount = slot.overBudgetCount.load(std::memory_order_relaxed);
+		if (overBudgetCount == slot.reportedOverBudgetCount) { continue; }
+
+		stream << std::format("FMOD Warning: {} callback {} exceeded the {} us budget {} time(s), max {:.1f} us",
+			GetKindName(slot.kind), slot.name, mBudgetNs / 1000, overBudgetCount - slot.reportedOverBudgetCount,
+			static_cast<double>(slot.durationNs.GetMax()) * 0.001) << std::endl;
+		slot.reportedOverBudgetCount = overBudgetCount;
+	}
+}
+
+const char* AudioCallbackProfiler::GetKindName(const AudioCallbackKind kind)
+{
+	switch (kind)
+	{
+		case AudioCallbackKind::Event: return "Event";
+		case AudioCallbackKind::StudioSystem: return "StudioSystem";
+		case AudioCallbackKind::CoreSystem: return "CoreSystem";
+		case AudioCallbackKind::Debug: return "Debug";
+		default: return "Unknown";
+	}
+}
+
+AudioCallbackProfiler::Slot* AudioCallbackProfiler::FindSlot(const AudioCallbackKind kind, const uint32_t type)
+{
+	if (type == 0 || kind >= AudioCallbackKind::Count) { return nullptr; }
+
+	const int8_t slotIndex = mSlotByTypeBit[static_cast<size_t>(kind)][std::countr_zero(type)];
+	return slotIndex < 0 ? nullptr : &mSlots[slotIndex];
+}
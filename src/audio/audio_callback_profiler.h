@@ -0,0 +1,61 @@
+#ifndef AUDIO_CALLBACK_PROFILER_H
+#define AUDIO_CALLBACK_PROFILER_H
+
+#include "fmod_studio.hpp"
+
+#include "audio_instance_tracker.h"
+#include "profiling/histogram.h"
+
+enum class AudioCallbackKind : uint8_t
+{
+	Event,
+	StudioSystem,
+	CoreSystem,
+	Debug,
+	Count
+};
+
+/**
+ * @brief Execution time histograms (ns) of FMOD callbacks, per callback kind and type
+ * Record() is lock-free and allocation-free so it can run on FMOD's Studio, mixer and file threads.
+ * Budget overruns are only counted there; ReportBudgetOverruns prints them later from the main thread.
+ */
+class AudioCallbackProfiler
+{
+	public:
+		struct Slot
+		{
+			AudioCallbackKind kind = AudioCallbackKind::Event;
+			uint32_t type = 0;
+			const char* name = nullptr;
+			HdrHistogram durationNs;
+			std::atomic<uint64_t> overBudgetCount = 0;
+			uint64_t reportedOverBudgetCount = 0; // Main thread only
+		};
+
+		explicit AudioCallbackProfiler(uint64_t budgetUs);
+
+		void Record(AudioCallbackKind kind, uint32_t type, uint64_t durationNs, AudioEventCallbackStats* eventStats = nullptr);
+		void ReportBudgetOverruns(std::ostream& stream);
+
+		[[nodiscard]] uint64_t GetBudgetNs() const { return mBudgetNs; }
+		[[nodiscard]] size_t GetSlotCount() const { return mSlotCount; }
+		[[nodiscard]] const Slot& GetSlot(const size_t index) const { return mSlots[index]; }
+
+		static const char* GetKindName(AudioCallbackKind kind);
+
+	private:
+		static constexpr size_t KIND_COUNT = static_cast<size_t>(AudioCallbackKind::Count);
+		static constexpr size_t MAX_SLOTS = 32;
+
+		uint64_t mBudgetNs;
+		std::atomic<uint64_t> mOverBudgetTotal;
+		uint64_t mReportedOverBudgetTotal; // Main thread only
+
+		std::array<Slot, MAX_SLOTS> mSlots;
+		size_t mSlotCount;
+		std::array<std::array<int8_t, 32>, KIND_COUNT> mSlotByTypeBit;
+
+		Slot* FindSlot(AudioCallbackKind kind, uint32_t type);
+};
+#endif
@@ -4,11 +4,13 @@
 #include <algorithm>
 #include <format>
 #include <fstream>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+constexpr auto AUDIO_CONFIG_FILE_PATH = "config/audio_engine.ini";
 
 /**
  * @brief Handles loading and parsing of .ini audio configuration files
@@ -16,26 +18,62 @@
  */
 class AudioConfig
 {
+	public:
+		/** The engine config at AUDIO_CONFIG_FILE_PATH, parsed once on first use and shared by the engine and profiling
+		 * modules. Main thread only. Empty if the file cannot be read, see IsLoaded.
+		 */
+		static const AudioConfig& Get()
+		{
+			if (!sInstance)
+			{
+				sInstance = std::make_unique<AudioConfig>();
+				sInstance->bIsLoaded = sInstance->LoadConfigFile(AUDIO_CONFIG_FILE_PATH);
+				sInstance->ReleaseLoadedFile();
+			}
+			return *sInstance;
+		}
+
+		/** Replaces a value in every config file loaded afterwards and in the shared engine config, without editing the .ini on disk.
+		 * Lets headless tools force settings such as [System] OutputType=NoSoundNRT before AudioEngine::Initialize.
+		 */
+		static void SetOverride(const std::string& section, const std::string& key, const std::string& value)
+		{
+			sOverrides.insert_or_assign(section + CATEGORY_SEPARATOR + key, value);
+			if (sInstance) { sInstance->mConfigData.insert_or_assign(section + CATEGORY_SEPARATOR + key, value); }
+		}
+
+		/** Every key of another .ini becomes an override, e.g. to run a tool under alternative settings. Arrays are not overridable. */
+		static bool SetOverridesFromFile(const std::string& filePath)
+		{
+			AudioConfig overrideConfig;
+			if (!overrideConfig.LoadConfigFile(filePath)) { return false; }
+
+			for (const auto& [entry, value] : overrideConfig.mConfigData)
+			{
+				sOverrides.insert_or_assign(entry, value);
+				if (sInstance) { sInstance->mConfigData.insert_or_assign(entry, value); }
+			}
+			return true;
+		}
+
+		/** The shared engine config is parsed again on the next Get */
+		static void ClearOverrides()
+		{
+			sOverrides.clear();
+			sInstance.reset();
+		}
+
+	AudioConfig() = default;
+
 	~AudioConfig()
 	{
 		ReleaseLoadedFile();
 	}
 
-	friend class AudioEngine;
-
-	static constexpr char CATEGORY_SEPARATOR = '.';
-	static constexpr char ARRAY_ITEM_SEPARATOR = ',';
-	static constexpr char COMMENT_CHAR = '#';
-	static constexpr char ALT_COMMENT_CHAR = ';';
-	static constexpr char SECTION_START = '[';
-	static constexpr char SECTION_END = ']';
-	static constexpr char ARRAY_START = '(';
-	static constexpr char ARRAY_END = ')';
-	static constexpr char KEY_VALUE_SEPARATOR = '=';
-
-
-	std::ifstream mconfigFile = std::ifstream();
+	AudioConfig(const AudioConfig&) = delete;
+	AudioConfig& operator=(const AudioConfig&) = delete;
 
+	/** Reads another .ini, such as the learned buffer sizes. The overrides apply to it too. */
 	bool LoadConfigFile(const std::string& filePath)
 	{
 		mconfigFile.open(filePath);
@@ -101,15 +139,12 @@ class AudioConfig
 			}
 		}
 
-		return true;
-	}
-
-	void ReleaseLoadedFile()
-	{
-		if (mconfigFile.is_open())
+		for (const auto& [entry, value] : sOverrides)
 		{
-			mconfigFile.close();
+			mConfigData.insert_or_assign(entry, value);
 		}
+
+		return true;
 	}
 
 	[[nodiscard]] std::string GetString(const std::string& section, const std::string& key, const std::string& defaultValue = "") const
@@ -145,8 +180,34 @@ class AudioConfig
 		return value == "true" || value == "1";
 	}
 
+	[[nodiscard]] bool IsLoaded() const { return bIsLoaded; }
+
+	private:
+	static constexpr char CATEGORY_SEPARATOR = '.';
+	static constexpr char ARRAY_ITEM_SEPARATOR = ',';
+	static constexpr char COMMENT_CHAR = '#';
+	static constexpr char ALT_COMMENT_CHAR = ';';
+	static constexpr char SECTION_START = '[';
+	static constexpr char SECTION_END = ']';
+	static constexpr char ARRAY_START = '(';
+	static constexpr char ARRAY_END = ')';
+	static constexpr char KEY_VALUE_SEPARATOR = '=';
+
+	std::ifstream mconfigFile = std::ifstream();
+
+	void ReleaseLoadedFile()
+	{
+		if (mconfigFile.is_open())
+		{
+			mconfigFile.close();
+		}
+	}
+
 	std::unordered_map<std::string, std::string> mConfigData;
 	std::unordered_map<std::string, std::vector<std::string>> mConfigArrayData;
+	bool bIsLoaded = false;
+	static inline std::unordered_map<std::string, std::string> sOverrides;
+	static inline std::unique_ptr<AudioConfig> sInstance;
 
 	static void CleanWhitespace(std::string& inString)
 	{
@@ -1,5 +1,8 @@
 #include "audio_engine.h"
 
+#include "profiling/hitch_watchdog.h"
+#include "profiling/steady_time.h"
+
 #if WIN32
 #include <combaseapi.h>
 #endif
@@ -74,9 +77,121 @@ namespace
 	}
 }
 
+// Profiling helpers
+namespace
+{
+	constexpr int64_t OWNER_SAMPLE_INTERVAL_NS = 250000000;
+	constexpr int CHANNEL_GROUP_MAX_DEPTH = 8;
+
+	constexpr int64_t BUFFER_STALL_REPORT_INTERVAL_NS = 1000000000;
+	constexpr uint64_t STUDIO_BUFFER_MAX_BYTES = 64 * 1024 * 1024;
+	constexpr auto LEARNED_BUFFER_SIZES_SECTION = "StudioBuffers";
+
+	constexpr int DSP_GRAPH_MAX_NODES = 512;
+	constexpr int DSP_GRAPH_MAX_DEPTH = 32;
+
+	using DSPOwnerMap = std::unordered_map<FMOD::DSP*, std::string>;
+
+	// Never shrinks below the current capacity, adds headroom over the observed peak and doubles after a stall
+	unsigned int LearnStudioBufferSize(const FMOD_STUDIO_BUFFER_INFO& info, const unsigned int configuredSize)
+	{
+		const uint64_t capacity = std::max<uint64_t>(configuredSize, static_cast<uint64_t>(std::max(info.capacity, 0)));
+		uint64_t learnedSize = std::max(capacity, static_cast<uint64_t>(std::max(info.peakusage, 0)) * 3 / 2);
+		if (info.stallcount > 0) { learnedSize = std::max(learnedSize, capacity * 2); }
+		return static_cast<unsigned int>(std::min(std::bit_ceil(learnedSize), STUDIO_BUFFER_MAX_BYTES));
+	}
+
+	int CountPlayingChannels(FMOD::ChannelGroup* channelGroup, const int depth)
+	{
+		int channelCount = 0;
+		channelGroup->getNumChannels(&channelCount);
+
+		int groupCount = 0;
+		if (depth < CHANNEL_GROUP_MAX_DEPTH && channelGroup->getNumGroups(&groupCount) == FMOD_OK)
+		{
+			for (int i = 0; i < groupCount; ++i)
+			{
+				FMOD::ChannelGroup* childGroup = nullptr;
+				if (channelGroup->getGroup(i, &childGroup) == FMOD_OK)
+				{
+					channelCount += CountPlayingChannels(childGroup, depth + 1);
+				}
+			}
+		}
+		return channelCount;
+	}
+
+	void CollectDSPNodes(FMOD::DSP* dsp, const int depth, const std::string& parentOwner, const DSPOwnerMap& owners,
+		const bool bReadCPUUsage, std::set<FMOD::DSP*>& visited, std::vector<AudioDSPNodeInfo>& outNodes)
+	{
+		if (!dsp || depth > DSP_GRAPH_MAX_DEPTH || outNodes.size() >= DSP_GRAPH_MAX_NODES) { return; }
+		if (!visited.insert(dsp).second) { return; } // Shared inputs (sends, returns) are listed once
+
+		AudioDSPNodeInfo node;
+		node.depth = depth;
+
+		const auto ownerIt = owners.find(dsp);
+		node.owner = ownerIt != owners.end() ? ownerIt->second : parentOwner;
+
+		char name[32] = {};
+		dsp->getInfo(name, nullptr, nullptr, nullptr, nullptr);
+		node.name = name;
+
+		FMOD_DSP_TYPE type = FMOD_DSP_TYPE_UNKNOWN;
+		dsp->getType(&type);
+		node.type = static_cast<int>(type);
+
+		dsp->getActive(&node.bIsActive);
+		dsp->getBypass(&node.bIsBypassed);
+
+		if (bReadCPUUsage)
+		{
+			dsp->getCPUUsage(&node.cpuExclusiveUs, &node.cpuInclusiveUs);
+		}
+
+		const std::string owner = node.owner;
+		outNodes.push_back(std::move(node));
+
+		int numInputs = 0;
+		dsp->getNumInputs(&numInputs);
+		for (int i = 0; i < numInputs; ++i)
+		{
+			FMOD::DSP* input = nullptr;
+			if (dsp->getInput(i, &input, nullptr) == FMOD_OK)
+			{
+				CollectDSPNodes(input, depth + 1, owner, owners, bReadCPUUsage, visited, outNodes);
+			}
+		}
+	}
+}
+
 AudioEngine::AudioEngine()
 : mStudioSystem(nullptr)
 , bMainBanksLoaded(false)
+, bProfileMeterAllEnabled(false)
+, mUpdateIndex(0)
+, mEventsPlayed(0)
+, mEventsPlayedWindowStart(0)
+, mEventsPlayedWindowStartNs(0)
+, mEventsPlayedPerSecond(0)
+, bPreloadSampleData(false)
+, mOwnerCount(0)
+, mActiveOwnerIndex(AUDIO_OWNER_NONE)
+, mOwnersSampledNs(0)
+, bOwnerAccountingEnabled(false)
+, bAssertOnBudgetOverflow(false)
+, mCommandQueueSize(0)
+, mHandleInitialSize(0)
+, bBufferAutoSizingEnabled(false)
+, mCommandCaptureFlags(FMOD_STUDIO_COMMANDCAPTURE_NORMAL)
+, bCommandCaptureActive(false)
+, mReportedBufferUsage()
+, mBufferStallsReportedNs(0)
+, mLastUpdateCallNs(0)
+, mInstanceTracker(std::make_unique<AudioInstanceTracker>())
+, mMasterChannelGroup(nullptr)
+, bFirstPlayLatencyEnabled(false)
+, bInstanceTrackingEnabled(false)
 {}
 
 AudioEngine& AudioEngine::Get()
@@ -98,12 +213,29 @@ bool AudioEngine::Initialize()
 	AudioEngine& audioEngine = Get();
 	if (StudioSystem::create(&audioEngine.mStudioSystem) != FMOD_OK) { return false; }
 
-	AudioConfig config;
-	if (!config.LoadConfigFile("config/audio_engine.ini")) { return false; }
+	const AudioConfig& config = AudioConfig::Get();
+	if (!config.IsLoaded()) { return false; }
 
 	CoreSystem* coreSystem = nullptr;
 	if (audioEngine.mStudioSystem->getCoreSystem(&coreSystem) != FMOD_OK) { return false; }
 
+	// Both must exist before any callback is registered, the profiling shims are only installed when the profiler does
+	audioEngine.mLogger = std::make_unique<AudioLogger>(std::max(config.GetInt("System", "LogRingCapacity", 1024), 0),
+		config.GetInt("System", "LogRateLimitMs", 1000));
+	if (config.GetBool("Profiling", "EnableCallbackProfiling"))
+	{
+		audioEngine.mCallbackProfiler = std::make_unique<AudioCallbackProfiler>(
+			std::max(config.GetInt("Profiling", "CallbackBudgetUs", 500), 0));
+	}
+	const bool bProfileCallbacks = audioEngine.mCallbackProfiler != nullptr;
+
+	// The file system can only be replaced before the Core System is initialized
+	if (config.GetBool("Profiling", "EnableFileTracing"))
+	{
+		audioEngine.mFileTracer = std::make_unique<AudioFileTracer>(config.GetString("Profiling", "FileTracePath", ""));
+		if (!audioEngine.mFileTracer->Install(coreSystem)) { audioEngine.mFileTracer.reset(); }
+	}
+
 	FMOD_SPEAKERMODE outputFormat = ParseSpeakerMode(config.GetString("System", "OutputFormat", "Stereo"));
 	FMOD_OUTPUTTYPE outputType = ParseOutputType(config.GetString("System", "OutputType", "AutoDetect"));
 
@@ -131,7 +263,7 @@ bool AudioEngine::Initialize()
 
 	if (config.GetBool("System", "EnableAPIErrorLogging"))
 	{
-		coreSystem->setCallback(AudioEngineErrorCallback, FMOD_SYSTEM_CALLBACK_ERROR);
+		coreSystem->setCallback(bProfileCallbacks ? ProfiledErrorCallback : AudioEngineErrorCallback, FMOD_SYSTEM_CALLBACK_ERROR);
 	}
 
 	std::string bankKey = config.GetString("Advanced", "StudioBankKey");
@@ -141,31 +273,93 @@ bool AudioEngine::Initialize()
 	studioAdvancedSettings.studioupdateperiod = config.GetInt("Advanced", "StudioUpdatePeriodMs");
 	if (!bankKey.empty()) { studioAdvancedSettings.encryptionkey = bankKey.c_str(); }
 
+	// 0 keeps FMOD's default. Learned sizes from a previous run can only grow the configured ones.
+	audioEngine.mCommandQueueSize = static_cast<unsigned int>(std::max(config.GetInt("Advanced", "CommandQueueSize"), 0));
+	audioEngine.mHandleInitialSize = static_cast<unsigned int>(std::max(config.GetInt("Advanced", "HandleInitialSize"), 0));
+	audioEngine.mLearnedBufferSizesPath = config.GetString("Advanced", "LearnedBufferSizesPath", "");
+	audioEngine.bBufferAutoSizingEnabled = config.GetBool("Advanced", "EnableBufferAutoSizing") && !audioEngine.mLearnedBufferSizesPath.empty();
+	if (AudioConfig learnedSizes; audioEngine.bBufferAutoSizingEnabled && learnedSizes.LoadConfigFile(audioEngine.mLearnedBufferSizesPath))
+	{
+		audioEngine.mCommandQueueSize = std::max(audioEngine.mCommandQueueSize,
+			static_cast<unsigned int>(std::max(learnedSizes.GetInt(LEARNED_BUFFER_SIZES_SECTION, "CommandQueueSize"), 0)));
+		audioEngine.mHandleInitialSize = std::max(audioEngine.mHandleInitialSize,
+			static_cast<unsigned int>(std::max(learnedSizes.GetInt(LEARNED_BUFFER_SIZES_SECTION, "HandleInitialSize"), 0)));
+	}
+	studioAdvancedSettings.commandqueuesize = audioEngine.mCommandQueueSize;
+	studioAdvancedSettings.handleinitialsize = audioEngine.mHandleInitialSize;
+	if (audioEngine.mStudioSystem->setAdvancedSettings(&studioAdvancedSettings) != FMOD_OK) { return false; }
+
+	AudioUpdateControllerSettings updateSettings;
+	updateSettings.bAdaptive = config.GetBool("Advanced", "EnableAdaptiveUpdate");
+	updateSettings.basePeriodMs = static_cast<float>(studioAdvancedSettings.studioupdateperiod);
+	updateSettings.minPeriodMs = config.GetFloat("Advanced", "AdaptiveUpdateMinMs", updateSettings.basePeriodMs);
+	updateSettings.maxPeriodMs = config.GetFloat("Advanced", "AdaptiveUpdateMaxMs", updateSettings.basePeriodMs * 3);
+	updateSettings.bSynchronousUpdate = config.GetBool("Advanced", "EnableSynchronousUpdate");
+	updateSettings.dspHighPercent = config.GetFloat("Advanced", "AdaptiveDSPHighPercent", 80);
+	updateSettings.dspLowPercent = config.GetFloat("Advanced", "AdaptiveDSPLowPercent", 60);
+	updateSettings.submitCostHighPercent = config.GetFloat("Advanced", "AdaptiveSubmitCostHighPercent", 2);
+	updateSettings.submitCostLowPercent = config.GetFloat("Advanced", "AdaptiveSubmitCostLowPercent", 1);
+	audioEngine.mUpdateController.Configure(updateSettings);
+	if (updateSettings.bAdaptive && !audioEngine.mUpdateController.IsAdaptive())
+	{
+		std::cout << "FMOD: EnableAdaptiveUpdate is ignored with EnableSynchronousUpdate, every update has to mix" << std::endl;
+	}
+
 	FMOD_ADVANCEDSETTINGS coreAdvancedSettings = {};
 
 	coreAdvancedSettings.cbSize = sizeof(FMOD_ADVANCEDSETTINGS);
 	coreAdvancedSettings.vol0virtualvol = config.GetFloat("Advanced", "Vol0VirtualLevel");
 	coreAdvancedSettings.profilePort = config.GetInt("Advanced", "LiveUpdatePort");
+	// 0 keeps FMOD's default seed
+	coreAdvancedSettings.randomSeed = static_cast<unsigned int>(std::max(config.GetInt("Advanced", "RandomSeed"), 0));
 	if (coreSystem->setAdvancedSettings(&coreAdvancedSettings) != FMOD_OK) { return false; }
 
 	FMOD_STUDIO_INITFLAGS studio_init_flags = FMOD_STUDIO_INIT_NORMAL;
 	FMOD_INITFLAGS init_flags = FMOD_INIT_NORMAL;
 
+	// Per-DSP CPU usage for the DSP graph inspector, adds a small cost to every DSP in the mix
+	audioEngine.bProfileMeterAllEnabled = config.GetBool("System", "EnableProfileMeterAll");
+	if (audioEngine.bProfileMeterAllEnabled) { init_flags |= FMOD_INIT_PROFILE_METER_ALL; }
+
+	// Runs the Studio and Core update (and with NRT output, one mix) inside Studio::System::update on the calling thread
+	// Refer to: https://www.fmod.com/docs/2.03/api/studio-api-system.html#fmod_studio_init_synchronous_update
+	if (config.GetBool("Advanced", "EnableSynchronousUpdate")) { studio_init_flags |= FMOD_STUDIO_INIT_SYNCHRONOUS_UPDATE; }
+
 #ifndef NDEBUG
 	if (config.GetBool("System", "EnableLiveUpdate")) { studio_init_flags |= FMOD_STUDIO_INIT_LIVEUPDATE; }
 	if (config.GetBool("System", "EnableMemoryTracking")) { studio_init_flags |= FMOD_STUDIO_INIT_MEMORY_TRACKING; }
 
 	// Logging only available in the Debug config (fmodstudioL and fmodL dynamic libs)
 	FMOD_DEBUG_FLAGS loggingLevel = ParseDebugFlags(config.GetString("System", "DebugFlags", "None"));
-	FMOD::Debug_Initialize(loggingLevel, FMOD_DEBUG_MODE_CALLBACK, AudioEngineLogCallback);
+	FMOD::Debug_Initialize(loggingLevel, FMOD_DEBUG_MODE_CALLBACK, bProfileCallbacks ? ProfiledLogCallback : AudioEngineLogCallback);
 #endif
 
 	if (audioEngine.mStudioSystem->initialize(maxChannelCount,studio_init_flags, init_flags, initDriverData) != FMOD_OK) { return false; }
 
+	// COMMAND CAPTURE
+	// Started before the master banks load, so a replay of the capture loads them too
+	audioEngine.mCommandCapturePath = config.GetString("Profiling", "CommandCapturePath", "fmod_command_capture.cmd");
+	if (config.GetBool("Profiling", "CommandCaptureFileFlush")) { audioEngine.mCommandCaptureFlags |= FMOD_STUDIO_COMMANDCAPTURE_FILEFLUSH; }
+	if (config.GetBool("Profiling", "EnableCommandCapture")) { StartCommandCapture(); }
+
+	// JOURNAL
+	if (config.GetBool("Journal", "EnableJournal"))
+	{
+		audioEngine.mJournal = AudioJournal::Create(config.GetString("Journal", "JournalPath", "audio_journal.bin"),
+			static_cast<uint32_t>(std::max(config.GetInt("Journal", "RecordCapacity", 65536), 0)),
+			static_cast<uint32_t>(std::max(config.GetInt("Journal", "NameCapacity", 1024), 0)));
+	}
+
+	// INSTANCE TRACKING AND LATENCY
+	audioEngine.mInstanceTracker = std::make_unique<AudioInstanceTracker>(config.GetInt("Profiling", "TrackedInstanceCapacity", 1024));
+	audioEngine.bFirstPlayLatencyEnabled = config.GetBool("Profiling", "EnableFirstPlayLatency");
+	coreSystem->getMasterChannelGroup(&audioEngine.mMasterChannelGroup);
+
 	// AUDIO ENGINE CALLBACK
 
 	audioEngine.mStudioSystem->setUserData(&audioEngine);
-	audioEngine.mStudioSystem->setCallback(AudioEventCallback_Music, FMOD_STUDIO_SYSTEM_CALLBACK_ALL);
+	audioEngine.mStudioSystem->setCallback(bProfileCallbacks ? ProfiledStudioSystemCallback : AudioEventCallback_Music,
+		FMOD_STUDIO_SYSTEM_CALLBACK_ALL);
 
 	// ADDITIONAL PLUGINS
 	// Registering the resonance dynamic library as an additional plugin
@@ -174,15 +368,41 @@ bool AudioEngine::Initialize()
 	const std::string additionalPluginsRootPath = config.GetString("Plugins", "AdditionalPluginsRootPath");
 	audioEngine.RegisterAdditionalPlugins(additionalPlugins, additionalPluginsRootPath);
 
+	// OWNER ACCOUNTING AND BUDGETS
+	audioEngine.bOwnerAccountingEnabled = config.GetBool("Budgets", "EnableOwnerAccounting");
+	audioEngine.bAssertOnBudgetOverflow = config.GetString("Budgets", "OverflowAction", "Log") == "Assert";
+	for (const auto& ownerName : config.GetStringArray("Budgets", "Owners"))
+	{
+		const std::string section = "Budget." + ownerName;
+		AudioOwnerBudget& budget = audioEngine.mOwnerBudgets[ownerName];
+		budget.maxBanks = config.GetInt(section, "MaxBanks");
+		budget.maxBankMemoryBytes = static_cast<int64_t>(config.GetInt(section, "MaxBankMemoryKB")) * 1024;
+		budget.maxSampleMemoryBytes = static_cast<int64_t>(config.GetInt(section, "MaxSampleMemoryKB")) * 1024;
+		budget.maxInstances = config.GetInt(section, "MaxInstances");
+		budget.maxVoices = config.GetInt(section, "MaxVoices");
+		budget.maxCallbackUsPerSecond = config.GetFloat(section, "MaxCallbackUsPerSecond");
+	}
+
+	// Instances only get a tracking record and the engine callback when a feature reads them
+	audioEngine.bInstanceTrackingEnabled = config.GetBool("Profiling", "EnableInstanceTracking") || audioEngine.bFirstPlayLatencyEnabled
+		|| audioEngine.mCallbackProfiler || audioEngine.mJournal || audioEngine.bOwnerAccountingEnabled;
+
 	// MASTER AND STRINGS BANK
 	const std::string bankOutputDirectory = config.GetString("Banks", "BankOutputDirectory") + "/" + AUDIO_PLATFORM + "/";
 	SetSoundBankRootDirectory(bankOutputDirectory);
+	audioEngine.bPreloadSampleData = config.GetBool("Advanced", "PreloadSampleData");
 
 	const bool bIsMainBankLoaded = LoadSoundBankFile(config.GetString("Banks", "MasterBank"));
 	const bool bIsStringsBankLoaded = LoadSoundBankFile(config.GetString("Banks", "MasterStringsBank"));
 
 	audioEngine.bMainBanksLoaded = bIsMainBankLoaded && bIsStringsBankLoaded;
 
+	// BUS METERING
+	for (const auto& busPath : config.GetStringArray("Metering", "MeteredBuses"))
+	{
+		EnableBusMetering(busPath);
+	}
+
 	return audioEngine.mStudioSystem->isValid() && audioEngine.bMainBanksLoaded;
 }
 
@@ -190,8 +410,26 @@ void AudioEngine::Terminate()
 {
 	if (AudioEngine& audioEngine = Get(); audioEngine.mStudioSystem->isValid())
 	{
+		if (audioEngine.bFirstPlayLatencyEnabled) { DumpEventLatencyStats(std::cout); }
+		if (audioEngine.mCallbackProfiler) { DumpCallbackStats(std::cout); }
+		if (audioEngine.bBufferAutoSizingEnabled) { audioEngine.SaveLearnedBufferSizes(); }
+		StopCommandCapture();
+
+		audioEngine.mMeteredBuses.clear();
+		audioEngine.mLoadedBanks.clear();
+		audioEngine.mOwnedSampleData.clear();
 		audioEngine.mStudioSystem->release();
 		audioEngine.mStudioSystem = nullptr;
+		audioEngine.mMasterChannelGroup = nullptr;
+		audioEngine.mEventLatencyStats.clear();
+		audioEngine.mEventCallbackStats.clear();
+		audioEngine.mCallbackProfiler.reset();
+
+		// After release, which closes the remaining file handles and resolves their access kind
+		if (audioEngine.mFileTracer) { audioEngine.mFileTracer->DumpStats(std::cout); }
+		audioEngine.mFileTracer.reset();
+		audioEngine.mJournal.reset();
+		audioEngine.mLogger.reset(); // Joins the writer thread after printing what is left in the ring
 #if WIN32 // Refer to: https://www.fmod.com/docs/2.03/api/platforms-win.html#com
 		CoUninitialize();
 #endif
@@ -200,7 +438,44 @@ void AudioEngine::Terminate()
 
 void AudioEngine::Update()
 {
-	if (IsInitialized()) { Get().mStudioSystem->update(); }
+	if (!IsInitialized()) { return; }
+
+	HitchWatchdog::Heartbeat(WatchdogChannel::AudioUpdate);
+	WatchdogPhase phase("AudioEngine::Update");
+
+	AudioEngine& audioEngine = Get();
+	const int64_t now = GetSteadyTimeNs();
+	const int64_t frameDeltaNs = audioEngine.mLastUpdateCallNs != 0 ? now - audioEngine.mLastUpdateCallNs : 0;
+	audioEngine.mLastUpdateCallNs = now;
+
+	AudioUpdateController& updateController = audioEngine.mUpdateController;
+	if (updateController.IsAdjustDue(now))
+	{
+		FMOD_CPU_USAGE coreCPU {};
+		FMOD_STUDIO_BUFFER_USAGE bufferUsage {};
+		audioEngine.mStudioSystem->getCPUUsage(nullptr, &coreCPU);
+		audioEngine.mStudioSystem->getBufferUsage(&bufferUsage);
+		const FMOD_STUDIO_BUFFER_INFO& commandQueue = bufferUsage.studiocommandqueue;
+		const float commandQueuePercent = commandQueue.capacity > 0
+			? 100.0f * static_cast<float>(commandQueue.currentusage) / static_cast<float>(commandQueue.capacity) : 0.0f;
+		updateController.Adjust(now, coreCPU.dsp, commandQueuePercent);
+	}
+
+	if (updateController.ShouldSubmit(now, frameDeltaNs))
+	{
+		audioEngine.mStudioSystem->update();
+		updateController.OnSubmitted(GetSteadyTimeNs() - now);
+	}
+	++audioEngine.mUpdateIndex;
+
+	audioEngine.UpdateBusMetering();
+	audioEngine.UpdateStats();
+	audioEngine.UpdateOwners();
+
+	if (audioEngine.mCallbackProfiler)
+	{
+		audioEngine.mCallbackProfiler->ReportBudgetOverruns(std::cout);
+	}
 }
 
 bool AudioEngine::IsInitialized()
@@ -224,13 +499,49 @@ bool AudioEngine::LoadSoundBankFile(const std::string& filePath)
 
 bool AudioEngine::LoadSoundBankFile(const std::string& filePath, AudioBank*& outBankPtr)
 {
-	const AudioEngine& audioEngine = Get();
+	AudioEngine& audioEngine = Get();
 	if (!audioEngine.mStudioSystem->isValid()) { return false; }
 
+	WatchdogPhase phase("AudioEngine::LoadSoundBankFile");
+	AudioFileTracer::BankLoadScope bankLoadScope(audioEngine.mFileTracer.get());
 	const std::string fullBankPath = audioEngine.mSoundBankRootDirectory + filePath;
+	int memoryBefore = 0;
+	int memoryAfter = 0;
+	int memoryMax = 0;
+	FMOD::Memory_GetStats(&memoryBefore, &memoryMax, false);
+
+	const int64_t loadStartNs = GetSteadyTimeNs();
 	const FMOD_RESULT result = audioEngine.mStudioSystem->loadBankFile(fullBankPath.c_str(),
 		FMOD_STUDIO_LOAD_BANK_NORMAL, &outBankPtr);
 
+	if (AudioJournal* journal = audioEngine.mJournal.get())
+	{
+		journal->Record(JOURNAL_OP_BANK_LOAD, result == FMOD_OK ? outBankPtr : nullptr, journal->RegisterName(filePath), result);
+	}
+
+	if (result == FMOD_OK)
+	{
+		FMOD::Memory_GetStats(&memoryAfter, &memoryMax, false);
+
+		LoadedBank& loadedBank = audioEngine.mLoadedBanks[outBankPtr];
+		loadedBank.loadTimeMs = static_cast<float>(GetSteadyTimeNs() - loadStartNs) * 1e-6f;
+		loadedBank.ownerIndex = audioEngine.mActiveOwnerIndex;
+		loadedBank.memoryBytes = std::max(memoryAfter - memoryBefore, 0);
+
+		if (loadedBank.ownerIndex != AUDIO_OWNER_NONE)
+		{
+			AudioOwnerStats& ownerStats = audioEngine.mOwners[loadedBank.ownerIndex].stats;
+			++ownerStats.bankCount;
+			ownerStats.bankMemoryBytes += loadedBank.memoryBytes;
+		}
+
+		// The samples are resident before anything plays, instead of arriving whenever the loading thread is done
+		if (audioEngine.bPreloadSampleData)
+		{
+			outBankPtr->loadSampleData();
+			audioEngine.mStudioSystem->flushSampleLoading();
+		}
+	}
 	return result == FMOD_OK;
 }
 
@@ -250,9 +561,37 @@ bool AudioEngine::UnloadSoundBank(const std::string& studioPath)
 
 bool AudioEngine::UnloadSoundBank(AudioBank* bank)
 {
-	if (!(Get().mStudioSystem->isValid() && bank)) { return false; }
+	AudioEngine& audioEngine = Get();
+	if (!(audioEngine.mStudioSystem->isValid() && bank)) { return false; }
+
 	const FMOD_RESULT result = bank->unload();
-	return result == FMOD_OK;
+	if (audioEngine.mJournal) { audioEngine.mJournal->Record(JOURNAL_OP_BANK_UNLOAD, bank, 0, result); }
+	if (result != FMOD_OK) { return false; }
+
+	if (const auto it = audioEngine.mLoadedBanks.find(bank); it != audioEngine.mLoadedBanks.end())
+	{
+		if (it->second.ownerIndex != AUDIO_OWNER_NONE)
+		{
+			AudioOwnerStats& ownerStats = audioEngine.mOwners[it->second.ownerIndex].stats;
+			--ownerStats.bankCount;
+			ownerStats.bankMemoryBytes -= it->second.memoryBytes;
+		}
+		audioEngine.mLoadedBanks.erase(it);
+	}
+	return true;
+}
+
+void AudioEngine::UnloadAllSoundBanks()
+{
+	std::vector<AudioBank*> banks;
+	for (const auto& bank : Get().mLoadedBanks | std::views::keys)
+	{
+		banks.push_back(const_cast<AudioBank*>(bank));
+	}
+	for (AudioBank* bank : banks)
+	{
+		UnloadSoundBank(bank);
+	}
 }
 
 // Events
@@ -262,27 +601,100 @@ AudioInstance* AudioEngine::PlayAudioEvent(const std::string& studioPath, const
 {
 	if (!IsInitialized()) { return nullptr; }
 
+	AudioEngine& audioEngine = Get();
+	const int64_t playRequestTimeNs = audioEngine.bFirstPlayLatencyEnabled ? GetSteadyTimeNs() : 0;
+
 	FMOD::Studio::EventDescription* description = nullptr;
 	AudioInstance* instance = nullptr;
 
-	FMOD_RESULT result = Get().mStudioSystem->getEvent(studioPath.c_str(), &description);
+	FMOD_RESULT result = audioEngine.mStudioSystem->getEvent(studioPath.c_str(), &description);
 	if (result != FMOD_OK) { return nullptr; }
 
+	// The first instance of an event starts loading its sample data, which is charged to the active owner
+	if (audioEngine.bOwnerAccountingEnabled && audioEngine.mActiveOwnerIndex != AUDIO_OWNER_NONE
+		&& !audioEngine.mOwnedSampleData.contains(description))
+	{
+		FMOD_STUDIO_LOADING_STATE sampleLoadingState = FMOD_STUDIO_LOADING_STATE_UNLOADED;
+		if (description->getSampleLoadingState(&sampleLoadingState) == FMOD_OK && sampleLoadingState == FMOD_STUDIO_LOADING_STATE_UNLOADED)
+		{
+			int memoryCurrent = 0;
+			FMOD::Memory_GetStats(&memoryCurrent, nullptr, false);
+
+			OwnedSampleData& sampleData = audioEngine.mOwnedSampleData[description];
+			sampleData.ownerIndex = audioEngine.mActiveOwnerIndex;
+			sampleData.memoryBeforeBytes = memoryCurrent;
+		}
+	}
+
 	result = description->createInstance(&instance);
 	if (result != FMOD_OK) { return nullptr; }
+	++audioEngine.mEventsPlayed;
 
-	instance->set3DAttributes(&audio3dAttributes);
-
-	if (userData)
+	if (AudioJournal* journal = audioEngine.mJournal.get())
 	{
-		instance->setUserData(userData);
+		const FMOD_VECTOR& position = audio3dAttributes.position;
+		journal->Record(JOURNAL_OP_PLAY, instance, journal->RegisterName(studioPath), autoStart, position.x, position.y, position.z);
 	}
 
-	if (callback)
+	instance->set3DAttributes(&audio3dAttributes);
+
+	TrackedAudioInstance* record = audioEngine.bInstanceTrackingEnabled ? audioEngine.mInstanceTracker->Acquire() : nullptr;
+	if (record)
 	{
-		instance->setCallback(callback, callbackType);
+		record->instance = instance;
+		record->userData = userData;
+		record->userCallback.store(callback, std::memory_order_relaxed);
+		record->userCallbackMask.store(callback ? callbackType : 0, std::memory_order_relaxed);
+
+		if (audioEngine.mCallbackProfiler)
+		{
+			record->callbackStats = audioEngine.GetOrCreateEventCallbackStats(studioPath);
+		}
+
+		if (audioEngine.bOwnerAccountingEnabled && audioEngine.mActiveOwnerIndex != AUDIO_OWNER_NONE)
+		{
+			record->ownerIndex = audioEngine.mActiveOwnerIndex;
+			audioEngine.mOwners[record->ownerIndex].liveInstances.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		AudioCallbackType engineCallbackMask = FMOD_STUDIO_EVENT_CALLBACK_DESTROYED;
+		if (audioEngine.bFirstPlayLatencyEnabled)
+		{
+			record->latencyStats = audioEngine.GetOrCreateEventLatencyStats(studioPath);
+			record->playRequestTimeNs = playRequestTimeNs;
+			if (audioEngine.mMasterChannelGroup)
+			{
+				audioEngine.mMasterChannelGroup->getDSPClock(&record->playRequestDSPClock, nullptr);
+			}
+			engineCallbackMask |= FMOD_STUDIO_EVENT_CALLBACK_STARTED | FMOD_STUDIO_EVENT_CALLBACK_SOUND_PLAYED;
+		}
+
+		instance->setUserData(record);
+		instance->setCallback(AudioEngineEventCallback, engineCallbackMask | (callback ? callbackType : 0));
 	}
+	else
+	{
+		if (audioEngine.bInstanceTrackingEnabled)
+		{
+			// Record pool exhausted, the instance is not tracked. Logged on the 1st, 2nd, 4th, 8th... drop.
+			if (const uint64_t droppedCount = audioEngine.mInstanceTracker->GetDroppedCount(); std::has_single_bit(droppedCount))
+			{
+				std::cout << std::format("AudioEngine: {} untracked instances (latency, owner and journal stats lost), "
+					"all {} tracking records are in use, raise [Profiling] TrackedInstanceCapacity",
+					droppedCount, audioEngine.mInstanceTracker->GetCapacity()) << std::endl;
+			}
+		}
+
+		if (userData)
+		{
+			instance->setUserData(userData);
+		}
 
+		if (callback)
+		{
+			instance->setCallback(callback, callbackType);
+		}
+	}
 
 	if (autoStart)
 	{
@@ -296,11 +708,21 @@ AudioInstance* AudioEngine::PlayAudioEvent(const std::string& studioPath, const
 	return instance;
 }
 
+bool AudioEngine::EventIs3D(const std::string& studioPath, bool& outIs3D)
+{
+	if (!IsInitialized()) { return false; }
+
+	FMOD::Studio::EventDescription* description = nullptr;
+	if (Get().mStudioSystem->getEvent(studioPath.c_str(), &description) != FMOD_OK) { return false; }
+	return description->is3D(&outIs3D) == FMOD_OK;
+}
+
 // Audio Instances
 
 bool AudioEngine::InstanceStart(AudioInstance* instance)
 {
 	if (!(IsInitialized() && instance && instance->isValid())) { return false; }
+	if (const AudioEngine& audioEngine = Get(); audioEngine.mJournal) { audioEngine.mJournal->Record(JOURNAL_OP_START, instance); }
 	const FMOD_RESULT result = instance->start();
 	return result == FMOD_OK;
 }
@@ -308,6 +730,7 @@ bool AudioEngine::InstanceStart(AudioInstance* instance)
 bool AudioEngine::InstanceStop(AudioInstance* instance, const bool bAllowFadeOut)
 {
 	if (!(IsInitialized() && instance && instance->isValid())) { return false; }
+	if (const AudioEngine& audioEngine = Get(); audioEngine.mJournal) { audioEngine.mJournal->Record(JOURNAL_OP_STOP, instance, 0, bAllowFadeOut); }
 	const FMOD_RESULT result = instance->stop(bAllowFadeOut ? FMOD_STUDIO_STOP_ALLOWFADEOUT : FMOD_STUDIO_STOP_IMMEDIATE);
 	return result == FMOD_OK;
 }
@@ -315,6 +738,7 @@ bool AudioEngine::InstanceStop(AudioInstance* instance, const bool bAllowFadeOut
 bool AudioEngine::InstanceRelease(AudioInstance* instance)
 {
 	if (!(IsInitialized() && instance && instance->isValid())) { return false; }
+	if (const AudioEngine& audioEngine = Get(); audioEngine.mJournal) { audioEngine.mJournal->Record(JOURNAL_OP_RELEASE, instance); }
 	const FMOD_RESULT result = instance->release();
 	return result == FMOD_OK;
 }
@@ -326,6 +750,18 @@ bool AudioEngine::InstanceSetPaused(AudioInstance* instance, const bool bPaused)
 	return result == FMOD_OK;
 }
 
+bool AudioEngine::InstanceSet3DAttributes(AudioInstance* instance, const Audio3DAttributes& audio3dAttributes)
+{
+	if (!(IsInitialized() && instance && instance->isValid())) { return false; }
+	if (const AudioEngine& audioEngine = Get(); audioEngine.mJournal)
+	{
+		const FMOD_VECTOR& position = audio3dAttributes.position;
+		audioEngine.mJournal->Record(JOURNAL_OP_3D_ATTRIBUTES, instance, 0, 0, position.x, position.y, position.z);
+	}
+	const FMOD_RESULT result = instance->set3DAttributes(&audio3dAttributes);
+	return result == FMOD_OK;
+}
+
 // Parameters
 
 bool AudioEngine::InstanceIsPaused(const AudioInstance* instance, bool& outPaused)
@@ -348,11 +784,53 @@ bool AudioEngine::InstanceIsPlaying(const AudioInstance* instance, bool& outPlay
 	return result == FMOD_OK;
 }
 
+bool AudioEngine::InstanceGetUserData(const AudioInstance* instance, void*& outUserData)
+{
+	if (!(sInstance && instance && instance->isValid())) { return false; }
+
+	void* userData = nullptr;
+	if (instance->getUserData(&userData) != FMOD_OK) { return false; }
+
+	const auto& tracker = sInstance->mInstanceTracker;
+	outUserData = tracker && tracker->Owns(userData) ? static_cast<TrackedAudioInstance*>(userData)->userData : userData;
+	return true;
+}
+
+bool AudioEngine::InstanceSetCallback(AudioInstance* instance, const AudioEventCallback callback, const AudioCallbackType callbackType)
+{
+	if (!(IsInitialized() && instance && instance->isValid())) { return false; }
+
+	void* userData = nullptr;
+	instance->getUserData(&userData);
+
+	if (!Get().mInstanceTracker->Owns(userData))
+	{
+		return instance->setCallback(callback, callbackType) == FMOD_OK;
+	}
+
+	auto* record = static_cast<TrackedAudioInstance*>(userData);
+	const AudioCallbackType userCallbackMask = callback ? callbackType : 0;
+	record->userCallbackMask.store(userCallbackMask, std::memory_order_relaxed);
+	record->userCallback.store(callback, std::memory_order_release);
+
+	AudioCallbackType engineCallbackMask = FMOD_STUDIO_EVENT_CALLBACK_DESTROYED;
+	if (record->latencyStats)
+	{
+		engineCallbackMask |= FMOD_STUDIO_EVENT_CALLBACK_STARTED | FMOD_STUDIO_EVENT_CALLBACK_SOUND_PLAYED;
+	}
+	return instance->setCallback(AudioEngineEventCallback, engineCallbackMask | userCallbackMask) == FMOD_OK;
+}
+
 bool AudioEngine::SetGlobalParameterByName(const std::string& name,
 			const float value, const bool bIgnoreSeekSpeed)
 {
 	if (!IsInitialized()) { return false; }
-	const FMOD_RESULT result = Get().mStudioSystem->setParameterByName(name.c_str(), value, bIgnoreSeekSpeed);
+	AudioEngine& audioEngine = Get();
+	if (AudioJournal* journal = audioEngine.mJournal.get())
+	{
+		journal->Record(JOURNAL_OP_PARAMETER, nullptr, journal->RegisterName(name), 0, value);
+	}
+	const FMOD_RESULT result = audioEngine.mStudioSystem->setParameterByName(name.c_str(), value, bIgnoreSeekSpeed);
 	return result == FMOD_OK;
 }
 
@@ -360,7 +838,12 @@ bool AudioEngine::SetGlobalParameterByNameWithLabel(const std::string& name,
 	const std::string& label, const bool bIgnoreSeekSpeed)
 {
 	if (!IsInitialized()) { return false; }
-	const FMOD_RESULT result = Get().mStudioSystem->setParameterByNameWithLabel(name.c_str(), label.c_str(), bIgnoreSeekSpeed);
+	AudioEngine& audioEngine = Get();
+	if (AudioJournal* journal = audioEngine.mJournal.get())
+	{
+		journal->Record(JOURNAL_OP_PARAMETER_LABEL, nullptr, journal->RegisterName(name), journal->RegisterName(label));
+	}
+	const FMOD_RESULT result = audioEngine.mStudioSystem->setParameterByNameWithLabel(name.c_str(), label.c_str(), bIgnoreSeekSpeed);
 	return result == FMOD_OK;
 }
 
@@ -368,7 +851,10 @@ bool AudioEngine::SetParameterByName(AudioInstance* instance, const std::string&
 	const float value, const bool bIgnoreSeekSpeed)
 {
 	if (!(instance && instance->isValid() && IsInitialized())) { return false; }
-
+	if (AudioJournal* journal = Get().mJournal.get())
+	{
+		journal->Record(JOURNAL_OP_PARAMETER, instance, journal->RegisterName(name), 0, value);
+	}
 	const FMOD_RESULT result = instance->setParameterByName(name.c_str(), value, bIgnoreSeekSpeed);
 	return result == FMOD_OK;
 }
@@ -377,10 +863,59 @@ bool AudioEngine::SetParameterByNameWithLabel(AudioInstance* instance,
 			const std::string& name, const std::string& label, const bool bIgnoreSeekSpeed)
 {
 	if (!(instance && instance->isValid() && IsInitialized())) { return false; }
+	if (AudioJournal* journal = Get().mJournal.get())
+	{
+		journal->Record(JOURNAL_OP_PARAMETER_LABEL, instance, journal->RegisterName(name), journal->RegisterName(label));
+	}
 	const FMOD_RESULT result = instance->setParameterByNameWithLabel(name.c_str(), label.c_str(), bIgnoreSeekSpeed);
 	return result == FMOD_OK;
 }
 
+bool AudioEngine::GetGlobalParameterID(const std::string& name, AudioParameterID& outParameterID)
+{
+	if (!IsInitialized()) { return false; }
+	FMOD_STUDIO_PARAMETER_DESCRIPTION description = {};
+	const FMOD_RESULT result = Get().mStudioSystem->getParameterDescriptionByName(name.c_str(), &description);
+	outParameterID = description.id;
+	return result == FMOD_OK;
+}
+
+bool AudioEngine::GetParameterID(const AudioInstance* instance, const std::string& name, AudioParameterID& outParameterID)
+{
+	if (!(instance && instance->isValid() && IsInitialized())) { return false; }
+	FMOD::Studio::EventDescription* eventDescription = nullptr;
+	if (instance->getDescription(&eventDescription) != FMOD_OK) { return false; }
+
+	FMOD_STUDIO_PARAMETER_DESCRIPTION description = {};
+	const FMOD_RESULT result = eventDescription->getParameterDescriptionByName(name.c_str(), &description);
+	outParameterID = description.id;
+	return result == FMOD_OK;
+}
+
+bool AudioEngine::SetGlobalParameterByID(const AudioParameterID parameterID, const float value, const bool bIgnoreSeekSpeed)
+{
+	if (!IsInitialized()) { return false; }
+	AudioEngine& audioEngine = Get();
+	if (audioEngine.mJournal)
+	{
+		audioEngine.mJournal->Record(JOURNAL_OP_PARAMETER, nullptr, 0, parameterID.data1, value);
+	}
+	const FMOD_RESULT result = audioEngine.mStudioSystem->setParameterByID(parameterID, value, bIgnoreSeekSpeed);
+	return result == FMOD_OK;
+}
+
+bool AudioEngine::SetParameterByID(AudioInstance* instance, const AudioParameterID parameterID,
+	const float value, const bool bIgnoreSeekSpeed)
+{
+	if (!(instance && instance->isValid() && IsInitialized())) { return false; }
+	if (AudioJournal* journal = Get().mJournal.get())
+	{
+		journal->Record(JOURNAL_OP_PARAMETER, instance, 0, parameterID.data1, value);
+	}
+	const FMOD_RESULT result = instance->setParameterByID(parameterID, value, bIgnoreSeekSpeed);
+	return result == FMOD_OK;
+}
+
 // Buses
 
 bool AudioEngine::GetBus(const std::string& studioPath, AudioBus*& outBusPtr)
@@ -474,44 +1009,390 @@ bool AudioEngine::VCA_SetVolume(AudioVCA* vca, const float Volume)
 	return result == FMOD_OK;
 }
 
-// Plugins
+// Metering
 
-void AudioEngine::RegisterAdditionalPlugins(const std::vector<std::string>& pluginNames, const std::string& rootPath)
+bool AudioEngine::EnableBusMetering(const std::string& studioPath)
 {
-	if (!mStudioSystem->isValid()) { return; }
+	if (!IsInitialized()) { return false; }
 
-	FMOD::System* coreSystem = nullptr;
-	mStudioSystem->getCoreSystem(&coreSystem);
-	coreSystem->setPluginPath(rootPath.c_str());
+	AudioEngine& audioEngine = Get();
+	if (std::ranges::any_of(audioEngine.mMeteredBuses,
+		[&studioPath](const MeteredBus& meteredBus) { return meteredBus.path == studioPath; }))
+	{
+		return true;
+	}
+	if (audioEngine.mMeteredBuses.size() >= AUDIO_METERING_MAX_BUSES) { return false; }
 
-	for (const auto& additionalPluginName : pluginNames)
+	AudioBus* bus = nullptr;
+	if (!GetBus(studioPath, bus)) { return false; }
+
+	// The channel group is created asynchronously, the head DSP is resolved in UpdateBusMetering
+	if (bus->lockChannelGroup() != FMOD_OK) { return false; }
+
+	audioEngine.mMeteredBuses.push_back({studioPath, bus, nullptr});
+	return true;
+}
+
+bool AudioEngine::DisableBusMetering(const std::string& studioPath)
+{
+	if (!IsInitialized()) { return false; }
+
+	AudioEngine& audioEngine = Get();
+	const auto it = std::ranges::find_if(audioEngine.mMeteredBuses,
+		[&studioPath](const MeteredBus& meteredBus) { return meteredBus.path == studioPath; });
+	if (it == audioEngine.mMeteredBuses.end()) { return false; }
+
+	if (it->headDSP) { it->headDSP->setMeteringEnabled(false, false); }
+	it->bus->unlockChannelGroup();
+	audioEngine.mMeteredBuses.erase(it);
+	return true;
+}
+
+bool AudioEngine::GetBusMeteringSnapshot(AudioBusMeteringSnapshot& outSnapshot)
+{
+	return sInstance && sInstance->mBusMeteringSnapshot.Read(outSnapshot);
+}
+
+bool AudioEngine::GetBusMeter(const std::string& studioPath, AudioBusMeter& outMeter)
+{
+	AudioBusMeteringSnapshot snapshot;
+	if (!GetBusMeteringSnapshot(snapshot)) { return false; }
+
+	for (int i = 0; i < snapshot.busCount; ++i)
 	{
-		uint32_t additionalPluginHandle = 0;
-		if (const FMOD_RESULT result = coreSystem->loadPlugin(additionalPluginName.c_str(), &additionalPluginHandle);
-			result == FMOD_OK)
+		if (studioPath == snapshot.buses[i].path)
 		{
-			additionalPluginHandles.emplace(std::pair(additionalPluginName, additionalPluginHandle));
+			outMeter = snapshot.buses[i];
+			return outMeter.bIsValid;
 		}
 	}
+	return false;
 }
 
-// Helpers
-
-bool AudioEngine::GetAudioDriverIndexByName(const std::string& audioDriverName, int& outDriverIndex) const
+void AudioEngine::UpdateBusMetering()
 {
-	if (!mStudioSystem->isValid()) { return false; }
+	if (mMeteredBuses.empty()) { return; }
 
-	FMOD::System* coreSystem = nullptr;
-	mStudioSystem->getCoreSystem(&coreSystem);
-
-	if (!coreSystem) { return false; }
+	AudioBusMeteringSnapshot snapshot;
+	snapshot.updateIndex = mUpdateIndex;
+	snapshot.busCount = static_cast<int>(mMeteredBuses.size());
 
-	if (!audioDriverName.empty())
+	for (int i = 0; i < snapshot.busCount; ++i)
 	{
-		int driverCount;
-		coreSystem->getNumDrivers(&driverCount);
+		MeteredBus& meteredBus = mMeteredBuses[i];
+		AudioBusMeter& meter = snapshot.buses[i];
+		meteredBus.path.copy(meter.path, AUDIO_METERING_MAX_PATH - 1);
 
-		for (int i = 0; i < driverCount; i++)
+		if (!meteredBus.headDSP)
+		{
+			FMOD::ChannelGroup* channelGroup = nullptr;
+			if (meteredBus.bus->getChannelGroup(&channelGroup) != FMOD_OK
+				|| channelGroup->getDSP(FMOD_CHANNELCONTROL_DSP_HEAD, &meteredBus.headDSP) != FMOD_OK
+				|| meteredBus.headDSP->setMeteringEnabled(false, true) != FMOD_OK)
+			{
+				meteredBus.headDSP = nullptr;
+				continue;
+			}
+		}
+
+		FMOD_DSP_METERING_INFO outputInfo = {};
+		if (meteredBus.headDSP->getMeteringInfo(nullptr, &outputInfo) != FMOD_OK) { continue; }
+
+		meter.numChannels = std::min(static_cast<int>(outputInfo.numchannels), AUDIO_METERING_MAX_CHANNELS);
+		std::copy_n(outputInfo.peaklevel, meter.numChannels, meter.peak);
+		std::copy_n(outputInfo.rmslevel, meter.numChannels, meter.rms);
+		meter.bIsValid = true;
+	}
+
+	mBusMeteringSnapshot.Publish(snapshot);
+}
+
+// Owners
+
+void AudioEngine::SetActiveOwner(const std::string& ownerName)
+{
+	AudioEngine& audioEngine = Get();
+	if (!audioEngine.bOwnerAccountingEnabled) { return; }
+
+	audioEngine.mActiveOwnerIndex = audioEngine.GetOrCreateOwner(ownerName);
+}
+
+void AudioEngine::GetOwnerStats(std::vector<AudioOwnerStats>& outStats)
+{
+	const AudioEngine& audioEngine = Get();
+
+	outStats.clear();
+	for (int i = 0; i < audioEngine.mOwnerCount; ++i)
+	{
+		outStats.push_back(audioEngine.mOwners[i].stats);
+	}
+}
+
+bool AudioEngine::IsOwnerAccountingEnabled()
+{
+	return Get().bOwnerAccountingEnabled;
+}
+
+int AudioEngine::GetOrCreateOwner(const std::string& ownerName)
+{
+	for (int i = 0; i < mOwnerCount; ++i)
+	{
+		if (mOwners[i].stats.name == ownerName) { return i; }
+	}
+
+	if (mOwnerCount >= AUDIO_MAX_OWNERS)
+	{
+		std::cout << "FMOD Budget: too many owners, '" << ownerName << "' is not tracked" << std::endl;
+		return AUDIO_OWNER_NONE;
+	}
+
+	AudioOwnerStats& ownerStats = mOwners[mOwnerCount].stats;
+	ownerStats.name = ownerName;
+	if (const auto it = mOwnerBudgets.find(ownerName); it != mOwnerBudgets.end())
+	{
+		ownerStats.budget = it->second;
+	}
+	return mOwnerCount++;
+}
+
+void AudioEngine::ReportBufferStalls(const FMOD_STUDIO_BUFFER_USAGE& bufferUsage)
+{
+	const int64_t now = GetSteadyTimeNs();
+	if (now - mBufferStallsReportedNs < BUFFER_STALL_REPORT_INTERVAL_NS) { return; }
+
+	const auto reportStalls = [](const char* bufferName, const FMOD_STUDIO_BUFFER_INFO& info, const FMOD_STUDIO_BUFFER_INFO& reported)
+	{
+		if (info.stallcount <= reported.stallcount) { return false; }
+
+		std::cout << std::format("AudioEngine: Studio {} stalled the game thread {} times ({:.2f} ms), peak {} of {} bytes",
+			bufferName, info.stallcount - reported.stallcount, (info.stalltime - reported.stalltime) * 1000.0f,
+			info.peakusage, info.capacity) << std::endl;
+		return true;
+	};
+
+	const bool bCommandQueueStalled = reportStalls("command queue", bufferUsage.studiocommandqueue, mReportedBufferUsage.studiocommandqueue);
+	const bool bHandleBufferStalled = reportStalls("handle buffer", bufferUsage.studiohandle, mReportedBufferUsage.studiohandle);
+	if (bCommandQueueStalled || bHandleBufferStalled)
+	{
+		mReportedBufferUsage = bufferUsage;
+		mBufferStallsReportedNs = now;
+	}
+}
+
+void AudioEngine::SaveLearnedBufferSizes() const
+{
+	FMOD_STUDIO_BUFFER_USAGE bufferUsage = {};
+	if (mStudioSystem->getBufferUsage(&bufferUsage) != FMOD_OK) { return; }
+
+	std::ofstream file(mLearnedBufferSizesPath);
+	if (!file.is_open()) { return; }
+
+	file << "# Written by AudioEngine::Terminate from the Studio buffer usage of the last run, applied on the next start" << std::endl;
+	file << "# Delete this file to go back to the [Advanced] sizes of audio_engine.ini" << std::endl;
+	file << "[" << LEARNED_BUFFER_SIZES_SECTION << "]" << std::endl;
+	file << "CommandQueueSize=" << LearnStudioBufferSize(bufferUsage.studiocommandqueue, mCommandQueueSize) << std::endl;
+	file << "HandleInitialSize=" << LearnStudioBufferSize(bufferUsage.studiohandle, mHandleInitialSize) << std::endl;
+}
+
+void AudioEngine::UpdateOwners()
+{
+	if (!bOwnerAccountingEnabled || mOwnerCount == 0) { return; }
+
+	// Voices and callback time are sampled a few times per second, walking the instance channel groups is not free
+	const int64_t now = GetSteadyTimeNs();
+	const bool bSample = now - mOwnersSampledNs >= OWNER_SAMPLE_INTERVAL_NS;
+
+	// Pending sample loads are polled every update to keep the measured window short, unloads only when sampling
+	for (auto it = mOwnedSampleData.begin(); it != mOwnedSampleData.end();)
+	{
+		const FMOD::Studio::EventDescription* description = it->first;
+		OwnedSampleData& sampleData = it->second;
+		if (sampleData.bLoaded && !bSample)
+		{
+			++it;
+			continue;
+		}
+
+		FMOD_STUDIO_LOADING_STATE sampleLoadingState = FMOD_STUDIO_LOADING_STATE_UNLOADED;
+		int instanceCount = 0;
+		const bool bValid = description->isValid() && description->getSampleLoadingState(&sampleLoadingState) == FMOD_OK
+			&& description->getInstanceCount(&instanceCount) == FMOD_OK;
+		AudioOwnerStats& ownerStats = mOwners[sampleData.ownerIndex].stats;
+
+		if (!sampleData.bLoaded && bValid && sampleLoadingState == FMOD_STUDIO_LOADING_STATE_LOADED)
+		{
+			int memoryCurrent = 0;
+			FMOD::Memory_GetStats(&memoryCurrent, nullptr, false);
+			sampleData.memoryBytes = std::max<int64_t>(memoryCurrent - sampleData.memoryBeforeBytes, 0);
+			sampleData.bLoaded = true;
+			ownerStats.sampleMemoryBytes += sampleData.memoryBytes;
+		}
+		else if (!bValid || sampleLoadingState == FMOD_STUDIO_LOADING_STATE_ERROR
+			|| (sampleLoadingState == FMOD_STUDIO_LOADING_STATE_UNLOADED && (sampleData.bLoaded || instanceCount == 0)))
+		{
+			ownerStats.sampleMemoryBytes -= sampleData.memoryBytes;
+			it = mOwnedSampleData.erase(it);
+			continue;
+		}
+		++it;
+	}
+
+	if (bSample)
+	{
+		std::array<int, AUDIO_MAX_OWNERS> voices {};
+		mInstanceTracker->ForEachInUse([this, &voices](const TrackedAudioInstance& record)
+		{
+			FMOD::ChannelGroup* channelGroup = nullptr;
+			if (record.ownerIndex != AUDIO_OWNER_NONE && record.ownerIndex < mOwnerCount && record.instance
+				&& record.instance->getChannelGroup(&channelGroup) == FMOD_OK)
+			{
+				voices[record.ownerIndex] += CountPlayingChannels(channelGroup, 0);
+			}
+		});
+
+		const double elapsedSeconds = mOwnersSampledNs == 0 ? 0.0 : static_cast<double>(now - mOwnersSampledNs) * 1e-9;
+		for (int i = 0; i < mOwnerCount; ++i)
+		{
+			AudioOwner& owner = mOwners[i];
+			const uint64_t callbackTimeNs = owner.callbackTimeNs.load(std::memory_order_relaxed);
+			owner.stats.voices = voices[i];
+			owner.stats.callbackUsPerSecond = elapsedSeconds > 0.0
+				? static_cast<float>(static_cast<double>(callbackTimeNs - owner.callbackTimeWindowStartNs) * 1e-3 / elapsedSeconds)
+				: 0.0f;
+			owner.callbackTimeWindowStartNs = callbackTimeNs;
+		}
+		mOwnersSampledNs = now;
+	}
+
+	for (int i = 0; i < mOwnerCount; ++i)
+	{
+		AudioOwnerStats& stats = mOwners[i].stats;
+		stats.liveInstances = mOwners[i].liveInstances.load(std::memory_order_relaxed);
+
+		const AudioOwnerBudget& budget = stats.budget;
+		const std::array<std::tuple<AudioOwnerBudgetFlags, const char*, double, double>, 6> checks = {{
+			{AUDIO_OWNER_BUDGET_BANKS, "MaxBanks", stats.bankCount, budget.maxBanks},
+			{AUDIO_OWNER_BUDGET_BANK_MEMORY, "MaxBankMemoryKB", stats.bankMemoryBytes / 1024.0, budget.maxBankMemoryBytes / 1024.0},
+			{AUDIO_OWNER_BUDGET_SAMPLE_MEMORY, "MaxSampleMemoryKB", stats.sampleMemoryBytes / 1024.0, budget.maxSampleMemoryBytes / 1024.0},
+			{AUDIO_OWNER_BUDGET_INSTANCES, "MaxInstances", stats.liveInstances, budget.maxInstances},
+			{AUDIO_OWNER_BUDGET_VOICES, "MaxVoices", stats.voices, budget.maxVoices},
+			{AUDIO_OWNER_BUDGET_CALLBACK_TIME, "MaxCallbackUsPerSecond", stats.callbackUsPerSecond, budget.maxCallbackUsPerSecond},
+		}};
+
+		uint32_t overBudgetMask = 0;
+		for (const auto& [flag, label, value, limit] : checks)
+		{
+			if (limit <= 0 || value <= limit) { continue; }
+
+			overBudgetMask |= flag;
+			if (!(stats.overBudgetMask & flag)) // Report when crossing, not every update
+			{
+				std::cout << std::format("FMOD Budget: '{}' exceeded {} ({:.1f} > {:.1f})", stats.name, label, value, limit) << std::endl;
+				if (bAssertOnBudgetOverflow) { std::abort(); }
+			}
+		}
+		stats.overBudgetMask = overBudgetMask;
+	}
+}
+
+// Stats
+
+bool AudioEngine::GetStatsSnapshot(AudioEngineStats& outStats)
+{
+	return sInstance && sInstance->mStatsSnapshot.Read(outStats);
+}
+
+void AudioEngine::UpdateStats()
+{
+	AudioEngineStats stats;
+	stats.updateIndex = mUpdateIndex;
+	stats.eventsPlayed = mEventsPlayed;
+	stats.activeInstances = mInstanceTracker->GetActiveCount();
+
+	if (const int64_t now = GetSteadyTimeNs(); now - mEventsPlayedWindowStartNs >= 1000000000)
+	{
+		if (mEventsPlayedWindowStartNs != 0)
+		{
+			mEventsPlayedPerSecond = static_cast<float>(static_cast<double>(mEventsPlayed - mEventsPlayedWindowStart)
+				* 1e9 / static_cast<double>(now - mEventsPlayedWindowStartNs));
+		}
+		mEventsPlayedWindowStart = mEventsPlayed;
+		mEventsPlayedWindowStartNs = now;
+	}
+	stats.eventsPlayedPerSecond = mEventsPlayedPerSecond;
+
+	mStudioSystem->getCPUUsage(&stats.studioCPU, &stats.coreCPU);
+	stats.studioUpdateMs = static_cast<float>(static_cast<double>(mUpdateController.GetLastUpdateNs()) * 1e-6);
+	stats.studioUpdateP99Ms = static_cast<float>(static_cast<double>(mUpdateController.GetUpdateHistogram().GetPercentile(99)) * 1e-6);
+	stats.studioUpdateIntervalMs = static_cast<float>(static_cast<double>(mUpdateController.GetLastIntervalNs()) * 1e-6);
+	stats.effectiveUpdatePeriodMs = mUpdateController.GetEffectivePeriodMs();
+	stats.updateSubmitCostPercent = mUpdateController.GetSubmitCostPercent();
+	stats.skippedUpdates = mUpdateController.GetSkippedCount();
+	mStudioSystem->getBufferUsage(&stats.bufferUsage);
+	ReportBufferStalls(stats.bufferUsage);
+	FMOD::Memory_GetStats(&stats.memoryCurrentBytes, &stats.memoryMaxBytes, false);
+
+	CoreSystem* coreSystem = nullptr;
+	if (mStudioSystem->getCoreSystem(&coreSystem) == FMOD_OK)
+	{
+		coreSystem->getChannelsPlaying(&stats.channelsPlaying, &stats.realChannelsPlaying);
+	}
+
+	std::array<AudioBank*, AUDIO_STATS_MAX_BANKS> banks {};
+	mStudioSystem->getBankList(banks.data(), AUDIO_STATS_MAX_BANKS, &stats.bankCount);
+	for (int i = 0; i < stats.bankCount; ++i)
+	{
+		AudioBankStats& bankStats = stats.banks[i];
+		banks[i]->getPath(bankStats.path, AUDIO_METERING_MAX_PATH, nullptr);
+		banks[i]->getLoadingState(&bankStats.loadingState);
+		banks[i]->getSampleLoadingState(&bankStats.sampleLoadingState);
+		if (const auto it = mLoadedBanks.find(banks[i]); it != mLoadedBanks.end())
+		{
+			bankStats.loadTimeMs = it->second.loadTimeMs;
+		}
+	}
+
+	mStatsSnapshot.Publish(stats);
+}
+
+// Plugins
+
+void AudioEngine::RegisterAdditionalPlugins(const std::vector<std::string>& pluginNames, const std::string& rootPath)
+{
+	if (!mStudioSystem->isValid()) { return; }
+
+	FMOD::System* coreSystem = nullptr;
+	mStudioSystem->getCoreSystem(&coreSystem);
+	coreSystem->setPluginPath(rootPath.c_str());
+
+	for (const auto& additionalPluginName : pluginNames)
+	{
+		uint32_t additionalPluginHandle = 0;
+		if (const FMOD_RESULT result = coreSystem->loadPlugin(additionalPluginName.c_str(), &additionalPluginHandle);
+			result == FMOD_OK)
+		{
+			additionalPluginHandles.emplace(std::pair(additionalPluginName, additionalPluginHandle));
+		}
+	}
+}
+
+// Helpers
+
+bool AudioEngine::GetAudioDriverIndexByName(const std::string& audioDriverName, int& outDriverIndex) const
+{
+	if (!mStudioSystem->isValid()) { return false; }
+
+	FMOD::System* coreSystem = nullptr;
+	mStudioSystem->getCoreSystem(&coreSystem);
+
+	if (!coreSystem) { return false; }
+
+	if (!audioDriverName.empty())
+	{
+		int driverCount;
+		coreSystem->getNumDrivers(&driverCount);
+
+		for (int i = 0; i < driverCount; i++)
 		{
 			char name[256] = {};
 			coreSystem->getDriverInfo(i, name, sizeof(name),
@@ -527,6 +1408,21 @@ bool AudioEngine::GetAudioDriverIndexByName(const std::string& audioDriverName,
 	return false;
 }
 
+bool AudioEngine::GetMixerClock(uint64_t& outSamples, int& outSampleRate)
+{
+	const AudioEngine& audioEngine = Get();
+	if (!(audioEngine.mStudioSystem && audioEngine.mStudioSystem->isValid() && audioEngine.mMasterChannelGroup)) { return false; }
+
+	CoreSystem* coreSystem = nullptr;
+	if (audioEngine.mStudioSystem->getCoreSystem(&coreSystem) != FMOD_OK) { return false; }
+	if (coreSystem->getSoftwareFormat(&outSampleRate, nullptr, nullptr) != FMOD_OK) { return false; }
+
+	unsigned long long dspClock = 0;
+	if (audioEngine.mMasterChannelGroup->getDSPClock(&dspClock, nullptr) != FMOD_OK) { return false; }
+	outSamples = dspClock;
+	return true;
+}
+
 bool AudioEngine::GetCurrentAudioDriverInfo(std::string& outName, int& outSampleRate, int& outNumSpeakers, std::string& outSpeakerMode)
 {
 	if (!IsInitialized()) { return false; }
@@ -562,6 +1458,256 @@ bool AudioEngine::GetCurrentAudioDriverInfo(std::string& outName, int& outSample
 	return true;
 }
 
+// Debug
+
+bool AudioEngine::GetDSPGraph(std::vector<AudioDSPNodeInfo>& outNodes)
+{
+	outNodes.clear();
+	if (!IsInitialized()) { return false; }
+
+	const AudioEngine& audioEngine = Get();
+
+	CoreSystem* coreSystem = nullptr;
+	if (audioEngine.mStudioSystem->getCoreSystem(&coreSystem) != FMOD_OK) { return false; }
+
+	FMOD::ChannelGroup* masterGroup = nullptr;
+	if (coreSystem->getMasterChannelGroup(&masterGroup) != FMOD_OK) { return false; }
+
+	FMOD::DSP* masterHead = nullptr;
+	if (masterGroup->getDSP(FMOD_CHANNELCONTROL_DSP_HEAD, &masterHead) != FMOD_OK) { return false; }
+
+	// Tag the head DSP of every bus channel group so the walk can attribute nodes to their bus.
+	// Buses without a channel group (nothing routed through them yet) are skipped, the inspector never creates one.
+	DSPOwnerMap owners;
+	owners.emplace(masterHead, "Master (Core)");
+
+	int bankCount = 0;
+	audioEngine.mStudioSystem->getBankCount(&bankCount);
+	std::vector<AudioBank*> banks(bankCount);
+	audioEngine.mStudioSystem->getBankList(banks.data(), bankCount, &bankCount);
+
+	for (AudioBank* bank : banks)
+	{
+		int busCount = 0;
+		if (!bank || bank->getBusCount(&busCount) != FMOD_OK || busCount <= 0) { continue; }
+
+		std::vector<AudioBus*> buses(busCount);
+		bank->getBusList(buses.data(), busCount, &busCount);
+
+		for (AudioBus* bus : buses)
+		{
+			FMOD::ChannelGroup* busGroup = nullptr;
+			FMOD::DSP* busHead = nullptr;
+			if (bus->getChannelGroup(&busGroup) != FMOD_OK
+				|| busGroup->getDSP(FMOD_CHANNELCONTROL_DSP_HEAD, &busHead) != FMOD_OK)
+			{
+				continue;
+			}
+
+			char path[256] = {};
+			bus->getPath(path, sizeof(path), nullptr);
+			owners.insert_or_assign(busHead, std::string(path));
+		}
+	}
+
+	std::set<FMOD::DSP*> visited;
+	CollectDSPNodes(masterHead, 0, owners.at(masterHead), owners,
+		audioEngine.bProfileMeterAllEnabled, visited, outNodes);
+
+	return true;
+}
+
+bool AudioEngine::IsProfileMeterAllEnabled()
+{
+	return Get().bProfileMeterAllEnabled;
+}
+
+// Latency
+
+void AudioEngine::GetEventLatencyStats(std::vector<const AudioEventLatencyStats*>& outStats)
+{
+	outStats.clear();
+	for (const auto& stats : Get().mEventLatencyStats | std::views::values)
+	{
+		outStats.push_back(stats.get());
+	}
+	std::ranges::sort(outStats, {}, &AudioEventLatencyStats::path);
+}
+
+void AudioEngine::DumpEventLatencyStats(std::ostream& stream)
+{
+	std::vector<const AudioEventLatencyStats*> allStats;
+	GetEventLatencyStats(allStats);
+
+	stream << "FMOD First-play latency (us, samples)" << std::endl;
+	for (const AudioEventLatencyStats* stats : allStats)
+	{
+		stream << std::format("  {}\n    started:      n={} p50={} p90={} p99={} max={}\n"
+			"    sound played: n={} p50={} p90={} p99={} max={}\n"
+			"    DSP samples:  p50={} p90={} p99={} max={}",
+			stats->path,
+			stats->startedUs.GetCount(), stats->startedUs.GetPercentile(50), stats->startedUs.GetPercentile(90),
+			stats->startedUs.GetPercentile(99), stats->startedUs.GetMax(),
+			stats->soundPlayedUs.GetCount(), stats->soundPlayedUs.GetPercentile(50), stats->soundPlayedUs.GetPercentile(90),
+			stats->soundPlayedUs.GetPercentile(99), stats->soundPlayedUs.GetMax(),
+			stats->soundPlayedSamples.GetPercentile(50), stats->soundPlayedSamples.GetPercentile(90),
+			stats->soundPlayedSamples.GetPercentile(99), stats->soundPlayedSamples.GetMax()) << std::endl;
+	}
+}
+
+bool AudioEngine::IsFirstPlayLatencyEnabled()
+{
+	return Get().bFirstPlayLatencyEnabled;
+}
+
+AudioEventLatencyStats* AudioEngine::GetOrCreateEventLatencyStats(const std::string& studioPath)
+{
+	auto& stats = mEventLatencyStats[studioPath];
+	if (!stats)
+	{
+		stats = std::make_unique<AudioEventLatencyStats>();
+		stats->path = studioPath;
+	}
+	return stats.get();
+}
+
+void AudioEngine::RecordFirstPlayLatency(TrackedAudioInstance& record, const AudioCallbackType type) const
+{
+	const auto elapsedUs = static_cast<uint64_t>(std::max<int64_t>(GetSteadyTimeNs() - record.playRequestTimeNs, 0) / 1000);
+
+	if (type == FMOD_STUDIO_EVENT_CALLBACK_STARTED
+		&& !record.bStartedReported.exchange(true, std::memory_order_relaxed))
+	{
+		record.latencyStats->startedUs.Record(elapsedUs);
+	}
+	else if (type == FMOD_STUDIO_EVENT_CALLBACK_SOUND_PLAYED
+		&& !record.bSoundPlayedReported.exchange(true, std::memory_order_relaxed))
+	{
+		record.latencyStats->soundPlayedUs.Record(elapsedUs);
+
+		unsigned long long dspClock = 0;
+		if (mMasterChannelGroup && mMasterChannelGroup->getDSPClock(&dspClock, nullptr) == FMOD_OK
+			&& dspClock >= record.playRequestDSPClock)
+		{
+			record.latencyStats->soundPlayedSamples.Record(dspClock - record.playRequestDSPClock);
+		}
+	}
+}
+
+// Callback Profiling
+
+const AudioCallbackProfiler* AudioEngine::GetCallbackProfiler()
+{
+	return Get().mCallbackProfiler.get();
+}
+
+void AudioEngine::GetEventCallbackStats(std::vector<const AudioEventCallbackStats*>& outStats)
+{
+	outStats.clear();
+	for (const auto& stats : Get().mEventCallbackStats | std::views::values)
+	{
+		outStats.push_back(stats.get());
+	}
+	std::ranges::sort(outStats, {}, &AudioEventCallbackStats::path);
+}
+
+void AudioEngine::DumpCallbackStats(std::ostream& stream)
+{
+	const AudioCallbackProfiler* profiler = GetCallbackProfiler();
+	if (!profiler) { return; }
+
+	stream << std::format("FMOD Callback durations (us, budget {} us)", profiler->GetBudgetNs() / 1000) << std::endl;
+	for (size_t i = 0; i < profiler->GetSlotCount(); ++i)
+	{
+		const AudioCallbackProfiler::Slot& slot = profiler->GetSlot(i);
+		if (slot.durationNs.GetCount() == 0) { continue; }
+
+		stream << std::format("  {} {}: n={} p50={:.1f} p99={:.1f} max={:.1f} over budget={}",
+			AudioCallbackProfiler::GetKindName(slot.kind), slot.name, slot.durationNs.GetCount(),
+			static_cast<double>(slot.durationNs.GetPercentile(50)) * 0.001,
+			static_cast<double>(slot.durationNs.GetPercentile(99)) * 0.001,
+			static_cast<double>(slot.durationNs.GetMax()) * 0.001,
+			slot.overBudgetCount.load(std::memory_order_relaxed)) << std::endl;
+	}
+
+	std::vector<const AudioEventCallbackStats*> allStats;
+	GetEventCallbackStats(allStats);
+	for (const AudioEventCallbackStats* stats : allStats)
+	{
+		if (stats->durationNs.GetCount() == 0) { continue; }
+
+		stream << std::format("  {}: n={} p50={:.1f} p99={:.1f} max={:.1f} over budget={}",
+			stats->path, stats->durationNs.GetCount(),
+			static_cast<double>(stats->durationNs.GetPercentile(50)) * 0.001,
+			static_cast<double>(stats->durationNs.GetPercentile(99)) * 0.001,
+			static_cast<double>(stats->durationNs.GetMax()) * 0.001,
+			stats->overBudgetCount.load(std::memory_order_relaxed)) << std::endl;
+	}
+}
+
+AudioEventCallbackStats* AudioEngine::GetOrCreateEventCallbackStats(const std::string& studioPath)
+{
+	auto& stats = mEventCallbackStats[studioPath];
+	if (!stats)
+	{
+		stats = std::make_unique<AudioEventCallbackStats>();
+		stats->path = studioPath;
+	}
+	return stats.get();
+}
+
+// File I/O Tracing
+
+const AudioFileTracer* AudioEngine::GetFileTracer()
+{
+	return Get().mFileTracer.get();
+}
+
+// Command Capture and Replay
+
+bool AudioEngine::StartCommandCapture()
+{
+	return StartCommandCapture(Get().mCommandCapturePath);
+}
+
+bool AudioEngine::StartCommandCapture(const std::string& filePath)
+{
+	AudioEngine& audioEngine = Get();
+	if (!audioEngine.mStudioSystem->isValid() || audioEngine.bCommandCaptureActive || filePath.empty()) { return false; }
+
+	if (audioEngine.mStudioSystem->startCommandCapture(filePath.c_str(), audioEngine.mCommandCaptureFlags) != FMOD_OK)
+	{
+		std::cout << std::format("AudioEngine: cannot start the command capture to {}", filePath) << std::endl;
+		return false;
+	}
+
+	std::cout << std::format("AudioEngine: capturing Studio commands to {}", filePath) << std::endl;
+	audioEngine.bCommandCaptureActive = true;
+	return true;
+}
+
+bool AudioEngine::StopCommandCapture()
+{
+	AudioEngine& audioEngine = Get();
+	if (!audioEngine.mStudioSystem->isValid() || !audioEngine.bCommandCaptureActive) { return false; }
+
+	audioEngine.bCommandCaptureActive = false;
+	return audioEngine.mStudioSystem->stopCommandCapture() == FMOD_OK;
+}
+
+bool AudioEngine::IsCommandCaptureActive()
+{
+	return Get().bCommandCaptureActive;
+}
+
+bool AudioEngine::LoadCommandReplay(const std::string& filePath, const AudioCommandReplayFlags flags, AudioCommandReplay*& outReplay)
+{
+	const AudioEngine& audioEngine = Get();
+	if (!audioEngine.mStudioSystem->isValid()) { return false; }
+
+	return audioEngine.mStudioSystem->loadCommandReplay(filePath.c_str(), flags, &outReplay) == FMOD_OK;
+}
+
 float AudioEngine::GetNormalizedVolumeInRange(const float controlPercent, const float dynamicRangeDB)
 {
 	/*
@@ -586,7 +1732,8 @@ float AudioEngine::GetNormalizedVolumeInRange(const float controlPercent, const
 FMOD_RESULT AudioEngine::AudioEventCallback_Music(FMOD_STUDIO_SYSTEM* system, FMOD_STUDIO_SYSTEM_CALLBACK_TYPE type,
 	void* commandData, void* userdata)
 {
-	if (const auto* audioEngine =  static_cast<AudioEngine*>(userdata); !audioEngine)
+	auto* audioEngine = static_cast<AudioEngine*>(userdata);
+	if (!audioEngine)
 	{
 		return FMOD_ERR_BADCOMMAND;
 	}
@@ -594,10 +1741,10 @@ FMOD_RESULT AudioEngine::AudioEventCallback_Music(FMOD_STUDIO_SYSTEM* system, FM
 	switch (type)
 	{
 		case FMOD_STUDIO_SYSTEM_CALLBACK_PREUPDATE:
-			// std::cout << "FMOD UPDATE PRE" << std::endl; // Commented out to not spam the console
+			audioEngine->mUpdateController.OnPreUpdate(GetSteadyTimeNs());
 			break;
 		case FMOD_STUDIO_SYSTEM_CALLBACK_POSTUPDATE:
-			// std::cout << "FMOD UPDATE POST" << std::endl; // Commented out to not spam the console
+			audioEngine->mUpdateController.OnPostUpdate(GetSteadyTimeNs());
 			break;
 		case FMOD_STUDIO_SYSTEM_CALLBACK_BANK_UNLOAD:
 			std::cout << "FMOD BANK UNLOADED " << std::endl;
@@ -615,66 +1762,136 @@ FMOD_RESULT AudioEngine::AudioEventCallback_Music(FMOD_STUDIO_SYSTEM* system, FM
 	return FMOD_OK;
 }
 
-// Logging and Errors
+// Audio Engine Event Callback
 
-#ifndef NDEBUG // Logging only available in the Debug config (fmodstudioL and fmodL dynamic libs)
-FMOD_RESULT AudioEngine::AudioEngineLogCallback(const FMOD_DEBUG_FLAGS flags,
-	const char* file, int line, const char* function, const char* message)
+FMOD_RESULT AudioEngine::AudioEngineEventCallback(const FMOD_STUDIO_EVENT_CALLBACK_TYPE type,
+	FMOD_STUDIO_EVENTINSTANCE* eventInstance, void* parameters)
 {
-	const auto now = std::chrono::system_clock::now();
-	const auto time64 = std::chrono::system_clock::to_time_t(now);
+	const auto* audioInstance = reinterpret_cast<AudioInstance*>(eventInstance);
+	AudioEngine* audioEngine = sInstance.get();
 
-	std::tm localTime {};
-#ifdef WIN32
-	localtime_s(&localTime, &time64);   // Windows (safe version)
-#else
-	localtime_r(&time64, &localTime);   // POSIX (safe version on Linux/macOS)
-#endif
+	void* userData = nullptr;
+	if (!audioEngine || audioInstance->getUserData(&userData) != FMOD_OK
+		|| !audioEngine->mInstanceTracker->Owns(userData))
+	{
+		return FMOD_OK;
+	}
 
-	std::ostringstream stringStreamTime;
-	stringStreamTime << std::put_time(&localTime, "%d-%b-%Y %H:%M:%S");
+	auto* record = static_cast<TrackedAudioInstance*>(userData);
 
-	std::unordered_map<FMOD_DEBUG_FLAGS, std::string> loggingLevels{
-			{FMOD_DEBUG_LEVEL_LOG, "Log"},
-			{FMOD_DEBUG_LEVEL_WARNING, "Warning"},
-			{FMOD_DEBUG_LEVEL_ERROR, "Error"}
-	};
+	if (audioEngine->mJournal)
+	{
+		audioEngine->mJournal->Record(JOURNAL_OP_CALLBACK, eventInstance, 0, type);
+	}
 
-	std::string loggingLevel;
-	if (const auto it = loggingLevels.find(flags); it != loggingLevels.end())
+	if (record->latencyStats)
 	{
-		loggingLevel = it->second;
+		audioEngine->RecordFirstPlayLatency(*record, type);
 	}
 
-	std::cout << "FMOD " << loggingLevel << " [" + stringStreamTime.str() + "] " + message << std::endl;
-	return FMOD_OK;
+	FMOD_RESULT result = FMOD_OK;
+	const AudioEventCallback userCallback = record->userCallback.load(std::memory_order_acquire);
+	if (userCallback && (record->userCallbackMask.load(std::memory_order_relaxed) & type))
+	{
+		AudioOwner* owner = record->ownerIndex != AUDIO_OWNER_NONE ? &audioEngine->mOwners[record->ownerIndex] : nullptr;
+		if (audioEngine->mCallbackProfiler || owner)
+		{
+			const int64_t startTimeNs = GetSteadyTimeNs();
+			result = userCallback(type, eventInstance, parameters);
+			const auto durationNs = static_cast<uint64_t>(GetSteadyTimeNs() - startTimeNs);
+
+			if (audioEngine->mCallbackProfiler)
+			{
+				audioEngine->mCallbackProfiler->Record(AudioCallbackKind::Event, type, durationNs, record->callbackStats);
+			}
+			if (owner) { owner->callbackTimeNs.fetch_add(durationNs, std::memory_order_relaxed); }
+		}
+		else
+		{
+			result = userCallback(type, eventInstance, parameters);
+		}
+	}
+
+	if (type == FMOD_STUDIO_EVENT_CALLBACK_DESTROYED)
+	{
+		if (record->ownerIndex != AUDIO_OWNER_NONE)
+		{
+			audioEngine->mOwners[record->ownerIndex].liveInstances.fetch_sub(1, std::memory_order_relaxed);
+		}
+		audioEngine->mInstanceTracker->Release(record);
+	}
+
+	return result;
 }
-#endif
 
-FMOD_RESULT AudioEngine::AudioEngineErrorCallback(FMOD_SYSTEM* system, FMOD_SYSTEM_CALLBACK_TYPE type,
-	void* commandData1, void* commandData2, void* userdata)
+// Callback Profiling Shims
+
+FMOD_RESULT AudioEngine::ProfiledStudioSystemCallback(FMOD_STUDIO_SYSTEM* system, FMOD_STUDIO_SYSTEM_CALLBACK_TYPE type,
+	void* commandData, void* userdata)
 {
-	const auto callbackInfo = static_cast<FMOD_ERRORCALLBACK_INFO*>(commandData1);
+	const int64_t startTimeNs = GetSteadyTimeNs();
+	const FMOD_RESULT result = AudioEventCallback_Music(system, type, commandData, userdata);
+	if (const AudioEngine* audioEngine = sInstance.get(); audioEngine && audioEngine->mCallbackProfiler)
+	{
+		audioEngine->mCallbackProfiler->Record(AudioCallbackKind::StudioSystem, type,
+			static_cast<uint64_t>(GetSteadyTimeNs() - startTimeNs));
+	}
+	return result;
+}
 
-	const auto now = std::chrono::system_clock::now();
-	const auto time64 = std::chrono::system_clock::to_time_t(now);
+FMOD_RESULT AudioEngine::ProfiledErrorCallback(FMOD_SYSTEM* system, FMOD_SYSTEM_CALLBACK_TYPE type,
+	void* commandData1, void* commandData2, void* userdata)
+{
+	const int64_t startTimeNs = GetSteadyTimeNs();
+	const FMOD_RESULT result = AudioEngineErrorCallback(system, type, commandData1, commandData2, userdata);
+	if (const AudioEngine* audioEngine = sInstance.get(); audioEngine && audioEngine->mCallbackProfiler)
+	{
+		audioEngine->mCallbackProfiler->Record(AudioCallbackKind::CoreSystem, type,
+			static_cast<uint64_t>(GetSteadyTimeNs() - startTimeNs));
+	}
+	return result;
+}
 
-	std::tm localTime {};
-#ifdef WIN32
-	localtime_s(&localTime, &time64);   // Windows (safe version)
-#else
-	localtime_r(&time64, &localTime);   // POSIX (safe version on Linux/macOS)
+#ifndef NDEBUG
+FMOD_RESULT AudioEngine::ProfiledLogCallback(const FMOD_DEBUG_FLAGS flags,
+	const char* file, const int line, const char* function, const char* message)
+{
+	const int64_t startTimeNs = GetSteadyTimeNs();
+	const FMOD_RESULT result = AudioEngineLogCallback(flags, file, line, function, message);
+	if (const AudioEngine* audioEngine = sInstance.get(); audioEngine && audioEngine->mCallbackProfiler)
+	{
+		constexpr FMOD_DEBUG_FLAGS levelMask = FMOD_DEBUG_LEVEL_ERROR | FMOD_DEBUG_LEVEL_WARNING | FMOD_DEBUG_LEVEL_LOG;
+		audioEngine->mCallbackProfiler->Record(AudioCallbackKind::Debug, flags & levelMask,
+			static_cast<uint64_t>(GetSteadyTimeNs() - startTimeNs));
+	}
+	return result;
+}
 #endif
 
-	std::ostringstream stringStreamTime;
-	stringStreamTime << std::put_time(&localTime, "%d-%b-%Y %H:%M:%S");
+// Logging and Errors
+
+#ifndef NDEBUG // Logging only available in the Debug config (fmodstudioL and fmodL dynamic libs)
+FMOD_RESULT AudioEngine::AudioEngineLogCallback(const FMOD_DEBUG_FLAGS flags,
+	const char* file, const int line, const char* function, const char* message)
+{
+	if (const AudioEngine* audioEngine = sInstance.get(); audioEngine && audioEngine->mLogger)
+	{
+		AudioLogLevel level = AudioLogLevel::Log;
+		if (flags & FMOD_DEBUG_LEVEL_ERROR) { level = AudioLogLevel::Error; }
+		else if (flags & FMOD_DEBUG_LEVEL_WARNING) { level = AudioLogLevel::Warning; }
 
-	const std::string message = std::format("{}({}) returned error for instance type: {} (0x{})\n",
-		callbackInfo->functionname,
-		callbackInfo->functionparams,
-		static_cast<int>(callbackInfo->result),
-		callbackInfo->instance);
+		audioEngine->mLogger->PushLog(level, file, line, function, message);
+	}
+	return FMOD_OK;
+}
+#endif
 
-	std::cout << "FMOD Error [" + stringStreamTime.str() + "] " + message << std::endl;
+FMOD_RESULT AudioEngine::AudioEngineErrorCallback(FMOD_SYSTEM* system, FMOD_SYSTEM_CALLBACK_TYPE type,
+	void* commandData1, void* commandData2, void* userdata)
+{
+	if (const AudioEngine* audioEngine = sInstance.get(); audioEngine && audioEngine->mLogger && commandData1)
+	{
+		audioEngine->mLogger->PushApiError(*static_cast<FMOD_ERRORCALLBACK_INFO*>(commandData1));
+	}
 	return FMOD_OK;
-}
\ No newline at end of file
+}
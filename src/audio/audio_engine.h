@@ -3,7 +3,15 @@
 
 #include "fmod_studio.hpp"
 
+#include "audio_callback_profiler.h"
 #include "audio_config.h"
+#include "audio_file_tracer.h"
+#include "audio_instance_tracker.h"
+#include "audio_journal.h"
+#include "audio_logger.h"
+#include "audio_owner.h"
+#include "audio_update_controller.h"
+#include "profiling/snapshot_buffer.h"
 
 using StudioSystem = FMOD::Studio::System;
 using CoreSystem = FMOD::System;
@@ -12,9 +20,12 @@ using Audio3DAttributes = FMOD_3D_ATTRIBUTES;
 using AudioBank = FMOD::Studio::Bank;
 using AudioBus = FMOD::Studio::Bus;
 using AudioCallbackType = FMOD_STUDIO_EVENT_CALLBACK_TYPE;
+using AudioCommandReplay = FMOD::Studio::CommandReplay;
+using AudioCommandReplayFlags = FMOD_STUDIO_COMMANDREPLAY_FLAGS;
 using AudioCoreSound = FMOD::Sound;
 using AudioEventCallback = FMOD_STUDIO_EVENT_CALLBACK;
 using AudioInstance = FMOD::Studio::EventInstance;
+using AudioParameterID = FMOD_STUDIO_PARAMETER_ID;
 using AudioProgrammerSoundProperties = FMOD_STUDIO_PROGRAMMER_SOUND_PROPERTIES;
 using AudioStudioSystemSoundInfo = FMOD_STUDIO_SOUND_INFO;
 using AudioVCA = FMOD::Studio::VCA;
@@ -25,6 +36,73 @@ struct ProgrammerSoundContext
 	void* userData;
 };
 
+constexpr int AUDIO_METERING_MAX_BUSES = 8;
+constexpr int AUDIO_METERING_MAX_CHANNELS = 12; // 7.1.4
+constexpr int AUDIO_METERING_MAX_PATH = 64;
+
+/** Peak and RMS levels (linear) of a bus output, sampled once per AudioEngine::Update */
+struct AudioBusMeter
+{
+	char path[AUDIO_METERING_MAX_PATH] = {};
+	int numChannels = 0;
+	float peak[AUDIO_METERING_MAX_CHANNELS] = {};
+	float rms[AUDIO_METERING_MAX_CHANNELS] = {};
+	bool bIsValid = false;
+};
+
+struct AudioBusMeteringSnapshot
+{
+	uint64_t updateIndex = 0;
+	int busCount = 0;
+	AudioBusMeter buses[AUDIO_METERING_MAX_BUSES] = {};
+};
+
+struct AudioDSPNodeInfo
+{
+	std::string name;
+	std::string owner;
+	int depth = 0;
+	int type = 0;
+	bool bIsActive = false;
+	bool bIsBypassed = false;
+	unsigned int cpuExclusiveUs = 0;
+	unsigned int cpuInclusiveUs = 0;
+};
+
+constexpr int AUDIO_STATS_MAX_BANKS = 16;
+
+struct AudioBankStats
+{
+	char path[AUDIO_METERING_MAX_PATH] = {};
+	FMOD_STUDIO_LOADING_STATE loadingState = FMOD_STUDIO_LOADING_STATE_UNLOADED;
+	FMOD_STUDIO_LOADING_STATE sampleLoadingState = FMOD_STUDIO_LOADING_STATE_UNLOADED;
+	float loadTimeMs = 0; // Blocking loadBankFile call, 0 if not loaded through AudioEngine
+};
+
+/** Engine-wide counters and gauges, sampled once per AudioEngine::Update */
+struct AudioEngineStats
+{
+	uint64_t updateIndex = 0;
+	FMOD_STUDIO_CPU_USAGE studioCPU = {};
+	FMOD_CPU_USAGE coreCPU = {};
+	FMOD_STUDIO_BUFFER_USAGE bufferUsage = {};
+	int memoryCurrentBytes = 0;
+	int memoryMaxBytes = 0;
+	int channelsPlaying = 0;
+	int realChannelsPlaying = 0;
+	uint64_t activeInstances = 0; // Live instances created by PlayAudioEvent, 0 without instance tracking
+	uint64_t eventsPlayed = 0;
+	float eventsPlayedPerSecond = 0; // Over the last completed one-second window
+	float studioUpdateMs = 0;          // Last Studio async update, PREUPDATE to POSTUPDATE
+	float studioUpdateP99Ms = 0;
+	float studioUpdateIntervalMs = 0;  // Between the last two Studio async updates
+	float effectiveUpdatePeriodMs = 0; // Game thread submission period, see AudioUpdateController
+	float updateSubmitCostPercent = 0; // Main thread share spent in Studio::System::update, a few times per second
+	uint64_t skippedUpdates = 0;
+	int bankCount = 0;
+	AudioBankStats banks[AUDIO_STATS_MAX_BANKS] = {};
+};
+
 class AudioEngine
 {
 	public:
@@ -42,6 +120,7 @@ class AudioEngine
 		static bool LoadSoundBankFile(const std::string& filePath, AudioBank*& outBankPtr);
 		static bool UnloadSoundBank(const std::string& studioPath);
 		static bool UnloadSoundBank(AudioBank* bank);
+		static void UnloadAllSoundBanks();
 
 		// Events
 
@@ -53,15 +132,27 @@ class AudioEngine
 			bool autoStart = true,
 			bool autoRelease = true);
 
+		/** Spatialized events are positioned by their 3D attributes, the others ignore them */
+		static bool EventIs3D(const std::string& studioPath, bool& outIs3D);
+
 		// Audio Instances
 
 		static bool InstanceStart(AudioInstance* instance);
 		static bool InstanceStop(AudioInstance* instance, bool bAllowFadeOut = true);
 		static bool InstanceRelease(AudioInstance* instance);
 		static bool InstanceSetPaused(AudioInstance* instance, bool bPaused);
+		static bool InstanceSet3DAttributes(AudioInstance* instance, const Audio3DAttributes& audio3dAttributes);
 		static bool InstanceIsPaused(const AudioInstance* instance, bool& outPaused);
 		static bool InstanceIsPlaying(const AudioInstance* instance, bool& outPlaying);
 
+		/** Instances created by PlayAudioEvent carry an engine record as their FMOD user data.
+		 * Use these instead of EventInstance::getUserData/setCallback to reach the caller's data and callback.
+		 * Both are safe to call from inside event callbacks.
+		 */
+		static bool InstanceGetUserData(const AudioInstance* instance, void*& outUserData);
+		static bool InstanceSetCallback(AudioInstance* instance, AudioEventCallback callback,
+			AudioCallbackType callbackType = FMOD_STUDIO_EVENT_CALLBACK_ALL);
+
 		// Parameters
 
 		static bool SetGlobalParameterByName(const std::string& name,
@@ -73,6 +164,15 @@ class AudioEngine
 		static bool SetParameterByNameWithLabel(AudioInstance* instance,
 			const std::string& name, const std::string& label, bool bIgnoreSeekSpeed = false);
 
+		/** Resolve the ID once and set by ID on hot paths, it skips the name lookup of every by-name call
+		 * Refer to: https://www.fmod.com/docs/2.03/api/studio-api-eventinstance.html#studio_eventinstance_setparameterbyid
+		 */
+		static bool GetGlobalParameterID(const std::string& name, AudioParameterID& outParameterID);
+		static bool GetParameterID(const AudioInstance* instance, const std::string& name, AudioParameterID& outParameterID);
+		static bool SetGlobalParameterByID(AudioParameterID parameterID, float value, bool bIgnoreSeekSpeed = false);
+		static bool SetParameterByID(AudioInstance* instance, AudioParameterID parameterID,
+			float value, bool bIgnoreSeekSpeed = false);
+
 		// Buses
 
 		static bool GetBus(const std::string& studioPath, AudioBus*& outBusPtr);
@@ -92,6 +192,34 @@ class AudioEngine
 		static bool VCA_GetVolume(const AudioVCA* vca, float& outVolume, float& outFinalVolume);
 		static bool VCA_SetVolume(AudioVCA* vca, float Volume);
 
+		// Metering
+
+		/** Enables output metering on the head DSP of the bus channel group.
+		 * The channel group is locked so it stays alive while metered.
+		 * Refer to: https://www.fmod.com/docs/2.03/api/core-api-dsp.html#dsp_setmeteringenabled
+		 */
+		static bool EnableBusMetering(const std::string& studioPath);
+		static bool DisableBusMetering(const std::string& studioPath);
+
+		/** Lock-free, callable from any thread */
+		static bool GetBusMeteringSnapshot(AudioBusMeteringSnapshot& outSnapshot);
+		static bool GetBusMeter(const std::string& studioPath, AudioBusMeter& outMeter);
+
+		// Owners
+
+		/** Attributes banks and instances created from now on to ownerName (the active page), until the next call.
+		 * Budgets come from the [Budget.<ownerName>] config section. No-op unless [Budgets] EnableOwnerAccounting is set.
+		 */
+		static void SetActiveOwner(const std::string& ownerName);
+		/** Main thread only */
+		static void GetOwnerStats(std::vector<AudioOwnerStats>& outStats);
+		static bool IsOwnerAccountingEnabled();
+
+		// Stats
+
+		/** Lock-free, callable from any thread */
+		static bool GetStatsSnapshot(AudioEngineStats& outStats);
+
 		// Plugins
 
 		void RegisterAdditionalPlugins(const std::vector<std::string>& pluginNames, const std::string& rootPath);
@@ -100,6 +228,51 @@ class AudioEngine
 
 		bool GetAudioDriverIndexByName(const std::string& audioDriverName, int& outDriverIndex) const;
 		static bool GetCurrentAudioDriverInfo(std::string& outName, int& outSampleRate, int& outNumSpeakers, std::string& outSpeakerMode);
+		/** Samples mixed by the master ChannelGroup since initialize, and the mixer sample rate */
+		static bool GetMixerClock(uint64_t& outSamples, int& outSampleRate);
+
+		// Debug
+
+		/** Walks the core mixer graph from the master ChannelGroup head DSP.
+		 * Nodes owned by a bus ChannelGroup are tagged with the bus path. DSP CPU usage is only
+		 * reported when the engine was initialized with FMOD_INIT_PROFILE_METER_ALL.
+		 * Refer to: https://www.fmod.com/docs/2.03/api/core-api-dsp.html#dsp_getcpuusage
+		 */
+		static bool GetDSPGraph(std::vector<AudioDSPNodeInfo>& outNodes);
+		static bool IsProfileMeterAllEnabled();
+
+		// Latency
+
+		/** Main thread only. Pointers stay valid until Terminate. */
+		static void GetEventLatencyStats(std::vector<const AudioEventLatencyStats*>& outStats);
+		static void DumpEventLatencyStats(std::ostream& stream);
+		static bool IsFirstPlayLatencyEnabled();
+
+		// Callback Profiling
+
+		/** Null unless [Profiling] EnableCallbackProfiling is set. Histograms can be read from any thread. */
+		static const AudioCallbackProfiler* GetCallbackProfiler();
+		/** Main thread only. Pointers stay valid until Terminate. */
+		static void GetEventCallbackStats(std::vector<const AudioEventCallbackStats*>& outStats);
+		static void DumpCallbackStats(std::ostream& stream);
+
+		// File I/O Tracing
+
+		/** Null unless [Profiling] EnableFileTracing is set */
+		static const AudioFileTracer* GetFileTracer();
+
+		// Command Capture and Replay
+
+		/** Records every Studio API command to a file that loadCommandReplay can play back.
+		 * Without a path the capture goes to [Profiling] CommandCapturePath.
+		 * Refer to: https://www.fmod.com/docs/2.03/api/studio-api-system.html#studio_system_startcommandcapture
+		 */
+		static bool StartCommandCapture();
+		static bool StartCommandCapture(const std::string& filePath);
+		static bool StopCommandCapture();
+		static bool IsCommandCaptureActive();
+		/** The caller starts, polls and releases the replay. Refer to: https://www.fmod.com/docs/2.03/api/studio-api-commandreplay.html */
+		static bool LoadCommandReplay(const std::string& filePath, AudioCommandReplayFlags flags, AudioCommandReplay*& outReplay);
 
 		// Helpers
 
@@ -110,12 +283,103 @@ class AudioEngine
 		static std::unique_ptr<AudioEngine> sInstance;
 		StudioSystem* mStudioSystem;
 		bool bMainBanksLoaded;
+		bool bProfileMeterAllEnabled;
+
+		struct MeteredBus
+		{
+			std::string path;
+			AudioBus* bus = nullptr;
+			FMOD::DSP* headDSP = nullptr;
+		};
+
+		std::vector<MeteredBus> mMeteredBuses;
+		SnapshotBuffer<AudioBusMeteringSnapshot> mBusMeteringSnapshot;
+		uint64_t mUpdateIndex;
+
+		SnapshotBuffer<AudioEngineStats> mStatsSnapshot;
+		uint64_t mEventsPlayed;
+		uint64_t mEventsPlayedWindowStart;
+		int64_t mEventsPlayedWindowStartNs;
+		float mEventsPlayedPerSecond;
+
+		struct LoadedBank
+		{
+			float loadTimeMs = 0;
+			int ownerIndex = AUDIO_OWNER_NONE;
+			int64_t memoryBytes = 0;
+		};
+
+		/** Sample data of an event first played by an owner. Playing the event starts the load, memoryBytes is measured
+		 * when it reports LOADED and includes anything else FMOD allocated in between. */
+		struct OwnedSampleData
+		{
+			int ownerIndex = AUDIO_OWNER_NONE;
+			int64_t memoryBeforeBytes = 0;
+			int64_t memoryBytes = 0;
+			bool bLoaded = false;
+		};
+
+		std::unordered_map<const AudioBank*, LoadedBank> mLoadedBanks;
+		bool bPreloadSampleData;
+		std::unordered_map<const FMOD::Studio::EventDescription*, OwnedSampleData> mOwnedSampleData;
+
+		std::array<AudioOwner, AUDIO_MAX_OWNERS> mOwners;
+		std::unordered_map<std::string, AudioOwnerBudget> mOwnerBudgets;
+		int mOwnerCount;
+		int mActiveOwnerIndex;
+		int64_t mOwnersSampledNs;
+		bool bOwnerAccountingEnabled;
+		bool bAssertOnBudgetOverflow;
+
+		unsigned int mCommandQueueSize;
+		unsigned int mHandleInitialSize;
+		std::string mLearnedBufferSizesPath;
+		bool bBufferAutoSizingEnabled;
+
+		std::string mCommandCapturePath;
+		FMOD_STUDIO_COMMANDCAPTURE_FLAGS mCommandCaptureFlags;
+		bool bCommandCaptureActive;
+		FMOD_STUDIO_BUFFER_USAGE mReportedBufferUsage;
+		int64_t mBufferStallsReportedNs;
+
+		AudioUpdateController mUpdateController;
+		int64_t mLastUpdateCallNs;
+
+		std::unique_ptr<AudioInstanceTracker> mInstanceTracker;
+		std::unordered_map<std::string, std::unique_ptr<AudioEventLatencyStats>> mEventLatencyStats;
+		FMOD::ChannelGroup* mMasterChannelGroup;
+		bool bFirstPlayLatencyEnabled;
+		bool bInstanceTrackingEnabled;
+
+		std::unique_ptr<AudioCallbackProfiler> mCallbackProfiler;
+		std::unordered_map<std::string, std::unique_ptr<AudioEventCallbackStats>> mEventCallbackStats;
+
+		std::unique_ptr<AudioFileTracer> mFileTracer;
+		std::unique_ptr<AudioJournal> mJournal;
+		std::unique_ptr<AudioLogger> mLogger;
 
 		std::string mSoundBankRootDirectory;
 		std::unordered_map<std::string, uint32_t> additionalPluginHandles;
 
 		AudioEngine();
 
+		void UpdateBusMetering();
+		void UpdateStats();
+		void UpdateOwners();
+		/** Logs new command queue and handle buffer stalls, at most once per second */
+		void ReportBufferStalls(const FMOD_STUDIO_BUFFER_USAGE& bufferUsage);
+		void SaveLearnedBufferSizes() const;
+		int GetOrCreateOwner(const std::string& ownerName);
+		AudioEventLatencyStats* GetOrCreateEventLatencyStats(const std::string& studioPath);
+		void RecordFirstPlayLatency(TrackedAudioInstance& record, AudioCallbackType type) const;
+		AudioEventCallbackStats* GetOrCreateEventCallbackStats(const std::string& studioPath);
+
+		/** Engine event callback installed on every instance created by PlayAudioEvent.
+		 * Records engine-side data and then forwards to the caller's callback if its mask matches.
+		 */
+		static FMOD_RESULT F_CALL AudioEngineEventCallback(FMOD_STUDIO_EVENT_CALLBACK_TYPE type,
+			FMOD_STUDIO_EVENTINSTANCE* eventInstance, void* parameters);
+
 		/** Audio Engine (Studio) Callback
 		 * Refer to: https://www.fmod.com/docs/2.03/api/core-api-system.html#system_setcallback
 		 * "System callbacks can be called by a variety of FMOD threads,
@@ -124,6 +388,16 @@ class AudioEngine
 		static FMOD_RESULT F_CALL AudioEventCallback_Music(FMOD_STUDIO_SYSTEM* system,
 			FMOD_STUDIO_SYSTEM_CALLBACK_TYPE type, void* commandData, void* userdata);
 
+		/** Timing shims registered in place of the system, error and log callbacks when callback profiling is on */
+		static FMOD_RESULT F_CALL ProfiledStudioSystemCallback(FMOD_STUDIO_SYSTEM* system,
+			FMOD_STUDIO_SYSTEM_CALLBACK_TYPE type, void* commandData, void* userdata);
+		static FMOD_RESULT F_CALL ProfiledErrorCallback(FMOD_SYSTEM* system,
+			FMOD_SYSTEM_CALLBACK_TYPE type, void* commandData1, void* commandData2, void* userdata);
+#ifndef NDEBUG
+		static FMOD_RESULT F_CALL ProfiledLogCallback(FMOD_DEBUG_FLAGS flags,
+			const char* file, int line, const char* function, const char* message);
+#endif
+
 		// Logging and Errors
 
 #ifndef NDEBUG
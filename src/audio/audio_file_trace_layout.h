@@ -0,0 +1,70 @@
+#ifndef AUDIO_FILE_TRACE_LAYOUT_H
+#define AUDIO_FILE_TRACE_LAYOUT_H
+
+/*
+ * Binary file I/O trace, written by AudioFileTracer and read by tools/file_trace_summary.cpp.
+ * Shared with the tool, so this header only uses fixed-size types and must stay free of FMOD and raylib.
+ * Bump FILE_TRACE_LAYOUT_VERSION whenever a record changes; readers reject other versions.
+ *
+ * A trace is one FileTraceHeader followed by fixed-width FileTraceRecords (little endian, as written).
+ * An Open record is directly followed by the opened path: sizeBytes characters, zero padded to a multiple of 8.
+ */
+
+#include <cstdint>
+
+constexpr uint32_t FILE_TRACE_MAGIC = 0x52544946; // "FITR"
+constexpr uint16_t FILE_TRACE_LAYOUT_VERSION = 1;
+
+enum FileTraceOp : uint8_t
+{
+	FILE_TRACE_OP_OPEN,
+	FILE_TRACE_OP_CLOSE,
+	FILE_TRACE_OP_READ,
+	FILE_TRACE_OP_SEEK,
+};
+
+/* Why a file handle was opened. Only known for bank loads when the file is opened, others are resolved on close. */
+enum FileTraceKind : uint8_t
+{
+	FILE_TRACE_KIND_UNKNOWN,
+	FILE_TRACE_KIND_BANK,
+	FILE_TRACE_KIND_SAMPLE,
+	FILE_TRACE_KIND_STREAM,
+	FILE_TRACE_KIND_COUNT
+};
+
+struct FileTraceHeader
+{
+	uint32_t magic;
+	uint16_t version;
+	uint16_t recordSize;
+	int64_t startTimeNs; // Steady clock of the writer, record times are relative to it
+};
+
+struct FileTraceRecord
+{
+	uint64_t timeNs;
+	uint32_t fileId;    // Unique per opened handle for the whole trace
+	uint32_t position;  // Open: file size, Read: offset before the read, Seek: target offset
+	uint32_t sizeBytes; // Open: path length, Read: requested bytes
+	uint32_t bytesRead;
+	uint32_t latencyNs; // Read and Seek, saturated at UINT32_MAX
+	uint8_t op;         // FileTraceOp
+	uint8_t kind;       // FileTraceKind, final on Close records
+	uint16_t reserved;
+};
+
+static_assert(sizeof(FileTraceHeader) == 16);
+static_assert(sizeof(FileTraceRecord) == 32);
+
+inline const char* GetFileTraceKindName(const uint8_t kind)
+{
+	switch (kind)
+	{
+		case FILE_TRACE_KIND_BANK: return "bank";
+		case FILE_TRACE_KIND_SAMPLE: return "sample";
+		case FILE_TRACE_KIND_STREAM: return "stream";
+		default: return "unknown";
+	}
+}
+#endif
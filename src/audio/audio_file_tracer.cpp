@@ -0,0 +1,246 @@
+#include "audio_file_tracer.h"
+
+#include "profiling/steady_time.h"
+
+AudioFileTracer* AudioFileTracer::sActiveTracer = nullptr;
+
+AudioFileTracer::BankLoadScope::BankLoadScope(AudioFileTracer* tracer)
+: mTracer(tracer)
+{
+	if (mTracer) { mTracer->mBankLoadDepth.fetch_add(1, std::memory_order_relaxed); }
+}
+
+AudioFileTracer::BankLoadScope::~BankLoadScope()
+{
+	if (mTracer) { mTracer->mBankLoadDepth.fetch_sub(1, std::memory_order_relaxed); }
+}
+
+AudioFileTracer::AudioFileTracer(const std::string& tracePath)
+: mTraceFile(nullptr)
+, mStartTimeNs(GetSteadyTimeNs())
+, mNextFileId(1)
+, mBankLoadDepth(0)
+{
+	if (tracePath.empty()) { return; }
+
+	mTraceFile = std::fopen(tracePath.c_str(), "wb");
+	if (!mTraceFile)
+	{
+		std::cout << std::format("AudioFileTracer: cannot open {}, only collecting stats", tracePath) << std::endl;
+		return;
+	}
+
+	const FileTraceHeader header{FILE_TRACE_MAGIC, FILE_TRACE_LAYOUT_VERSION, sizeof(FileTraceRecord), mStartTimeNs};
+	std::fwrite(&header, sizeof(header), 1, mTraceFile);
+	mBuffer.reserve(FLUSH_THRESHOLD_BYTES * 2);
+}
+
+AudioFileTracer::~AudioFileTracer()
+{
+	Flush();
+	if (mTraceFile) { std::fclose(mTraceFile); }
+	if (sActiveTracer == this) { sActiveTracer = nullptr; }
+}
+
+bool AudioFileTracer::Install(FMOD::System* coreSystem)
+{
+	sActiveTracer = this;
+
+	// blockalign -1 keeps FMOD's own read buffering, so the trace shows the reads that actually reach the disk
+	return coreSystem->setFileSystem(FileOpenCallback, FileCloseCallback, FileReadCallback, FileSeekCallback,
+		nullptr, nullptr, -1) == FMOD_OK;
+}
+
+void AudioFileTracer::Flush()
+{
+	std::lock_guard lock(mBufferMutex);
+	FlushLocked();
+	if (mTraceFile) { std::fflush(mTraceFile); }
+}
+
+void AudioFileTracer::GetFileStats(std::vector<const AudioFileStats*>& outStats) const
+{
+	std::lock_guard lock(mStatsMutex);
+	outStats.clear();
+	outStats.reserve(mStats.size());
+	for (const auto& stats : mStats | std::views::values)
+	{
+		outStats.push_back(stats.get());
+	}
+}
+
+void AudioFileTracer::DumpStats(std::ostream& stream) const
+{
+	std::vector<const AudioFileStats*> allStats;
+	GetFileStats(allStats);
+	std::ranges::sort(allStats, std::greater{}, [](const AudioFileStats* stats) { return stats->bytesRead.load(std::memory_order_relaxed); });
+
+	stream << "FMOD File I/O (read size in bytes, latency in us)" << std::endl;
+	for (const AudioFileStats* stats : allStats)
+	{
+		stream << std::format("  {}: opens={} reads={} seeks={} bytes={} (bank={} sample={} stream={}) "
+			"size p50={} max={} latency p50={:.1f} p99={:.1f} max={:.1f}",
+			stats->path, stats->opens.load(std::memory_order_relaxed), stats->reads.load(std::memory_order_relaxed),
+			stats->seeks.load(std::memory_order_relaxed), stats->bytesRead.load(std::memory_order_relaxed),
+			stats->bytesReadByKind[FILE_TRACE_KIND_BANK].load(std::memory_order_relaxed),
+			stats->bytesReadByKind[FILE_TRACE_KIND_SAMPLE].load(std::memory_order_relaxed),
+			stats->bytesReadByKind[FILE_TRACE_KIND_STREAM].load(std::memory_order_relaxed),
+			stats->readSizeBytes.GetPercentile(50), stats->readSizeBytes.GetMax(),
+			static_cast<double>(stats->readLatencyNs.GetPercentile(50)) * 0.001,
+			static_cast<double>(stats->readLatencyNs.GetPercentile(99)) * 0.001,
+			static_cast<double>(stats->readLatencyNs.GetMax()) * 0.001) << std::endl;
+	}
+}
+
+AudioFileStats* AudioFileTracer::GetOrCreateStats(const char* path)
+{
+	std::lock_guard lock(mStatsMutex);
+	std::unique_ptr<AudioFileStats>& stats = mStats[path];
+	if (!stats)
+	{
+		stats = std::make_unique<AudioFileStats>();
+		stats->path = path;
+	}
+	return stats.get();
+}
+
+void AudioFileTracer::WriteRecord(const TracedFile& tracedFile, const FileTraceOp op, const uint32_t position,
+	const uint32_t sizeBytes, const uint32_t bytesRead, const uint64_t latencyNs, const int64_t timeNs, const char* path)
+{
+	if (!mTraceFile) { return; }
+
+	FileTraceRecord record = {};
+	record.timeNs = static_cast<uint64_t>(std::max<int64_t>(timeNs - mStartTimeNs, 0));
+	record.fileId = tracedFile.fileId;
+	record.position = position;
+	record.sizeBytes = sizeBytes;
+	record.bytesRead = bytesRead;
+	record.latencyNs = static_cast<uint32_t>(std::min<uint64_t>(latencyNs, UINT32_MAX));
+	record.op = op;
+	record.kind = tracedFile.kind;
+
+	std::lock_guard lock(mBufferMutex);
+	const auto* recordBytes = reinterpret_cast<const uint8_t*>(&record);
+	mBuffer.insert(mBuffer.end(), recordBytes, recordBytes + sizeof(record));
+	if (path)
+	{
+		mBuffer.insert(mBuffer.end(), path, path + sizeBytes);
+		mBuffer.resize(mBuffer.size() + (8 - sizeBytes % 8) % 8, 0);
+	}
+
+	if (mBuffer.size() >= FLUSH_THRESHOLD_BYTES) { FlushLocked(); }
+}
+
+void AudioFileTracer::FlushLocked()
+{
+	if (mTraceFile && !mBuffer.empty())
+	{
+		std::fwrite(mBuffer.data(), 1, mBuffer.size(), mTraceFile);
+	}
+	mBuffer.clear();
+}
+
+FMOD_RESULT F_CALL AudioFileTracer::FileOpenCallback(const char* name, unsigned int* fileSize, void** handle, void* userData)
+{
+	AudioFileTracer* tracer = sActiveTracer;
+	if (!(tracer && name)) { return FMOD_ERR_FILE_NOTFOUND; }
+
+	std::FILE* file = std::fopen(name, "rb");
+	if (!file) { return FMOD_ERR_FILE_NOTFOUND; }
+
+	std::fseek(file, 0, SEEK_END);
+	const long size = std::ftell(file);
+	std::fseek(file, 0, SEEK_SET);
+	if (size < 0)
+	{
+		std::fclose(file);
+		return FMOD_ERR_FILE_BAD;
+	}
+
+	auto* tracedFile = new TracedFile();
+	tracedFile->file = file;
+	tracedFile->stats = tracer->GetOrCreateStats(name);
+	tracedFile->fileId = tracer->mNextFileId.fetch_add(1, std::memory_order_relaxed);
+	tracedFile->kind = tracer->mBankLoadDepth.load(std::memory_order_relaxed) > 0 ? FILE_TRACE_KIND_BANK : FILE_TRACE_KIND_UNKNOWN;
+	tracedFile->stats->opens.fetch_add(1, std::memory_order_relaxed);
+
+	*fileSize = static_cast<unsigned int>(size);
+	*handle = tracedFile;
+
+	tracer->WriteRecord(*tracedFile, FILE_TRACE_OP_OPEN, *fileSize, static_cast<uint32_t>(std::strlen(name)), 0, 0,
+		GetSteadyTimeNs(), name);
+	return FMOD_OK;
+}
+
+FMOD_RESULT F_CALL AudioFileTracer::FileCloseCallback(void* handle, void* userData)
+{
+	auto* tracedFile = static_cast<TracedFile*>(handle);
+	if (!tracedFile) { return FMOD_ERR_INVALID_PARAM; }
+
+	if (tracedFile->kind == FILE_TRACE_KIND_UNKNOWN)
+	{
+		tracedFile->kind = tracedFile->maxReadGapNs > STREAM_READ_GAP_NS ? FILE_TRACE_KIND_STREAM : FILE_TRACE_KIND_SAMPLE;
+	}
+	tracedFile->stats->bytesReadByKind[tracedFile->kind].fetch_add(tracedFile->bytesRead, std::memory_order_relaxed);
+
+	if (AudioFileTracer* tracer = sActiveTracer)
+	{
+		tracer->WriteRecord(*tracedFile, FILE_TRACE_OP_CLOSE, tracedFile->position, 0, 0, 0, GetSteadyTimeNs());
+	}
+
+	std::fclose(tracedFile->file);
+	delete tracedFile;
+	return FMOD_OK;
+}
+
+FMOD_RESULT F_CALL AudioFileTracer::FileReadCallback(void* handle, void* buffer, const unsigned int sizeBytes,
+	unsigned int* bytesRead, void* userData)
+{
+	auto* tracedFile = static_cast<TracedFile*>(handle);
+	if (!tracedFile) { return FMOD_ERR_INVALID_PARAM; }
+
+	const int64_t startNs = GetSteadyTimeNs();
+	*bytesRead = static_cast<unsigned int>(std::fread(buffer, 1, sizeBytes, tracedFile->file));
+	const int64_t endNs = GetSteadyTimeNs();
+	const uint64_t latencyNs = static_cast<uint64_t>(endNs - startNs);
+
+	if (tracedFile->lastReadNs != 0)
+	{
+		tracedFile->maxReadGapNs = std::max(tracedFile->maxReadGapNs, startNs - tracedFile->lastReadNs);
+	}
+	tracedFile->lastReadNs = endNs;
+	tracedFile->bytesRead += *bytesRead;
+
+	AudioFileStats* stats = tracedFile->stats;
+	stats->reads.fetch_add(1, std::memory_order_relaxed);
+	stats->bytesRead.fetch_add(*bytesRead, std::memory_order_relaxed);
+	stats->readSizeBytes.Record(sizeBytes);
+	stats->readLatencyNs.Record(latencyNs);
+
+	if (AudioFileTracer* tracer = sActiveTracer)
+	{
+		tracer->WriteRecord(*tracedFile, FILE_TRACE_OP_READ, tracedFile->position, sizeBytes, *bytesRead, latencyNs, startNs);
+	}
+	tracedFile->position += *bytesRead;
+
+	return *bytesRead < sizeBytes ? FMOD_ERR_FILE_EOF : FMOD_OK;
+}
+
+FMOD_RESULT F_CALL AudioFileTracer::FileSeekCallback(void* handle, const unsigned int position, void* userData)
+{
+	auto* tracedFile = static_cast<TracedFile*>(handle);
+	if (!tracedFile) { return FMOD_ERR_INVALID_PARAM; }
+
+	const int64_t startNs = GetSteadyTimeNs();
+	if (std::fseek(tracedFile->file, static_cast<long>(position), SEEK_SET) != 0) { return FMOD_ERR_FILE_COULDNOTSEEK; }
+	const uint64_t latencyNs = static_cast<uint64_t>(GetSteadyTimeNs() - startNs);
+
+	tracedFile->position = position;
+	tracedFile->stats->seeks.fetch_add(1, std::memory_order_relaxed);
+
+	if (AudioFileTracer* tracer = sActiveTracer)
+	{
+		tracer->WriteRecord(*tracedFile, FILE_TRACE_OP_SEEK, position, 0, 0, latencyNs, startNs);
+	}
+	return FMOD_OK;
+}
@@ -0,0 +1,104 @@
+#ifndef AUDIO_FILE_TRACER_H
+#define AUDIO_FILE_TRACER_H
+
+#include "fmod.hpp"
+
+#include "audio_file_trace_layout.h"
+#include "profiling/histogram.h"
+
+/** Disk access statistics of one path, shared by every handle FMOD opened on it */
+struct AudioFileStats
+{
+	std::string path;
+	std::atomic<uint64_t> opens = 0;
+	std::atomic<uint64_t> reads = 0;
+	std::atomic<uint64_t> seeks = 0;
+	std::atomic<uint64_t> bytesRead = 0;
+	std::array<std::atomic<uint64_t>, FILE_TRACE_KIND_COUNT> bytesReadByKind = {}; // Added when a handle is closed
+	HdrHistogram readSizeBytes;
+	HdrHistogram readLatencyNs;
+};
+
+/**
+ * @brief Replaces FMOD's file system with traced stdio open, close, read and seek callbacks
+ * Must be installed before the Core System is initialized, toggled by [Profiling] EnableFileTracing.
+ * Callbacks run on FMOD's loading and stream threads. Stats are lock-free, binary trace records are
+ * buffered under a mutex and flushed in 64 KB blocks, which is negligible next to the disk reads being traced.
+ *
+ * Handles opened during AudioEngine::LoadSoundBankFile are attributed to the bank load. Other handles are
+ * resolved on close: a stream keeps its handle open and reads it as the sound plays, so any gap between two
+ * reads longer than STREAM_READ_GAP_NS marks a stream; sample data loads read back to back.
+ * Refer to: https://www.fmod.com/docs/2.03/api/core-api-system.html#system_setfilesystem
+ */
+class AudioFileTracer
+{
+	public:
+		/** Marks file opens as bank loads for its lifetime, accepts a null tracer */
+		class BankLoadScope
+		{
+			public:
+				explicit BankLoadScope(AudioFileTracer* tracer);
+				~BankLoadScope();
+
+				BankLoadScope(const BankLoadScope&) = delete;
+				BankLoadScope& operator=(const BankLoadScope&) = delete;
+
+			private:
+				AudioFileTracer* mTracer;
+		};
+
+		/** An empty tracePath only collects stats */
+		explicit AudioFileTracer(const std::string& tracePath);
+		~AudioFileTracer();
+
+		AudioFileTracer(const AudioFileTracer&) = delete;
+		AudioFileTracer& operator=(const AudioFileTracer&) = delete;
+
+		bool Install(FMOD::System* coreSystem);
+		/** Writes buffered records, call after the Studio System is released so every handle is closed */
+		void Flush();
+
+		/** Main thread only. Pointers stay valid until the tracer is destroyed. */
+		void GetFileStats(std::vector<const AudioFileStats*>& outStats) const;
+		void DumpStats(std::ostream& stream) const;
+
+	private:
+		struct TracedFile
+		{
+			std::FILE* file = nullptr;
+			AudioFileStats* stats = nullptr;
+			uint32_t fileId = 0;
+			uint32_t position = 0;
+			FileTraceKind kind = FILE_TRACE_KIND_UNKNOWN;
+			int64_t lastReadNs = 0;
+			int64_t maxReadGapNs = 0;
+			uint64_t bytesRead = 0;
+		};
+
+		static constexpr int64_t STREAM_READ_GAP_NS = 100'000'000;
+		static constexpr size_t FLUSH_THRESHOLD_BYTES = 64 * 1024;
+
+		static AudioFileTracer* sActiveTracer;
+
+		std::FILE* mTraceFile;
+		int64_t mStartTimeNs;
+		std::atomic<uint32_t> mNextFileId;
+		std::atomic<int> mBankLoadDepth;
+
+		mutable std::mutex mStatsMutex;
+		std::unordered_map<std::string, std::unique_ptr<AudioFileStats>> mStats;
+
+		std::mutex mBufferMutex;
+		std::vector<uint8_t> mBuffer;
+
+		AudioFileStats* GetOrCreateStats(const char* path);
+		void WriteRecord(const TracedFile& tracedFile, FileTraceOp op, uint32_t position, uint32_t sizeBytes,
+			uint32_t bytesRead, uint64_t latencyNs, int64_t timeNs, const char* path = nullptr);
+		void FlushLocked();
+
+		static FMOD_RESULT F_CALL FileOpenCallback(const char* name, unsigned int* fileSize, void** handle, void* userData);
+		static FMOD_RESULT F_CALL FileCloseCallback(void* handle, void* userData);
+		static FMOD_RESULT F_CALL FileReadCallback(void* handle, void* buffer, unsigned int sizeBytes, unsigned int* bytesRead, void* userData);
+		static FMOD_RESULT F_CALL FileSeekCallback(void* handle, unsigned int position, void* userData);
+};
+#endif
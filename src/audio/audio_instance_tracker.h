@@ -0,0 +1,138 @@
+#ifndef AUDIO_INSTANCE_TRACKER_H
+#define AUDIO_INSTANCE_TRACKER_H
+
+#include "fmod_studio.hpp"
+
+#include "profiling/histogram.h"
+
+/**
+ * @brief First-play latency of one event path
+ * startedUs: PlayAudioEvent -> FMOD_STUDIO_EVENT_CALLBACK_STARTED (wall clock)
+ * soundPlayedUs: PlayAudioEvent -> first FMOD_STUDIO_EVENT_CALLBACK_SOUND_PLAYED (wall clock)
+ * soundPlayedSamples: mixer DSP clock progress between PlayAudioEvent and the first SOUND_PLAYED
+ */
+struct AudioEventLatencyStats
+{
+	std::string path;
+	HdrHistogram startedUs;
+	HdrHistogram soundPlayedUs;
+	HdrHistogram soundPlayedSamples;
+};
+
+/** Execution time (ns) of the caller callbacks attached to instances of one event path */
+struct AudioEventCallbackStats
+{
+	std::string path;
+	HdrHistogram durationNs;
+	std::atomic<uint64_t> overBudgetCount = 0;
+};
+
+/**
+ * @brief Engine-side record attached (as user data) to the instances created by AudioEngine::PlayAudioEvent
+ * Only attached while a feature needs it (first-play latency, callback profiling, owner accounting, journal).
+ * Holds the caller's user data and callback so the engine callback can run first and forward afterward.
+ */
+struct TrackedAudioInstance
+{
+	std::atomic<bool> bInUse = false;
+
+	FMOD::Studio::EventInstance* instance = nullptr;
+	int ownerIndex = -1;
+	void* userData = nullptr;
+	std::atomic<FMOD_STUDIO_EVENT_CALLBACK> userCallback = nullptr;
+	std::atomic<FMOD_STUDIO_EVENT_CALLBACK_TYPE> userCallbackMask = 0;
+
+	AudioEventLatencyStats* latencyStats = nullptr;
+	AudioEventCallbackStats* callbackStats = nullptr;
+	int64_t playRequestTimeNs = 0;
+	unsigned long long playRequestDSPClock = 0;
+	std::atomic<bool> bStartedReported = false;
+	std::atomic<bool> bSoundPlayedReported = false;
+};
+
+/**
+ * @brief Fixed pool of TrackedAudioInstance records
+ * Acquire is called from the thread creating instances, Release from the FMOD Studio thread when the
+ * instance is destroyed. Neither allocates nor locks.
+ */
+class AudioInstanceTracker
+{
+	public:
+		explicit AudioInstanceTracker(const size_t capacity = 1024)
+		: mCapacity(std::max<size_t>(capacity, 1))
+		, mRecords(std::make_unique<TrackedAudioInstance[]>(mCapacity))
+		{}
+
+		TrackedAudioInstance* Acquire()
+		{
+			const size_t start = mCursor.load(std::memory_order_relaxed);
+			for (size_t i = 0; i < mCapacity; ++i)
+			{
+				const size_t index = (start + i) % mCapacity;
+				bool bExpected = false;
+				if (mRecords[index].bInUse.compare_exchange_strong(bExpected, true, std::memory_order_acquire))
+				{
+					mCursor.store(index + 1, std::memory_order_relaxed);
+					mActiveCount.fetch_add(1, std::memory_order_relaxed);
+					Reset(mRecords[index]);
+					return &mRecords[index];
+				}
+			}
+
+			mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		void Release(TrackedAudioInstance* record)
+		{
+			if (Owns(record))
+			{
+				mActiveCount.fetch_sub(1, std::memory_order_relaxed);
+				record->bInUse.store(false, std::memory_order_release);
+			}
+		}
+
+		[[nodiscard]] bool Owns(const void* pointer) const
+		{
+			const void* begin = mRecords.get();
+			const void* end = mRecords.get() + mCapacity;
+			return !std::less<const void*>()(pointer, begin) && std::less<const void*>()(pointer, end);
+		}
+
+		/** Visits every record currently in use. Records can be released concurrently, only use FMOD handles from them. */
+		template <typename Visitor>
+		void ForEachInUse(Visitor&& visitor) const
+		{
+			for (size_t i = 0; i < mCapacity; ++i)
+			{
+				if (mRecords[i].bInUse.load(std::memory_order_acquire)) { visitor(mRecords[i]); }
+			}
+		}
+
+		[[nodiscard]] size_t GetCapacity() const { return mCapacity; }
+		[[nodiscard]] uint64_t GetActiveCount() const { return mActiveCount.load(std::memory_order_relaxed); }
+		[[nodiscard]] uint64_t GetDroppedCount() const { return mDroppedCount.load(std::memory_order_relaxed); }
+
+	private:
+		size_t mCapacity;
+		std::unique_ptr<TrackedAudioInstance[]> mRecords;
+		std::atomic<size_t> mCursor = 0;
+		std::atomic<uint64_t> mActiveCount = 0;
+		std::atomic<uint64_t> mDroppedCount = 0;
+
+		static void Reset(TrackedAudioInstance& record)
+		{
+			record.instance = nullptr;
+			record.ownerIndex = -1;
+			record.userData = nullptr;
+			record.userCallback.store(nullptr, std::memory_order_relaxed);
+			record.userCallbackMask.store(0, std::memory_order_relaxed);
+			record.latencyStats = nullptr;
+			record.callbackStats = nullptr;
+			record.playRequestTimeNs = 0;
+			record.playRequestDSPClock = 0;
+			record.bStartedReported.store(false, std::memory_order_relaxed);
+			record.bSoundPlayedReported.store(false, std::memory_order_relaxed);
+		}
+};
+#endif
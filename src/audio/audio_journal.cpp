@@ -0,0 +1,134 @@
+#include "audio_journal.h"
+
+#include "profiling/steady_time.h"
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+std::unique_ptr<AudioJournal> AudioJournal::Create(const std::string& path, const uint32_t recordCapacity, const uint32_t nameCapacity)
+{
+	if (recordCapacity == 0) { return nullptr; }
+
+#ifdef WIN32
+	std::cout << "AudioJournal: the memory-mapped journal is only available on POSIX platforms" << std::endl;
+	return nullptr;
+#else
+	const size_t mappedBytes = sizeof(JournalHeader) + sizeof(JournalName) * nameCapacity + sizeof(JournalRecord) * recordCapacity;
+
+	const int fileDescriptor = open(path.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+	if (fileDescriptor < 0) { return nullptr; }
+
+	if (ftruncate(fileDescriptor, static_cast<off_t>(mappedBytes)) != 0)
+	{
+		close(fileDescriptor);
+		return nullptr;
+	}
+
+	void* memory = mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+	close(fileDescriptor);
+	if (memory == MAP_FAILED) { return nullptr; }
+
+	auto journal = std::unique_ptr<AudioJournal>(new AudioJournal(memory, mappedBytes, nameCapacity));
+	JournalHeader* header = journal->mHeader;
+	header->version = JOURNAL_LAYOUT_VERSION;
+	header->recordSize = sizeof(JournalRecord);
+	header->recordCapacity = recordCapacity;
+	header->nameCapacity = nameCapacity;
+	header->startUnixTimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::system_clock::now().time_since_epoch()).count();
+	header->writerProcessId = static_cast<uint32_t>(getpid());
+	std::atomic_thread_fence(std::memory_order_release);
+	header->magic = JOURNAL_MAGIC;
+
+	std::cout << std::format("AudioJournal: recording the last {} actions to {}", recordCapacity, path) << std::endl;
+	return journal;
+#endif
+}
+
+// The file was just truncated, so the whole mapping already reads as zero (empty names and records)
+AudioJournal::AudioJournal(void* memory, const size_t mappedBytes, const uint32_t nameCapacity)
+: mMemory(memory)
+, mMappedBytes(mappedBytes)
+, mHeader(static_cast<JournalHeader*>(memory))
+, mNames(reinterpret_cast<JournalName*>(mHeader + 1))
+, mRecords(reinterpret_cast<JournalRecord*>(mNames + nameCapacity))
+, mStartTimeNs(GetSteadyTimeNs())
+, mNameSlotMask(std::bit_ceil(std::max(nameCapacity * 2, 2u)) - 1)
+, mNameSlots(std::make_unique<NameSlot[]>(mNameSlotMask + 1))
+{}
+
+AudioJournal::~AudioJournal()
+{
+#ifndef WIN32
+	msync(mMemory, mMappedBytes, MS_SYNC);
+	munmap(mMemory, mMappedBytes);
+#endif
+}
+
+uint32_t AudioJournal::RegisterName(const std::string_view name)
+{
+	// Stored names are truncated, so that is what a registered name is compared against
+	const std::string_view storedName = name.substr(0, JOURNAL_MAX_NAME - 1);
+	std::atomic_ref nameCount(mHeader->nameCount);
+	const uint32_t index = nameCount.load(std::memory_order_relaxed);
+
+	// A name sits in the run of occupied slots that starts at its hash, also when a collision moved it to a later id
+	const uint32_t hashId = GetJournalNameId(name.data(), name.size());
+	bool bHashIdTaken = false;
+	for (uint32_t slotIndex = hashId & mNameSlotMask; mNameSlots[slotIndex].nameId != 0; slotIndex = (slotIndex + 1) & mNameSlotMask)
+	{
+		const NameSlot& slot = mNameSlots[slotIndex];
+		if (mNames[slot.nameIndex].name == storedName) { return slot.nameId; }
+		bHashIdTaken |= slot.nameId == hashId;
+	}
+
+	if (index >= mHeader->nameCapacity) { return bHashIdTaken ? 0 : hashId; } // Not stored, and no id if another name has it
+
+	// The hash is the id unless another name has it, then the next free one (0 means no name)
+	uint32_t nameId = hashId;
+	uint32_t slotIndex = nameId & mNameSlotMask;
+	while (mNameSlots[slotIndex].nameId != 0)
+	{
+		if (mNameSlots[slotIndex].nameId == nameId)
+		{
+			nameId = nameId == UINT32_MAX ? 1 : nameId + 1;
+			slotIndex = nameId & mNameSlotMask;
+			continue;
+		}
+		slotIndex = (slotIndex + 1) & mNameSlotMask;
+	}
+
+	JournalName& journalName = mNames[index];
+	journalName.nameId = nameId;
+	std::memcpy(journalName.name, storedName.data(), storedName.size());
+	journalName.name[storedName.size()] = '\0';
+	nameCount.store(index + 1, std::memory_order_release);
+
+	mNameSlots[slotIndex] = {nameId, index};
+	return nameId;
+}
+
+void AudioJournal::Record(const JournalOp op, const void* handle, const uint32_t nameId, const uint32_t data,
+	const float x, const float y, const float z)
+{
+	const uint64_t writeIndex = std::atomic_ref(mHeader->writeIndex).fetch_add(1, std::memory_order_relaxed);
+	JournalRecord& record = mRecords[writeIndex % mHeader->recordCapacity];
+
+	std::atomic_ref sequence(record.sequence);
+	sequence.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	record.timeNs = static_cast<uint64_t>(GetSteadyTimeNs() - mStartTimeNs);
+	record.handle = reinterpret_cast<uintptr_t>(handle);
+	record.nameId = nameId;
+	record.data = data;
+	record.values[0] = x;
+	record.values[1] = y;
+	record.values[2] = z;
+	record.op = op;
+
+	sequence.store(writeIndex + 1, std::memory_order_release);
+}
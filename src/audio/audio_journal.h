@@ -0,0 +1,49 @@
+#ifndef AUDIO_JOURNAL_H
+#define AUDIO_JOURNAL_H
+
+#include "audio_journal_layout.h"
+
+/**
+ * @brief Fixed-width binary record of every engine-level action, kept in a memory-mapped ring file
+ * Enabled by [Journal] EnableJournal. The file is mapped shared, so the last recordCapacity actions survive
+ * a crash or a kill and can be decoded afterwards with tools/journal_decoder.cpp.
+ * Record() is lock-free and allocation-free so it can run on FMOD's callback threads.
+ */
+class AudioJournal
+{
+	public:
+		/** Returns null if the journal file cannot be created or mapped */
+		static std::unique_ptr<AudioJournal> Create(const std::string& path, uint32_t recordCapacity, uint32_t nameCapacity);
+		~AudioJournal();
+
+		AudioJournal(const AudioJournal&) = delete;
+		AudioJournal& operator=(const AudioJournal&) = delete;
+
+		/** Main thread only, allocation-free. A hash collision with another stored name moves the name to the next free id.
+		 * Names past nameCapacity are still hashed but not stored, and get no id (0) if theirs belongs to a stored name. */
+		uint32_t RegisterName(std::string_view name);
+
+		void Record(JournalOp op, const void* handle, uint32_t nameId = 0, uint32_t data = 0,
+			float x = 0.0f, float y = 0.0f, float z = 0.0f);
+
+	private:
+		void* mMemory;
+		size_t mMappedBytes;
+		JournalHeader* mHeader;
+		JournalName* mNames;
+		JournalRecord* mRecords;
+		int64_t mStartTimeNs;
+
+		// Open-addressed index of the stored names by id, at most half full
+		struct NameSlot
+		{
+			uint32_t nameId = 0;
+			uint32_t nameIndex = 0;
+		};
+
+		uint32_t mNameSlotMask;
+		std::unique_ptr<NameSlot[]> mNameSlots;
+
+		AudioJournal(void* memory, size_t mappedBytes, uint32_t nameCapacity);
+};
+#endif
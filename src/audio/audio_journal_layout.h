@@ -0,0 +1,99 @@
+#ifndef AUDIO_JOURNAL_LAYOUT_H
+#define AUDIO_JOURNAL_LAYOUT_H
+
+/*
+ * Memory-mapped audio journal, written by AudioJournal and read by tools/journal_decoder.cpp.
+ * Shared with the decoder, so this header only uses fixed-size types and must stay free of FMOD and raylib.
+ * Bump JOURNAL_LAYOUT_VERSION whenever the header, a name or a record changes; readers reject other versions.
+ *
+ * File layout: JournalHeader, nameCapacity JournalNames, then recordCapacity JournalRecords used as a ring.
+ * A record slot is written at (sequence - 1) % recordCapacity. Its sequence is cleared before the payload
+ * is written and published last, so a slot with sequence 0 is empty or was being written when the app died.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+constexpr uint32_t JOURNAL_MAGIC = 0x4C4E524A; // "JRNL"
+constexpr uint16_t JOURNAL_LAYOUT_VERSION = 1;
+constexpr int JOURNAL_MAX_NAME = 124;
+
+enum JournalOp : uint8_t
+{
+	JOURNAL_OP_BANK_LOAD,       // handle: bank, name: bank file, data: FMOD_RESULT
+	JOURNAL_OP_BANK_UNLOAD,     // handle: bank, data: FMOD_RESULT
+	JOURNAL_OP_PLAY,            // handle: instance, name: event path, data: 1 if auto-started, values: position
+	JOURNAL_OP_START,           // handle: instance
+	JOURNAL_OP_STOP,            // handle: instance, data: 1 if fading out
+	JOURNAL_OP_RELEASE,         // handle: instance
+	JOURNAL_OP_PARAMETER,       // handle: instance (0 = global), name: parameter (0 when set by ID, data: ID data1), values[0]: value
+	JOURNAL_OP_PARAMETER_LABEL, // handle: instance (0 = global), name: parameter, data: name id of the label
+	JOURNAL_OP_3D_ATTRIBUTES,   // handle: instance, values: position
+	JOURNAL_OP_CALLBACK,        // handle: instance, data: FMOD_STUDIO_EVENT_CALLBACK_TYPE
+	JOURNAL_OP_COUNT
+};
+
+struct JournalHeader
+{
+	uint32_t magic;
+	uint16_t version;
+	uint16_t recordSize;
+	uint32_t recordCapacity;
+	uint32_t nameCapacity;
+	int64_t startUnixTimeNs; // Wall clock when the journal was created, record times are steady time since then
+	uint64_t writeIndex;     // Records written so far, only accessed atomically by the writer
+	uint32_t nameCount;      // Published names, only accessed atomically by the writer
+	uint32_t writerProcessId;
+	uint8_t reserved[24];
+};
+
+struct JournalName
+{
+	uint32_t nameId; // FNV-1a of the name, or the next free id when another name already has that hash
+	char name[JOURNAL_MAX_NAME];
+};
+
+struct JournalRecord
+{
+	uint64_t sequence;
+	uint64_t timeNs;
+	uint64_t handle;
+	uint32_t nameId;
+	uint32_t data;
+	float values[3];
+	uint8_t op; // JournalOp
+	uint8_t reserved[3];
+};
+
+static_assert(sizeof(JournalHeader) == 64);
+static_assert(sizeof(JournalName) == 128);
+static_assert(sizeof(JournalRecord) == 48);
+
+constexpr uint32_t GetJournalNameId(const char* name, const size_t length)
+{
+	uint32_t hash = 2166136261u;
+	for (size_t i = 0; i < length; ++i)
+	{
+		hash = (hash ^ static_cast<uint8_t>(name[i])) * 16777619u;
+	}
+	return hash == 0 ? 1 : hash; // 0 means no name
+}
+
+inline const char* GetJournalOpName(const uint8_t op)
+{
+	switch (op)
+	{
+		case JOURNAL_OP_BANK_LOAD: return "bank_load";
+		case JOURNAL_OP_BANK_UNLOAD: return "bank_unload";
+		case JOURNAL_OP_PLAY: return "play";
+		case JOURNAL_OP_START: return "start";
+		case JOURNAL_OP_STOP: return "stop";
+		case JOURNAL_OP_RELEASE: return "release";
+		case JOURNAL_OP_PARAMETER: return "parameter";
+		case JOURNAL_OP_PARAMETER_LABEL: return "parameter_label";
+		case JOURNAL_OP_3D_ATTRIBUTES: return "3d_attributes";
+		case JOURNAL_OP_CALLBACK: return "callback";
+		default: return "unknown";
+	}
+}
+#endif
@@ -0,0 +1,240 @@
+#include "audio_logger.h"
+
+#include "fmod_errors.h"
+
+namespace
+{
+	constexpr auto LOG_DRAIN_INTERVAL = std::chrono::milliseconds(20);
+
+	int64_t GetSystemTimeNs()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::system_clock::now().time_since_epoch()).count();
+	}
+
+	void CopyTruncated(char* destination, const size_t destinationSize, const char* source)
+	{
+		if (!source)
+		{
+			destination[0] = '\0';
+			return;
+		}
+		const size_t length = strnlen(source, destinationSize - 1);
+		std::memcpy(destination, source, length);
+		destination[length] = '\0';
+	}
+
+	uint64_t HashCombine(uint64_t hash, const void* data, const size_t size)
+	{
+		const auto* bytes = static_cast<const uint8_t*>(data);
+		for (size_t i = 0; i < size; ++i)
+		{
+			hash = (hash ^ bytes[i]) * 1099511628211ull;
+		}
+		return hash;
+	}
+
+	const char* GetLevelName(const AudioLogLevel level)
+	{
+		switch (level)
+		{
+			case AudioLogLevel::Warning: return "Warning";
+			case AudioLogLevel::Error: return "Error";
+			case AudioLogLevel::ApiError: return "API Error";
+			default: return "Log";
+		}
+	}
+}
+
+AudioLogger::AudioLogger(const size_t capacity, const int64_t rateLimitMs)
+: mRecords(std::make_unique<Record[]>(std::bit_ceil(std::max<size_t>(capacity, 2))))
+, mCapacityMask(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1)
+, mRateLimitNs(std::max<int64_t>(rateLimitMs, 0) * 1000000)
+, mEnqueuePosition(0)
+, mDequeuePosition(0)
+, mDroppedCount(0)
+, mReportedDroppedCount(0)
+, bStopRequested(false)
+{
+	// Slot i is free for the producer that claims position i
+	for (size_t i = 0; i <= mCapacityMask; ++i)
+	{
+		mRecords[i].sequence.store(i, std::memory_order_relaxed);
+	}
+	mThread = std::thread(&AudioLogger::ThreadMain, this);
+}
+
+AudioLogger::~AudioLogger()
+{
+	bStopRequested.store(true, std::memory_order_relaxed);
+	if (mThread.joinable()) { mThread.join(); }
+
+	Drain();
+	FlushAggregates(GetSystemTimeNs(), true);
+}
+
+void AudioLogger::PushLog(const AudioLogLevel level, const char* file, const int line, const char* function, const char* message)
+{
+	uint64_t position = 0;
+	Record* record = BeginPush(position);
+	if (!record) { return; }
+
+	record->timeNs = GetSystemTimeNs();
+	record->level = level;
+	record->line = line;
+	record->result = FMOD_OK;
+	record->instanceType = FMOD_ERRORCALLBACK_INSTANCETYPE_NONE;
+	record->instance = nullptr;
+	CopyTruncated(record->source, MAX_SOURCE, function ? function : file);
+	CopyTruncated(record->message, MAX_MESSAGE, message);
+	EndPush(*record, position);
+}
+
+void AudioLogger::PushApiError(const FMOD_ERRORCALLBACK_INFO& errorInfo)
+{
+	uint64_t position = 0;
+	Record* record = BeginPush(position);
+	if (!record) { return; }
+
+	record->timeNs = GetSystemTimeNs();
+	record->level = AudioLogLevel::ApiError;
+	record->line = 0;
+	record->result = errorInfo.result;
+	record->instanceType = errorInfo.instancetype;
+	record->instance = errorInfo.instance;
+	CopyTruncated(record->source, MAX_SOURCE, errorInfo.functionname);
+	CopyTruncated(record->message, MAX_MESSAGE, errorInfo.functionparams);
+	EndPush(*record, position);
+}
+
+// Bounded multi-producer ring (Vyukov): a slot's sequence equals the position it can be claimed at,
+// position + 1 once it holds a record and position + capacity once the writer thread consumed it.
+AudioLogger::Record* AudioLogger::BeginPush(uint64_t& outPosition)
+{
+	uint64_t position = mEnqueuePosition.load(std::memory_order_relaxed);
+	while (true)
+	{
+		Record& record = mRecords[position & mCapacityMask];
+		const uint64_t sequence = record.sequence.load(std::memory_order_acquire);
+		const auto difference = static_cast<int64_t>(sequence - position);
+
+		if (difference == 0)
+		{
+			if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+			{
+				outPosition = position;
+				return &record;
+			}
+		}
+		else if (difference < 0)
+		{
+			mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+			return nullptr;
+		}
+		else
+		{
+			position = mEnqueuePosition.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+void AudioLogger::EndPush(Record& record, const uint64_t position)
+{
+	record.sequence.store(position + 1, std::memory_order_release);
+}
+
+void AudioLogger::ThreadMain()
+{
+	while (!bStopRequested.load(std::memory_order_relaxed))
+	{
+		Drain();
+		FlushAggregates(GetSystemTimeNs(), false);
+		std::this_thread::sleep_for(LOG_DRAIN_INTERVAL);
+	}
+}
+
+void AudioLogger::Drain()
+{
+	while (true)
+	{
+		Record& record = mRecords[mDequeuePosition & mCapacityMask];
+		if (record.sequence.load(std::memory_order_acquire) != mDequeuePosition + 1) { break; }
+
+		Write(record);
+		record.sequence.store(mDequeuePosition + mCapacityMask + 1, std::memory_order_release);
+		++mDequeuePosition;
+	}
+
+	if (const uint64_t droppedCount = GetDroppedCount(); droppedCount != mReportedDroppedCount)
+	{
+		std::cout << std::format("FMOD Log: dropped {} records, the log ring is full", droppedCount - mReportedDroppedCount) << std::endl;
+		mReportedDroppedCount = droppedCount;
+	}
+}
+
+void AudioLogger::Write(const Record& record)
+{
+	// Same call site, or same API function and result: the parameters and handles in the text change every time
+	uint64_t key = HashCombine(14695981039346656037ull, &record.level, sizeof(record.level));
+	key = HashCombine(key, record.source, strnlen(record.source, MAX_SOURCE));
+	key = HashCombine(key, record.level == AudioLogLevel::ApiError ? static_cast<const void*>(&record.result) : &record.line, sizeof(int32_t));
+
+	const auto time = std::chrono::system_clock::to_time_t(std::chrono::system_clock::time_point(
+		std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(record.timeNs))));
+
+	std::tm localTime {};
+#ifdef WIN32
+	localtime_s(&localTime, &time);   // Windows (safe version)
+#else
+	localtime_r(&time, &localTime);   // POSIX (safe version on Linux/macOS)
+#endif
+
+	char timeText[32];
+	std::strftime(timeText, sizeof(timeText), "%d-%b-%Y %H:%M:%S", &localTime);
+
+	std::string_view message = record.message;
+	while (!message.empty() && std::isspace(static_cast<unsigned char>(message.back()))) { message.remove_suffix(1); }
+
+	std::string line;
+	if (record.level == AudioLogLevel::ApiError)
+	{
+		line = std::format("FMOD {} [{}] {}({}) returned {} \"{}\" for instance type {} ({})", GetLevelName(record.level),
+			timeText, record.source, message, static_cast<int>(record.result), FMOD_ErrorString(record.result),
+			static_cast<int>(record.instanceType), record.instance);
+	}
+	else
+	{
+		line = std::format("FMOD {} [{}] {}", GetLevelName(record.level), timeText, message);
+	}
+
+	Aggregate& aggregate = mAggregates[key];
+	if (aggregate.windowStartNs != 0 && record.timeNs - aggregate.windowStartNs < mRateLimitNs)
+	{
+		++aggregate.suppressedCount;
+		aggregate.lastSuppressedLine = std::move(line);
+		return;
+	}
+
+	if (aggregate.suppressedCount > 0)
+	{
+		std::cout << std::format("{} (repeated {} times)", aggregate.lastSuppressedLine, aggregate.suppressedCount) << std::endl;
+		aggregate.suppressedCount = 0;
+	}
+	aggregate.windowStartNs = record.timeNs;
+	std::cout << line << std::endl;
+}
+
+void AudioLogger::FlushAggregates(const int64_t nowNs, const bool bForce)
+{
+	for (auto& aggregate : mAggregates | std::views::values)
+	{
+		if (aggregate.suppressedCount == 0 || (!bForce && nowNs - aggregate.windowStartNs < mRateLimitNs)) { continue; }
+
+		std::cout << std::format("{} (repeated {} times)", aggregate.lastSuppressedLine, aggregate.suppressedCount) << std::endl;
+		aggregate.suppressedCount = 0;
+		aggregate.lastSuppressedLine.clear();
+
+		// The next occurrence opens a new window and prints right away
+		aggregate.windowStartNs = 0;
+	}
+}
@@ -0,0 +1,83 @@
+#ifndef AUDIO_LOGGER_H
+#define AUDIO_LOGGER_H
+
+#include "fmod.hpp"
+
+enum class AudioLogLevel : uint8_t
+{
+	Log,
+	Warning,
+	Error,
+	ApiError
+};
+
+/**
+ * @brief Asynchronous writer for FMOD's debug log and API error callbacks
+ * Push copies the raw callback data into a preallocated bounded ring (lock-free, no allocation), so FMOD's
+ * mixer, Studio and loading threads never format, take a lock or wait on std::cout. A background thread
+ * timestamps, formats and prints the records. The same call site (or API function and result) prints at most
+ * once per rate limit window; repeats are counted and summarized when the window ends.
+ * Records are dropped, and counted, when the ring is full.
+ */
+class AudioLogger
+{
+	public:
+		AudioLogger(size_t capacity, int64_t rateLimitMs);
+		~AudioLogger();
+
+		AudioLogger(const AudioLogger&) = delete;
+		AudioLogger& operator=(const AudioLogger&) = delete;
+
+		/** Callable from any thread */
+		void PushLog(AudioLogLevel level, const char* file, int line, const char* function, const char* message);
+		void PushApiError(const FMOD_ERRORCALLBACK_INFO& errorInfo);
+
+		[[nodiscard]] uint64_t GetDroppedCount() const { return mDroppedCount.load(std::memory_order_relaxed); }
+
+	private:
+		static constexpr size_t MAX_SOURCE = 96;
+		static constexpr size_t MAX_MESSAGE = 256;
+
+		struct Record
+		{
+			std::atomic<uint64_t> sequence = 0;
+			int64_t timeNs = 0; // System clock
+			AudioLogLevel level = AudioLogLevel::Log;
+			int32_t line = 0;
+			FMOD_RESULT result = FMOD_OK;
+			FMOD_ERRORCALLBACK_INSTANCETYPE instanceType = FMOD_ERRORCALLBACK_INSTANCETYPE_NONE;
+			const void* instance = nullptr;
+			char source[MAX_SOURCE] = {};
+			char message[MAX_MESSAGE] = {};
+		};
+
+		struct Aggregate
+		{
+			int64_t windowStartNs = 0;
+			uint64_t suppressedCount = 0;
+			std::string lastSuppressedLine;
+		};
+
+		std::unique_ptr<Record[]> mRecords;
+		size_t mCapacityMask;
+		int64_t mRateLimitNs;
+
+		alignas(64) std::atomic<uint64_t> mEnqueuePosition;
+		alignas(64) uint64_t mDequeuePosition; // Writer thread only
+		std::atomic<uint64_t> mDroppedCount;
+		uint64_t mReportedDroppedCount; // Writer thread only
+
+		std::unordered_map<uint64_t, Aggregate> mAggregates; // Writer thread only
+		std::thread mThread;
+		std::atomic<bool> bStopRequested;
+
+		/** Claims the next slot, null when the ring is full. EndPush publishes it to the writer thread. */
+		Record* BeginPush(uint64_t& outPosition);
+		static void EndPush(Record& record, uint64_t position);
+
+		void ThreadMain();
+		void Drain();
+		void Write(const Record& record);
+		void FlushAggregates(int64_t nowNs, bool bForce);
+};
+#endif
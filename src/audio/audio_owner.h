@@ -0,0 +1,53 @@
+#ifndef AUDIO_OWNER_H
+#define AUDIO_OWNER_H
+
+constexpr int AUDIO_MAX_OWNERS = 16;
+constexpr int AUDIO_OWNER_NONE = -1;
+
+/** Per-owner limits read from [Budget.<Owner>], 0 disables a limit */
+struct AudioOwnerBudget
+{
+	int maxBanks = 0;
+	int64_t maxBankMemoryBytes = 0;
+	int64_t maxSampleMemoryBytes = 0;
+	int64_t maxInstances = 0;
+	int maxVoices = 0;
+	float maxCallbackUsPerSecond = 0;
+};
+
+/** Resources attributed to one owner (usually a page), copied out by AudioEngine::GetOwnerStats */
+struct AudioOwnerStats
+{
+	std::string name;
+	AudioOwnerBudget budget;
+	int bankCount = 0;
+	int64_t bankMemoryBytes = 0;   // FMOD memory growth across the blocking bank loads, the bank metadata
+	int64_t sampleMemoryBytes = 0; // FMOD memory growth until the sample data of the owner's events reported LOADED
+	int64_t liveInstances = 0;
+	int voices = 0;              // Playing channels under the owner's instances, sampled a few times per second
+	float callbackUsPerSecond = 0;
+	uint32_t overBudgetMask = 0; // Bits from AudioOwnerBudgetFlags
+};
+
+enum AudioOwnerBudgetFlags : uint32_t
+{
+	AUDIO_OWNER_BUDGET_BANKS = 1 << 0,
+	AUDIO_OWNER_BUDGET_BANK_MEMORY = 1 << 1,
+	AUDIO_OWNER_BUDGET_INSTANCES = 1 << 2,
+	AUDIO_OWNER_BUDGET_VOICES = 1 << 3,
+	AUDIO_OWNER_BUDGET_CALLBACK_TIME = 1 << 4,
+	AUDIO_OWNER_BUDGET_SAMPLE_MEMORY = 1 << 5,
+};
+
+/**
+ * @brief Engine-side owner record. Lives in a fixed array so FMOD threads can reach it by index.
+ * liveInstances and callbackTimeNs are updated from FMOD callbacks, everything else on the main thread.
+ */
+struct AudioOwner
+{
+	AudioOwnerStats stats;
+	std::atomic<int64_t> liveInstances = 0;
+	std::atomic<uint64_t> callbackTimeNs = 0;
+	uint64_t callbackTimeWindowStartNs = 0;
+};
+#endif
@@ -0,0 +1,109 @@
+#include "audio_update_controller.h"
+
+namespace
+{
+	constexpr int64_t ADJUST_INTERVAL_NS = 250000000;
+	constexpr float PERIOD_GROW_FACTOR = 1.25f;
+	constexpr float PERIOD_SHRINK_FACTOR = 0.9f;
+	constexpr float COMMAND_QUEUE_HIGH_PERCENT = 50;
+}
+
+AudioUpdateController::AudioUpdateController()
+: mPreUpdateNs(0)
+, mLastUpdateNs(0)
+, mLastIntervalNs(0)
+, mEffectivePeriodMs(mSettings.basePeriodMs)
+, mLastSubmitNs(0)
+, mLastAdjustNs(0)
+, mSkippedCount(0)
+, mSubmitNsSinceAdjust(0)
+, mSubmitCostPercent(0)
+, bMixerUnderPressure(false)
+{}
+
+void AudioUpdateController::Configure(const AudioUpdateControllerSettings& settings)
+{
+	mSettings = settings;
+	mSettings.bAdaptive = mSettings.bAdaptive && !mSettings.bSynchronousUpdate;
+	mSettings.minPeriodMs = std::max(mSettings.minPeriodMs, 0.0f);
+	mSettings.maxPeriodMs = std::max(mSettings.maxPeriodMs, mSettings.minPeriodMs);
+	mEffectivePeriodMs = std::clamp(mSettings.basePeriodMs, mSettings.minPeriodMs, mSettings.maxPeriodMs);
+}
+
+void AudioUpdateController::OnPreUpdate(const int64_t nowNs)
+{
+	if (const int64_t previousNs = mPreUpdateNs.exchange(nowNs, std::memory_order_relaxed); previousNs != 0)
+	{
+		const int64_t intervalNs = nowNs - previousNs;
+		mLastIntervalNs.store(intervalNs, std::memory_order_relaxed);
+		mIntervalNs.Record(static_cast<uint64_t>(std::max<int64_t>(intervalNs, 0)));
+	}
+}
+
+void AudioUpdateController::OnPostUpdate(const int64_t nowNs)
+{
+	const int64_t preUpdateNs = mPreUpdateNs.load(std::memory_order_relaxed);
+	if (preUpdateNs == 0) { return; }
+
+	const int64_t updateNs = std::max<int64_t>(nowNs - preUpdateNs, 0);
+	mLastUpdateNs.store(updateNs, std::memory_order_relaxed);
+	mUpdateNs.Record(static_cast<uint64_t>(updateNs));
+}
+
+bool AudioUpdateController::ShouldSubmit(const int64_t nowNs, const int64_t frameDeltaNs)
+{
+	// Every frame submits until the period grows past studioupdateperiod, there is nothing to trade before that
+	const bool bTrading = mSettings.bAdaptive && mEffectivePeriodMs > mSettings.basePeriodMs;
+	if (!bTrading)
+	{
+		mLastSubmitNs = nowNs;
+		return true;
+	}
+
+	// Half a frame of slack, so a period just above the frame time still submits every frame
+	const auto periodNs = static_cast<int64_t>(static_cast<double>(mEffectivePeriodMs) * 1e6);
+	if (nowNs - mLastSubmitNs + frameDeltaNs / 2 >= periodNs)
+	{
+		mLastSubmitNs = nowNs;
+		return true;
+	}
+
+	++mSkippedCount;
+	return false;
+}
+
+void AudioUpdateController::OnSubmitted(const int64_t submitNs)
+{
+	mSubmitNsSinceAdjust += std::max<int64_t>(submitNs, 0);
+}
+
+bool AudioUpdateController::IsAdjustDue(const int64_t nowNs) const
+{
+	return nowNs - mLastAdjustNs >= ADJUST_INTERVAL_NS;
+}
+
+void AudioUpdateController::Adjust(const int64_t nowNs, const float dspPercent, const float commandQueuePercent)
+{
+	if (!IsAdjustDue(nowNs)) { return; }
+
+	// The first call only opens the measurement window
+	const int64_t windowNs = mLastAdjustNs != 0 ? nowNs - mLastAdjustNs : 0;
+	mLastAdjustNs = nowNs;
+	mSubmitCostPercent = windowNs > 0
+		? static_cast<float>(100.0 * static_cast<double>(mSubmitNsSinceAdjust) / static_cast<double>(windowNs)) : 0.0f;
+	mSubmitNsSinceAdjust = 0;
+	if (!mSettings.bAdaptive || windowNs == 0) { return; }
+
+	if (dspPercent > mSettings.dspHighPercent) { bMixerUnderPressure = true; }
+	else if (dspPercent < mSettings.dspLowPercent) { bMixerUnderPressure = false; }
+
+	// Skipped submissions leave their commands in the queue, never let it fill up
+	if (commandQueuePercent > COMMAND_QUEUE_HIGH_PERCENT || !bMixerUnderPressure || mSubmitCostPercent < mSettings.submitCostLowPercent)
+	{
+		mEffectivePeriodMs = std::max(mEffectivePeriodMs * PERIOD_SHRINK_FACTOR, mSettings.minPeriodMs);
+	}
+	else if (mSubmitCostPercent > mSettings.submitCostHighPercent)
+	{
+		mEffectivePeriodMs = std::min(mEffectivePeriodMs * PERIOD_GROW_FACTOR, mSettings.maxPeriodMs);
+	}
+}
@@ -0,0 +1,79 @@
+#ifndef AUDIO_UPDATE_CONTROLLER_H
+#define AUDIO_UPDATE_CONTROLLER_H
+
+#include "profiling/histogram.h"
+
+struct AudioUpdateControllerSettings
+{
+	bool bAdaptive = false;
+	bool bSynchronousUpdate = false; // Every Studio::System::update mixes, so none is ever skipped
+	float basePeriodMs = 20;
+	float minPeriodMs = 20;
+	float maxPeriodMs = 60;
+	float dspHighPercent = 80;       // The mixer is under pressure above this DSP CPU usage
+	float dspLowPercent = 60;        // And no longer below this one
+	float submitCostHighPercent = 2; // Lengthen the period when Studio::System::update takes this share of the main thread
+	float submitCostLowPercent = 1;  // Shorten it again below this one
+};
+
+/**
+ * @brief Measures Studio async updates (PREUPDATE to POSTUPDATE) and paces AudioEngine::Update's command submission
+ * FMOD fixes studioupdateperiod at initialize, so the adaptive period is applied to how often the game thread
+ * calls Studio::System::update, which is when queued API commands (parameters, 3D attributes, starts) reach
+ * the Studio thread. Skipping a call does not lighten the mix or the Studio thread, which still runs every
+ * studioupdateperiod, it only saves the main thread time spent submitting. So the period grows towards maxPeriodMs
+ * only while the mixer is under pressure and submitting costs more than submitCostHighPercent of the main thread,
+ * trading parameter responsiveness for that time. It returns towards minPeriodMs when the pressure is gone, when
+ * batching brought the cost under submitCostLowPercent, or when the command queue is filling up.
+ * Every frame submits while the period is not above studioupdateperiod. Never adaptive with synchronous updates,
+ * where a skipped call is a frame that is not mixed.
+ * OnPreUpdate/OnPostUpdate run on the Studio thread and are lock-free, everything else is main thread only.
+ * Refer to: https://www.fmod.com/docs/2.03/api/studio-guide.html#asynchronous-mode
+ */
+class AudioUpdateController
+{
+	public:
+		AudioUpdateController();
+
+		void Configure(const AudioUpdateControllerSettings& settings);
+
+		void OnPreUpdate(int64_t nowNs);
+		void OnPostUpdate(int64_t nowNs);
+
+		/** Returns false when this frame's Studio update should be skipped. frameDeltaNs rounds the period to whole frames. */
+		bool ShouldSubmit(int64_t nowNs, int64_t frameDeltaNs);
+		/** Main thread time spent in the Studio::System::update call that ShouldSubmit allowed */
+		void OnSubmitted(int64_t submitNs);
+
+		/** Measures the submission cost a few times per second, and adapts the period when adaptive */
+		[[nodiscard]] bool IsAdjustDue(int64_t nowNs) const;
+		/** commandQueuePercent: Studio command queue usage before this frame's submission */
+		void Adjust(int64_t nowNs, float dspPercent, float commandQueuePercent);
+
+		[[nodiscard]] bool IsAdaptive() const { return mSettings.bAdaptive; }
+		[[nodiscard]] float GetEffectivePeriodMs() const { return mEffectivePeriodMs; }
+		[[nodiscard]] float GetSubmitCostPercent() const { return mSubmitCostPercent; }
+		[[nodiscard]] uint64_t GetSkippedCount() const { return mSkippedCount; }
+		[[nodiscard]] int64_t GetLastUpdateNs() const { return mLastUpdateNs.load(std::memory_order_relaxed); }
+		[[nodiscard]] int64_t GetLastIntervalNs() const { return mLastIntervalNs.load(std::memory_order_relaxed); }
+		[[nodiscard]] const HdrHistogram& GetUpdateHistogram() const { return mUpdateNs; }
+		[[nodiscard]] const HdrHistogram& GetIntervalHistogram() const { return mIntervalNs; }
+
+	private:
+		AudioUpdateControllerSettings mSettings;
+
+		std::atomic<int64_t> mPreUpdateNs;
+		std::atomic<int64_t> mLastUpdateNs;
+		std::atomic<int64_t> mLastIntervalNs;
+		HdrHistogram mUpdateNs;
+		HdrHistogram mIntervalNs;
+
+		float mEffectivePeriodMs;
+		int64_t mLastSubmitNs;
+		int64_t mLastAdjustNs;
+		uint64_t mSkippedCount;
+		int64_t mSubmitNsSinceAdjust;
+		float mSubmitCostPercent;
+		bool bMixerUnderPressure;
+};
+#endif
@@ -3,6 +3,8 @@
 #include "media/media_framework.h"
 #include "widgets/menus/main_menu.h"
 #include "widgets/overlays/audio_info_overlay.h"
+#include "widgets/overlays/dsp_graph_overlay.h"
+#include "widgets/overlays/profiler_overlay.h"
 #include "widgets/overlays/volume_overlay.h"
 
 std::unique_ptr<GUI> GUI::sInstance = nullptr;
@@ -11,9 +13,13 @@ GUI::GUI()
 : bIsInitialized(false)
 , bIsAudioInfoOverlayVisible(false)
 , bIsVolumeOverlayVisible(false)
+, bIsDSPGraphOverlayVisible(false)
+, bIsProfilerOverlayVisible(false)
 , mMainMenu(std::make_unique<MainMenu>())
 , mAudioInfoOverlay(std::make_unique<AudioInfoOverlay>())
 , mVolumeOverlay(std::make_unique<VolumeOverlay>())
+, mDSPGraphOverlay(std::make_unique<DSPGraphOverlay>())
+, mProfilerOverlay(std::make_unique<ProfilerOverlay>())
 {}
 
 GUI& GUI::Get()
@@ -41,6 +47,8 @@ void GUI::InitializeWidgets() const
     mMainMenu->Initialize();
     mAudioInfoOverlay->Initialize();
     mVolumeOverlay->Initialize();
+    mDSPGraphOverlay->Initialize();
+    mProfilerOverlay->Initialize();
 }
 
 void GUI::StageWidgets(std::vector<InputEvent>& outEvents)
@@ -56,7 +64,14 @@ void GUI::StageWidgets(std::vector<InputEvent>& outEvents)
     {
         instance.mVolumeOverlay->Stage(outEvents);
     }
-    instance.ConsumeInputEvents(outEvents);
+    if (instance.bIsDSPGraphOverlayVisible)
+    {
+        instance.mDSPGraphOverlay->Stage(outEvents);
+    }
+    if (instance.bIsProfilerOverlayVisible)
+    {
+        instance.mProfilerOverlay->Stage(outEvents);
+    }
 }
 
 void GUI::ConsumeInputEvents(std::vector<InputEvent>& ioEvents)
@@ -73,6 +88,22 @@ void GUI::ConsumeInputEvents(std::vector<InputEvent>& ioEvents)
             bIsVolumeOverlayVisible = !bIsVolumeOverlayVisible;
             it = ioEvents.erase(it);
         }
+        else if (std::holds_alternative<ToggleDSPGraphOverlayEvent>(*it))
+        {
+            bIsDSPGraphOverlayVisible = !bIsDSPGraphOverlayVisible;
+            it = ioEvents.erase(it);
+        }
+        else if (std::holds_alternative<ToggleProfilerOverlayEvent>(*it))
+        {
+            bIsProfilerOverlayVisible = !bIsProfilerOverlayVisible;
+            it = ioEvents.erase(it);
+        }
+        else if (const auto* volumeEvent = std::get_if<SetVolumeEvent>(&*it))
+        {
+            // Through the overlay, so its slider shows the new value
+            static_cast<VolumeOverlay*>(mVolumeOverlay.get())->SetVolume(volumeEvent->vca_path, volumeEvent->volume);
+            it = ioEvents.erase(it);
+        }
         else
         {
             ++it;
@@ -85,6 +116,11 @@ void GUI::RenderStage(std::vector<InputEvent>& outEvents)
     StageWidgets(outEvents);
 }
 
+void GUI::HandleInputEvents(std::vector<InputEvent>& ioEvents)
+{
+    Get().ConsumeInputEvents(ioEvents);
+}
+
 void GUI::Terminate()
 {
     const GUI& instance = Get();
@@ -16,6 +16,8 @@ class GUI
 
         static bool Initialize();
         static void RenderStage(std::vector<InputEvent>& outEvents);
+        /** Called by Application::ProcessEvents, the widget events staged by RenderStage are handled on the next frame */
+        static void HandleInputEvents(std::vector<InputEvent>& ioEvents);
         static void Terminate();
 
         static bool IsInitialized();
@@ -27,10 +29,14 @@ class GUI
 
         bool bIsAudioInfoOverlayVisible;
         bool bIsVolumeOverlayVisible;
+        bool bIsDSPGraphOverlayVisible;
+        bool bIsProfilerOverlayVisible;
 
         std::unique_ptr<IWidget> mMainMenu;
         std::unique_ptr<IWidget> mAudioInfoOverlay;
         std::unique_ptr<IWidget> mVolumeOverlay;
+        std::unique_ptr<IWidget> mDSPGraphOverlay;
+        std::unique_ptr<IWidget> mProfilerOverlay;
 
         GUI();
         void InitializeWidgets() const;
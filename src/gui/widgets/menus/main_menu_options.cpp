@@ -13,7 +13,11 @@ namespace
 
     const auto LABEL_MENU_ROOT = "Options";
     const auto LABEL_AUDIO_INFO_OVERLAY = GuiIconText(ICON_INFO, "Audio Info");
-    const auto MENU_ENTRIES = std::format("{};{}", LABEL_MENU_ROOT, LABEL_AUDIO_INFO_OVERLAY);
+    const auto LABEL_DSP_GRAPH_OVERLAY = GuiIconText(ICON_LAYERS, "DSP Graph");
+    const auto LABEL_PROFILER_OVERLAY = GuiIconText(ICON_CPU, "Profiler");
+    const auto LABEL_COMMAND_CAPTURE = GuiIconText(ICON_PLAYER_RECORD, "Command Capture");
+    const auto MENU_ENTRIES = std::format("{};{};{};{};{}", LABEL_MENU_ROOT,
+        LABEL_AUDIO_INFO_OVERLAY, LABEL_DSP_GRAPH_OVERLAY, LABEL_PROFILER_OVERLAY, LABEL_COMMAND_CAPTURE);
 }
 
 MainMenuOptions::MainMenuOptions() = default;
@@ -36,6 +40,18 @@ void MainMenuOptions::Stage(std::vector<InputEvent>& outEvents)
             {
                 outEvents.emplace_back(ToggleAudioInfoOverlayEvent());
             }
+            if (menuActiveIndex == 2)
+            {
+                outEvents.emplace_back(ToggleDSPGraphOverlayEvent());
+            }
+            if (menuActiveIndex == 3)
+            {
+                outEvents.emplace_back(ToggleProfilerOverlayEvent());
+            }
+            if (menuActiveIndex == 4)
+            {
+                outEvents.emplace_back(ToggleCommandCaptureEvent());
+            }
         }
         bIsMenuOpen = !bIsMenuOpen;
         menuActiveIndex = 0;
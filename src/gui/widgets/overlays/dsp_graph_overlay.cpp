@@ -0,0 +1,102 @@
+#include "dsp_graph_overlay.h"
+
+#include "app/app_clock.h"
+#include "raygui.h"
+
+namespace
+{
+    constexpr float MAIN_MENU_HEIGHT = 26;
+
+    constexpr float WINDOW_WIDTH = 560;
+    constexpr float WINDOW_HEIGHT = 520;
+    constexpr float WINDOW_PADDING = 10;
+    constexpr float WINDOW_TITLE_HEIGHT = 24;
+
+    constexpr int FONT_SIZE_LINE = 10;
+    constexpr int LINE_HEIGHT = 12;
+    constexpr int INDENT_WIDTH = 8;
+
+    // Walking the graph touches every DSP in the mix, do it a few times per second instead of every frame
+    constexpr double REFRESH_INTERVAL_SECONDS = 0.5;
+
+    constexpr auto LABEL_WINDOW = "DSP Graph";
+}
+
+DSPGraphOverlay::DSPGraphOverlay()
+: mLastRefreshTime(-REFRESH_INTERVAL_SECONDS)
+{}
+
+void DSPGraphOverlay::Initialize()
+{
+    IWidget::Initialize();
+}
+
+void DSPGraphOverlay::Stage(std::vector<InputEvent>& outEvents)
+{
+    IWidget::Stage(outEvents);
+
+    if (const double now = AppClock::GetTimeSeconds(); now - mLastRefreshTime >= REFRESH_INTERVAL_SECONDS)
+    {
+        RefreshGraph();
+        mLastRefreshTime = now;
+    }
+
+    const Vector2 pivot = {WINDOW_PADDING, MAIN_MENU_HEIGHT + WINDOW_PADDING};
+
+    GuiUnlock();
+    GuiSetStyle(DEFAULT, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
+    const Rectangle windowRectangle{pivot.x, pivot.y, WINDOW_WIDTH, WINDOW_HEIGHT};
+    const bool bShouldCloseWindow = GuiWindowBox(windowRectangle, LABEL_WINDOW);
+    GuiSetStyle(DEFAULT, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+
+    const int maxLines = static_cast<int>((WINDOW_HEIGHT - WINDOW_TITLE_HEIGHT - WINDOW_PADDING) / LINE_HEIGHT);
+    const int lineCount = std::min(static_cast<int>(mLines.size()), maxLines);
+
+    for (int i = 0; i < lineCount; ++i)
+    {
+        const int indent = i == 0 ? 0 : std::min(mNodes[i - 1].depth, 16) * INDENT_WIDTH;
+        const Color color = i == 0 || mNodes[i - 1].bIsActive ? LIGHTGRAY : GRAY;
+        DrawText(mLines[i].c_str(),
+            static_cast<int>(pivot.x + WINDOW_PADDING) + indent,
+            static_cast<int>(pivot.y + WINDOW_TITLE_HEIGHT) + i * LINE_HEIGHT,
+            FONT_SIZE_LINE, color);
+    }
+
+    if (bShouldCloseWindow)
+    {
+        outEvents.emplace_back(ToggleDSPGraphOverlayEvent());
+    }
+    GuiLock();
+}
+
+void DSPGraphOverlay::RefreshGraph()
+{
+    mLines.clear();
+    if (!AudioEngine::GetDSPGraph(mNodes))
+    {
+        mLines.emplace_back("Audio engine not initialized");
+        return;
+    }
+
+    const bool bHasCPUUsage = AudioEngine::IsProfileMeterAllEnabled();
+    unsigned int totalCPU = 0;
+    for (const auto& node : mNodes)
+    {
+        totalCPU += node.cpuExclusiveUs;
+    }
+
+    // First line is a summary, every following line maps to mNodes[line - 1]
+    mLines.push_back(bHasCPUUsage
+        ? std::format("Nodes: {}  Total exclusive CPU: {} us", mNodes.size(), totalCPU)
+        : std::format("Nodes: {}  CPU: n/a (set EnableProfileMeterAll=true)", mNodes.size()));
+
+    for (const auto& node : mNodes)
+    {
+        const std::string name = node.name.empty() ? std::format("Type {}", node.type) : node.name;
+        const std::string state = std::format("{}{}", node.bIsActive ? "A" : "-", node.bIsBypassed ? "B" : "-");
+
+        mLines.push_back(bHasCPUUsage
+            ? std::format("{} [{}] {}  {} / {} us", name, state, node.owner, node.cpuExclusiveUs, node.cpuInclusiveUs)
+            : std::format("{} [{}] {}", name, state, node.owner));
+    }
+}
@@ -0,0 +1,23 @@
+#ifndef DSP_GRAPH_OVERLAY_H
+#define DSP_GRAPH_OVERLAY_H
+
+#include "audio/audio_engine.h"
+#include "gui/widgets/widget.h"
+
+class DSPGraphOverlay : public IWidget
+{
+public:
+    DSPGraphOverlay();
+    ~DSPGraphOverlay() override = default;
+
+    void Initialize() override;
+    void Stage(std::vector<InputEvent>& outEvents) override;
+
+private:
+    std::vector<AudioDSPNodeInfo> mNodes;
+    std::vector<std::string> mLines;
+    double mLastRefreshTime;
+
+    void RefreshGraph();
+};
+#endif
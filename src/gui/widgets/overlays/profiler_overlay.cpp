@@ -0,0 +1,326 @@
+#include "profiler_overlay.h"
+
+#include "app/app_clock.h"
+#include "audio/audio_engine.h"
+#include "profiling/allocation_tracker.h"
+#include "profiling/hitch_watchdog.h"
+#include "profiling/lock_profiler.h"
+#include "profiling/steady_time.h"
+#include "raygui.h"
+
+namespace
+{
+    constexpr float WINDOW_WIDTH = 640;
+    constexpr float WINDOW_HEIGHT = 300;
+    constexpr float WINDOW_PADDING = 10;
+    constexpr float WINDOW_TITLE_HEIGHT = 24;
+
+    constexpr float COMBO_BOX_WIDTH = 200;
+    constexpr float COMBO_BOX_HEIGHT = 24;
+
+    constexpr int FONT_SIZE_LINE = 10;
+    constexpr int LINE_HEIGHT = 12;
+
+    constexpr double REFRESH_INTERVAL_SECONDS = 0.5;
+
+    constexpr auto LABEL_WINDOW = "Profiler";
+
+    enum ProfilerSection
+    {
+        PROFILER_SECTION_PLAY_LATENCY,
+        PROFILER_SECTION_HITCHES,
+        PROFILER_SECTION_CALLBACKS,
+        PROFILER_SECTION_LOCKS,
+        PROFILER_SECTION_ALLOCATIONS,
+        PROFILER_SECTION_BUDGETS,
+        PROFILER_SECTION_COUNT
+    };
+
+    constexpr std::array<const char*, PROFILER_SECTION_COUNT> SECTION_NAMES = {
+        "Play Latency",
+        "Hitches",
+        "Callbacks",
+        "Locks",
+        "Allocations",
+        "Budgets",
+    };
+
+    constexpr size_t HITCH_LINES_MAX_EVENTS = 8;
+    constexpr size_t ALLOCATION_LINES_MAX_FRAMES = 120;
+}
+
+ProfilerOverlay::ProfilerOverlay()
+: mActiveSection(PROFILER_SECTION_PLAY_LATENCY)
+, mRefreshedSection(-1)
+, mLastRefreshTime(0)
+{}
+
+void ProfilerOverlay::Initialize()
+{
+    IWidget::Initialize();
+
+    for (size_t i = 0; i < SECTION_NAMES.size(); ++i)
+    {
+        mSectionEntries += i == SECTION_NAMES.size() - 1
+            ? std::format("{}", SECTION_NAMES[i])
+            : std::format("{};", SECTION_NAMES[i]);
+    }
+}
+
+void ProfilerOverlay::Stage(std::vector<InputEvent>& outEvents)
+{
+    IWidget::Stage(outEvents);
+
+    if (const double now = AppClock::GetTimeSeconds(); mRefreshedSection != mActiveSection || now - mLastRefreshTime >= REFRESH_INTERVAL_SECONDS)
+    {
+        RefreshSection();
+        mRefreshedSection = mActiveSection;
+        mLastRefreshTime = now;
+    }
+
+    const Vector2 pivot = {WINDOW_PADDING, static_cast<float>(GetScreenHeight()) - (WINDOW_HEIGHT + WINDOW_PADDING)};
+
+    GuiUnlock();
+    GuiSetStyle(DEFAULT, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
+    const Rectangle windowRectangle{pivot.x, pivot.y, WINDOW_WIDTH, WINDOW_HEIGHT};
+    const bool bShouldCloseWindow = GuiWindowBox(windowRectangle, LABEL_WINDOW);
+    GuiSetStyle(DEFAULT, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+
+    const Rectangle comboBoxRectangle{pivot.x + WINDOW_PADDING, pivot.y + WINDOW_TITLE_HEIGHT + WINDOW_PADDING * 0.5f,
+        COMBO_BOX_WIDTH, COMBO_BOX_HEIGHT};
+    GuiComboBox(comboBoxRectangle, mSectionEntries.c_str(), &mActiveSection);
+
+    const float linesTop = comboBoxRectangle.y + comboBoxRectangle.height + WINDOW_PADDING * 0.5f;
+    const int maxLines = static_cast<int>((pivot.y + WINDOW_HEIGHT - WINDOW_PADDING - linesTop) / LINE_HEIGHT);
+    const int lineCount = std::min(static_cast<int>(mLines.size()), maxLines);
+
+    for (int i = 0; i < lineCount; ++i)
+    {
+        DrawText(mLines[i].c_str(),
+            static_cast<int>(pivot.x + WINDOW_PADDING),
+            static_cast<int>(linesTop) + i * LINE_HEIGHT,
+            FONT_SIZE_LINE, LIGHTGRAY);
+    }
+
+    if (bShouldCloseWindow)
+    {
+        outEvents.emplace_back(ToggleProfilerOverlayEvent());
+    }
+    GuiLock();
+}
+
+void ProfilerOverlay::RefreshSection()
+{
+    mLines.clear();
+
+    switch (mActiveSection)
+    {
+        case PROFILER_SECTION_PLAY_LATENCY:
+            BuildPlayLatencyLines(mLines);
+            break;
+        case PROFILER_SECTION_HITCHES:
+            BuildHitchLines(mLines);
+            break;
+        case PROFILER_SECTION_CALLBACKS:
+            BuildCallbackLines(mLines);
+            break;
+        case PROFILER_SECTION_LOCKS:
+            BuildLockLines(mLines);
+            break;
+        case PROFILER_SECTION_ALLOCATIONS:
+            BuildAllocationLines(mLines);
+            break;
+        case PROFILER_SECTION_BUDGETS:
+            BuildBudgetLines(mLines);
+            break;
+        default:
+            break;
+    }
+}
+
+void ProfilerOverlay::BuildPlayLatencyLines(std::vector<std::string>& outLines)
+{
+    if (!AudioEngine::IsFirstPlayLatencyEnabled())
+    {
+        outLines.emplace_back("First-play latency disabled (set [Profiling] EnableFirstPlayLatency=true)");
+        return;
+    }
+
+    std::vector<const AudioEventLatencyStats*> allStats;
+    AudioEngine::GetEventLatencyStats(allStats);
+
+    outLines.emplace_back("Event                         n     started p50/p99 us   sound p50/p99 us   DSP samples p50/p99");
+    for (const AudioEventLatencyStats* stats : allStats)
+    {
+        outLines.push_back(std::format("{:<28}  {:<5} {:>8} / {:<8}   {:>7} / {:<7}   {:>7} / {:<7}",
+            stats->path, stats->startedUs.GetCount(),
+            stats->startedUs.GetPercentile(50), stats->startedUs.GetPercentile(99),
+            stats->soundPlayedUs.GetPercentile(50), stats->soundPlayedUs.GetPercentile(99),
+            stats->soundPlayedSamples.GetPercentile(50), stats->soundPlayedSamples.GetPercentile(99)));
+    }
+}
+
+void ProfilerOverlay::BuildHitchLines(std::vector<std::string>& outLines)
+{
+    if (!HitchWatchdog::IsEnabled())
+    {
+        outLines.emplace_back("Hitch watchdog disabled (set [Watchdog] EnableHitchWatchdog=true)");
+        return;
+    }
+
+    std::array<WatchdogHitchEvent, HITCH_LINES_MAX_EVENTS> hitches;
+    const size_t hitchCount = HitchWatchdog::GetRecentHitches(hitches.data(), hitches.size());
+    const int64_t now = GetSteadyTimeNs();
+
+    outLines.push_back(std::format("Total hitches: {}", HitchWatchdog::GetHitchCount()));
+    for (size_t i = hitchCount; i > 0; --i)
+    {
+        const WatchdogHitchEvent& hitch = hitches[i - 1];
+        outLines.push_back(std::format("{:>6.1f} s ago  {:<12} stalled {:>7.1f} ms in {}",
+            static_cast<double>(now - hitch.detectedNs) * 1e-9, HitchWatchdog::GetChannelName(hitch.channel),
+            static_cast<double>(hitch.stalledNs) * 1e-6, hitch.phase ? hitch.phase : "None"));
+    }
+}
+
+void ProfilerOverlay::BuildCallbackLines(std::vector<std::string>& outLines)
+{
+    const AudioCallbackProfiler* profiler = AudioEngine::GetCallbackProfiler();
+    if (!profiler)
+    {
+        outLines.emplace_back("Callback profiling disabled (set [Profiling] EnableCallbackProfiling=true)");
+        return;
+    }
+
+    outLines.push_back(std::format("Callback                                 n      p50 / p99 / max us        over {} us",
+        profiler->GetBudgetNs() / 1000));
+    for (size_t i = 0; i < profiler->GetSlotCount(); ++i)
+    {
+        const AudioCallbackProfiler::Slot& slot = profiler->GetSlot(i);
+        if (slot.durationNs.GetCount() == 0) { continue; }
+
+        outLines.push_back(std::format("{:<12} {:<26}  {:<6} {:>7.1f} / {:>7.1f} / {:>7.1f}   {}",
+            AudioCallbackProfiler::GetKindName(slot.kind), slot.name, slot.durationNs.GetCount(),
+            static_cast<double>(slot.durationNs.GetPercentile(50)) * 0.001,
+            static_cast<double>(slot.durationNs.GetPercentile(99)) * 0.001,
+            static_cast<double>(slot.durationNs.GetMax()) * 0.001,
+            slot.overBudgetCount.load(std::memory_order_relaxed)));
+    }
+
+    std::vector<const AudioEventCallbackStats*> allStats;
+    AudioEngine::GetEventCallbackStats(allStats);
+    for (const AudioEventCallbackStats* stats : allStats)
+    {
+        if (stats->durationNs.GetCount() == 0) { continue; }
+
+        outLines.push_back(std::format("{:<39}  {:<6} {:>7.1f} / {:>7.1f} / {:>7.1f}   {}",
+            stats->path, stats->durationNs.GetCount(),
+            static_cast<double>(stats->durationNs.GetPercentile(50)) * 0.001,
+            static_cast<double>(stats->durationNs.GetPercentile(99)) * 0.001,
+            static_cast<double>(stats->durationNs.GetMax()) * 0.001,
+            stats->overBudgetCount.load(std::memory_order_relaxed)));
+    }
+}
+
+void ProfilerOverlay::BuildLockLines(std::vector<std::string>& outLines)
+{
+    if (!LockProfiler::IsEnabled())
+    {
+        outLines.emplace_back("Lock profiling disabled (set [Profiling] EnableLockProfiling=true)");
+        return;
+    }
+
+    std::vector<const LockStats*> allStats;
+    LockProfiler::GetAllStats(allStats);
+
+    outLines.emplace_back("Lock                             acquired   contended   wait p99 / max us   hold p99 / max us");
+    for (const LockStats* stats : allStats)
+    {
+        outLines.push_back(std::format("{:<32} {:<10} {:<11} {:>8.1f} / {:<8.1f} {:>8.1f} / {:<8.1f}",
+            stats->name, stats->acquisitions.load(std::memory_order_relaxed),
+            stats->contendedAcquisitions.load(std::memory_order_relaxed),
+            static_cast<double>(stats->waitNs.GetPercentile(99)) * 0.001,
+            static_cast<double>(stats->waitNs.GetMax()) * 0.001,
+            static_cast<double>(stats->holdNs.GetPercentile(99)) * 0.001,
+            static_cast<double>(stats->holdNs.GetMax()) * 0.001));
+    }
+}
+
+void ProfilerOverlay::BuildAllocationLines(std::vector<std::string>& outLines)
+{
+    if (!AllocationTracker::IsEnabled())
+    {
+        outLines.emplace_back("Allocation tracking disabled (set [Profiling] EnableAllocationTracking=true)");
+        return;
+    }
+
+    std::array<AllocationFrameStats, ALLOCATION_LINES_MAX_FRAMES> frames;
+    const size_t frameCount = AllocationTracker::GetRecentFrames(frames.data(), frames.size());
+
+    uint64_t totalAllocations = 0;
+    uint64_t maxAllocations = 0;
+    for (size_t i = 0; i < frameCount; ++i)
+    {
+        totalAllocations += frames[i].allocations;
+        maxAllocations = std::max(maxAllocations, frames[i].allocations);
+    }
+
+    const AllocationFrameStats lastFrame = AllocationTracker::GetLastFrame();
+    outLines.push_back(std::format("Last frame: {} allocations ({} on main thread), {} bytes{}",
+        lastFrame.allocations, lastFrame.mainThreadAllocations, lastFrame.bytes,
+        lastFrame.bIsSteadyState ? "" : "  [warming up]"));
+    outLines.push_back(std::format("Last {} frames: avg {:.1f}, max {} allocations per frame",
+        frameCount, frameCount > 0 ? static_cast<double>(totalAllocations) / static_cast<double>(frameCount) : 0.0,
+        maxAllocations));
+    if (AllocationTracker::IsTestModeEnabled())
+    {
+        outLines.push_back(std::format("Steady-state test violations: {}", AllocationTracker::GetSteadyStateViolationCount()));
+    }
+
+    std::array<AllocationThreadStats, ALLOCATION_TRACKER_MAX_THREADS> threads;
+    const size_t threadCount = AllocationTracker::GetThreadStats(threads.data(), threads.size());
+
+    outLines.emplace_back("");
+    outLines.emplace_back("Thread                 last frame (n / bytes)       total (n / bytes / frees)");
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        const AllocationThreadStats& thread = threads[i];
+        outLines.push_back(std::format("{:<22} {:>8} / {:<12}     {} / {} / {}",
+            thread.name, thread.lastFrameAllocations, thread.lastFrameBytes,
+            thread.allocations, thread.bytes, thread.frees));
+    }
+}
+
+void ProfilerOverlay::BuildBudgetLines(std::vector<std::string>& outLines)
+{
+    if (!AudioEngine::IsOwnerAccountingEnabled())
+    {
+        outLines.emplace_back("Owner accounting disabled (set [Budgets] EnableOwnerAccounting=true)");
+        return;
+    }
+
+    std::vector<AudioOwnerStats> allStats;
+    AudioEngine::GetOwnerStats(allStats);
+
+    const auto formatUsage = [](const double value, const double limit, const bool bIsOver)
+    {
+        return limit > 0 ? std::format("{:.0f}/{:.0f}{}", value, limit, bIsOver ? "!" : "") : std::format("{:.0f}", value);
+    };
+
+    outLines.emplace_back("Owner               banks      bank KiB         sample KiB       instances   voices     callback us/s");
+    for (const AudioOwnerStats& stats : allStats)
+    {
+        const AudioOwnerBudget& budget = stats.budget;
+        outLines.push_back(std::format("{:<19} {:<10} {:<16} {:<16} {:<11} {:<10} {}",
+            stats.name,
+            formatUsage(stats.bankCount, budget.maxBanks, stats.overBudgetMask & AUDIO_OWNER_BUDGET_BANKS),
+            formatUsage(static_cast<double>(stats.bankMemoryBytes) / 1024.0, static_cast<double>(budget.maxBankMemoryBytes) / 1024.0,
+                stats.overBudgetMask & AUDIO_OWNER_BUDGET_BANK_MEMORY),
+            formatUsage(static_cast<double>(stats.sampleMemoryBytes) / 1024.0, static_cast<double>(budget.maxSampleMemoryBytes) / 1024.0,
+                stats.overBudgetMask & AUDIO_OWNER_BUDGET_SAMPLE_MEMORY),
+            formatUsage(static_cast<double>(stats.liveInstances), static_cast<double>(budget.maxInstances),
+                stats.overBudgetMask & AUDIO_OWNER_BUDGET_INSTANCES),
+            formatUsage(stats.voices, budget.maxVoices, stats.overBudgetMask & AUDIO_OWNER_BUDGET_VOICES),
+            formatUsage(stats.callbackUsPerSecond, budget.maxCallbackUsPerSecond,
+                stats.overBudgetMask & AUDIO_OWNER_BUDGET_CALLBACK_TIME)));
+    }
+}
@@ -0,0 +1,31 @@
+#ifndef PROFILER_OVERLAY_H
+#define PROFILER_OVERLAY_H
+
+#include "gui/widgets/widget.h"
+
+class ProfilerOverlay : public IWidget
+{
+public:
+    ProfilerOverlay();
+    ~ProfilerOverlay() override = default;
+
+    void Initialize() override;
+    void Stage(std::vector<InputEvent>& outEvents) override;
+
+private:
+    std::string mSectionEntries;
+    std::vector<std::string> mLines;
+    int mActiveSection;
+    int mRefreshedSection;
+    double mLastRefreshTime;
+
+    void RefreshSection();
+
+    static void BuildPlayLatencyLines(std::vector<std::string>& outLines);
+    static void BuildHitchLines(std::vector<std::string>& outLines);
+    static void BuildCallbackLines(std::vector<std::string>& outLines);
+    static void BuildLockLines(std::vector<std::string>& outLines);
+    static void BuildAllocationLines(std::vector<std::string>& outLines);
+    static void BuildBudgetLines(std::vector<std::string>& outLines);
+};
+#endif
@@ -55,10 +55,25 @@ void VolumeOverlay::Initialize()
     AudioEngine::VCA_GetVolume(mVOVolume_VCA, mVOVolumeCurrent);
 }
 
+bool VolumeOverlay::SetVolume(const std::string& vcaPath, const float volume)
+{
+    AudioVCA* vca = nullptr;
+    float* volumeCurrent = nullptr;
+    if (vcaPath == VCA_MASTER_VOLUME) { vca = mMasterVolume_VCA; volumeCurrent = &mMasterVolumeCurrent; }
+    else if (vcaPath == VCA_MUSIC_VOLUME) { vca = mMusicVolume_VCA; volumeCurrent = &mMusicVolumeCurrent; }
+    else if (vcaPath == VCA_SFX_VOLUME) { vca = mSFXVolume_VCA; volumeCurrent = &mSFXVolumeCurrent; }
+    else if (vcaPath == VCA_VO_VOLUME) { vca = mVOVolume_VCA; volumeCurrent = &mVOVolumeCurrent; }
+    else { return false; }
+
+    *volumeCurrent = std::clamp(volume, static_cast<float>(VOLUME_MIN), static_cast<float>(VOLUME_MAX));
+    return AudioEngine::VCA_SetVolume(vca, AudioEngine::GetNormalizedVolumeInRange(*volumeCurrent));
+}
+
 void VolumeOverlay::Stage(std::vector<InputEvent>& outEvents)
 {
     IWidget::Stage(outEvents);
 
+    // Slider changes go through SetVolumeEvent like scripted and replayed ones, GUI::HandleInputEvents applies them
     const Vector2 pivot = {static_cast<float>(GetScreenWidth()) - (WINDOW_WIDTH + WINDOW_PADDING_Y), MAIN_MENU_HEIGHT};
 
     GuiUnlock();
@@ -73,7 +88,7 @@ void VolumeOverlay::Stage(std::vector<InputEvent>& outEvents)
         TextFormat("%i", static_cast<int>(mMasterVolumeCurrent * 100)), &mMasterVolumeCurrent, VOLUME_MIN, VOLUME_MAX);
     if (masterVolumeCached != mMasterVolumeCurrent)
     {
-        AudioEngine::VCA_SetVolume(mMasterVolume_VCA, AudioEngine::GetNormalizedVolumeInRange(mMasterVolumeCurrent));
+        outEvents.emplace_back(SetVolumeEvent{VCA_MASTER_VOLUME, mMasterVolumeCurrent});
     }
 
     const float musicVolumeCached = mMusicVolumeCurrent;
@@ -82,7 +97,7 @@ void VolumeOverlay::Stage(std::vector<InputEvent>& outEvents)
         TextFormat("%i", static_cast<int>(mMusicVolumeCurrent * 100)), &mMusicVolumeCurrent, VOLUME_MIN, VOLUME_MAX);
     if (musicVolumeCached != mMusicVolumeCurrent)
     {
-        AudioEngine::VCA_SetVolume(mMusicVolume_VCA, AudioEngine::GetNormalizedVolumeInRange(mMusicVolumeCurrent));
+        outEvents.emplace_back(SetVolumeEvent{VCA_MUSIC_VOLUME, mMusicVolumeCurrent});
     }
 
     const float sfxVolumeCached = mSFXVolumeCurrent;
@@ -91,7 +106,7 @@ void VolumeOverlay::Stage(std::vector<InputEvent>& outEvents)
         TextFormat("%i", static_cast<int>(mSFXVolumeCurrent * 100)), &mSFXVolumeCurrent, VOLUME_MIN, VOLUME_MAX);
     if (sfxVolumeCached != mSFXVolumeCurrent)
     {
-        AudioEngine::VCA_SetVolume(mSFXVolume_VCA, AudioEngine::GetNormalizedVolumeInRange(mSFXVolumeCurrent));
+        outEvents.emplace_back(SetVolumeEvent{VCA_SFX_VOLUME, mSFXVolumeCurrent});
     }
 
     const float voVolumeCached = mVOVolumeCurrent;
@@ -100,7 +115,7 @@ void VolumeOverlay::Stage(std::vector<InputEvent>& outEvents)
         TextFormat("%i", static_cast<int>(mVOVolumeCurrent * 100)), &mVOVolumeCurrent, VOLUME_MIN, VOLUME_MAX);
     if (voVolumeCached != mVOVolumeCurrent)
     {
-        AudioEngine::VCA_SetVolume(mVOVolume_VCA, AudioEngine::GetNormalizedVolumeInRange(mVOVolumeCurrent));
+        outEvents.emplace_back(SetVolumeEvent{VCA_VO_VOLUME, mVOVolumeCurrent});
     }
 
     if (bShouldCloseWindow)
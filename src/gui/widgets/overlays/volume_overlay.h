@@ -13,6 +13,9 @@ public:
     void Initialize() override;
     void Stage(std::vector<InputEvent>& outEvents) override;
 
+    /** Same as moving the slider, volume is the 0-1 slider value */
+    bool SetVolume(const std::string& vcaPath, float volume);
+
 private:
     AudioVCA* mMasterVolume_VCA;
     AudioVCA* mMusicVolume_VCA;
@@ -4,12 +4,28 @@
 struct QuitRequestedEvent {};
 struct ToggleAudioInfoOverlayEvent {};
 struct ToggleAudioVolumeWindowEvent {};
+struct ToggleDSPGraphOverlayEvent {};
+struct ToggleProfilerOverlayEvent {};
+struct ToggleCommandCaptureEvent {};
 struct OpenPageEvent { std::string page_name = std::string(); };
+struct PlayProgrammerSoundEvent { std::string key = std::string(); };
+struct StopProgrammerSoundEvent {};
+struct SetReverbEnabledEvent { bool enabled = false; };
+struct SelectLocaleEvent { std::string locale = std::string(); };
+struct SetVolumeEvent { std::string vca_path = std::string(); float volume = 1.0f; };
 
 using InputEvent = std::variant<
 	OpenPageEvent,
 	QuitRequestedEvent,
 	ToggleAudioInfoOverlayEvent,
-	ToggleAudioVolumeWindowEvent
+	ToggleAudioVolumeWindowEvent,
+	ToggleDSPGraphOverlayEvent,
+	ToggleProfilerOverlayEvent,
+	ToggleCommandCaptureEvent,
+	PlayProgrammerSoundEvent,
+	StopProgrammerSoundEvent,
+	SetReverbEnabledEvent,
+	SelectLocaleEvent,
+	SetVolumeEvent
 >;
 #endif
\ No newline at end of file
@@ -0,0 +1,194 @@
+#include "input_session.h"
+
+namespace
+{
+	constexpr size_t INPUT_EVENT_TYPE_COUNT = std::variant_size_v<InputEvent>;
+
+	template <size_t... Indices>
+	InputEvent MakeInputEvent(const size_t index, std::index_sequence<Indices...>)
+	{
+		static constexpr InputEvent (*MAKERS[])() = { [] { return InputEvent(std::in_place_index<Indices>); }... };
+		return MAKERS[index]();
+	}
+
+	template <typename T>
+	void WriteValue(std::ostream& stream, const T& value)
+	{
+		stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	template <typename T>
+	bool ReadValue(std::istream& stream, T& outValue)
+	{
+		return static_cast<bool>(stream.read(reinterpret_cast<char*>(&outValue), sizeof(T)));
+	}
+
+	void WriteString(std::ostream& stream, const std::string& value)
+	{
+		const auto length = static_cast<uint16_t>(std::min<size_t>(value.size(), UINT16_MAX));
+		WriteValue(stream, length);
+		stream.write(value.data(), length);
+	}
+
+	bool ReadString(std::istream& stream, std::string& outValue)
+	{
+		uint16_t length = 0;
+		if (!ReadValue(stream, length)) { return false; }
+		outValue.resize(length);
+		return static_cast<bool>(stream.read(outValue.data(), length));
+	}
+
+	// Alternatives without members have no payload
+	void WritePayload(std::ostream& stream, const InputEvent& event)
+	{
+		if (const auto* openPage = std::get_if<OpenPageEvent>(&event)) { WriteString(stream, openPage->page_name); }
+		else if (const auto* playSound = std::get_if<PlayProgrammerSoundEvent>(&event)) { WriteString(stream, playSound->key); }
+		else if (const auto* setReverb = std::get_if<SetReverbEnabledEvent>(&event)) { WriteValue(stream, static_cast<uint8_t>(setReverb->enabled)); }
+		else if (const auto* selectLocale = std::get_if<SelectLocaleEvent>(&event)) { WriteString(stream, selectLocale->locale); }
+		else if (const auto* setVolume = std::get_if<SetVolumeEvent>(&event))
+		{
+			WriteString(stream, setVolume->vca_path);
+			WriteValue(stream, setVolume->volume);
+		}
+	}
+
+	bool ReadPayload(std::istream& stream, InputEvent& event)
+	{
+		if (auto* openPage = std::get_if<OpenPageEvent>(&event)) { return ReadString(stream, openPage->page_name); }
+		if (auto* playSound = std::get_if<PlayProgrammerSoundEvent>(&event)) { return ReadString(stream, playSound->key); }
+		if (auto* setReverb = std::get_if<SetReverbEnabledEvent>(&event))
+		{
+			uint8_t enabled = 0;
+			if (!ReadValue(stream, enabled)) { return false; }
+			setReverb->enabled = enabled != 0;
+			return true;
+		}
+		if (auto* selectLocale = std::get_if<SelectLocaleEvent>(&event)) { return ReadString(stream, selectLocale->locale); }
+		if (auto* setVolume = std::get_if<SetVolumeEvent>(&event))
+		{
+			return ReadString(stream, setVolume->vca_path) && ReadValue(stream, setVolume->volume);
+		}
+		return true;
+	}
+}
+
+InputSession::InputSession(const InputSessionMode mode, std::string filePath)
+: mMode(mode)
+, mFilePath(std::move(filePath))
+, mReplayIndex(0)
+, mFrameIndex(0)
+, mEventCount(0)
+{}
+
+std::unique_ptr<InputSession> InputSession::CreateRecorder(const std::string& filePath)
+{
+	std::unique_ptr<InputSession> session(new InputSession(InputSessionMode::Record, filePath));
+	session->mRecordFile.open(filePath, std::ios::binary | std::ios::trunc);
+	if (!session->mRecordFile.is_open())
+	{
+		std::cout << "Input session: cannot write " << filePath << std::endl;
+		return nullptr;
+	}
+
+	InputSessionHeader header;
+	header.eventTypeCount = static_cast<uint16_t>(INPUT_EVENT_TYPE_COUNT);
+	WriteValue(session->mRecordFile, header);
+	std::cout << "Input session: recording to " << filePath << std::endl;
+	return session;
+}
+
+std::unique_ptr<InputSession> InputSession::CreateReplayer(const std::string& filePath)
+{
+	std::unique_ptr<InputSession> session(new InputSession(InputSessionMode::Replay, filePath));
+	if (!session->LoadReplay()) { return nullptr; }
+
+	std::cout << std::format("Input session: replaying {} events from {}", session->mReplayEvents.size(), filePath) << std::endl;
+	return session;
+}
+
+bool InputSession::LoadReplay()
+{
+	std::ifstream file(mFilePath, std::ios::binary);
+	InputSessionHeader header;
+	if (!file.is_open() || !ReadValue(file, header) || header.magic != INPUT_SESSION_MAGIC
+		|| header.version != INPUT_SESSION_VERSION || header.eventTypeCount != INPUT_EVENT_TYPE_COUNT)
+	{
+		std::cout << "Input session: " << mFilePath << " is missing or was recorded with other input events" << std::endl;
+		return false;
+	}
+
+	RecordedEvent record;
+	uint8_t eventType = 0;
+	while (ReadValue(file, record.frame))
+	{
+		if (!ReadValue(file, eventType) || eventType >= INPUT_EVENT_TYPE_COUNT)
+		{
+			std::cout << "Input session: " << mFilePath << " is corrupt" << std::endl;
+			return false;
+		}
+
+		record.event = MakeInputEvent(eventType, std::make_index_sequence<INPUT_EVENT_TYPE_COUNT>());
+		if (!ReadPayload(file, record.event))
+		{
+			std::cout << "Input session: " << mFilePath << " is truncated" << std::endl;
+			return false;
+		}
+		mReplayEvents.push_back(record);
+	}
+	return true;
+}
+
+void InputSession::ProcessFrame(std::vector<InputEvent>& ioEvents)
+{
+	if (mMode == InputSessionMode::Record) { RecordFrame(ioEvents); }
+	else { ReplayFrame(ioEvents); }
+	++mFrameIndex;
+}
+
+void InputSession::RecordFrame(const std::vector<InputEvent>& events)
+{
+	for (const InputEvent& event : events)
+	{
+		WriteValue(mRecordFile, mFrameIndex);
+		WriteValue(mRecordFile, static_cast<uint8_t>(event.index()));
+		WritePayload(mRecordFile, event);
+		++mEventCount;
+	}
+}
+
+void InputSession::ReplayFrame(std::vector<InputEvent>& ioEvents)
+{
+	// Live input would make the replay diverge, only closing the window still works
+	std::erase_if(ioEvents, [](const InputEvent& event) { return !std::holds_alternative<QuitRequestedEvent>(event); });
+
+	for (; mReplayIndex < mReplayEvents.size() && mReplayEvents[mReplayIndex].frame <= mFrameIndex; ++mReplayIndex)
+	{
+		ioEvents.push_back(mReplayEvents[mReplayIndex].event);
+		++mEventCount;
+	}
+
+	if (IsReplayFinished()) { ioEvents.emplace_back(QuitRequestedEvent()); }
+}
+
+void InputSession::Close()
+{
+	if (mMode == InputSessionMode::Record)
+	{
+		mRecordFile.close();
+		std::cout << std::format("Input session: recorded {} events over {} frames to {}", mEventCount, mFrameIndex, mFilePath) << std::endl;
+	}
+	else
+	{
+		std::cout << std::format("Input session: replayed {} of {} events over {} frames", mEventCount, mReplayEvents.size(), mFrameIndex) << std::endl;
+	}
+}
+
+InputSessionMode InputSession::GetMode() const
+{
+	return mMode;
+}
+
+bool InputSession::IsReplayFinished() const
+{
+	return mMode == InputSessionMode::Replay && mReplayIndex >= mReplayEvents.size();
+}
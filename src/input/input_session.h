@@ -0,0 +1,71 @@
+#ifndef INPUT_SESSION_H
+#define INPUT_SESSION_H
+
+#include "input_events.h"
+
+/*
+ * Input session file, native byte order:
+ *   InputSessionHeader
+ *   Records: uint32 frame index, uint8 InputEvent alternative index, then the payload of the alternative
+ *            (strings as uint16 length + bytes, floats as 4 bytes, bools as 1 byte)
+ * Only frames with events have records. The header stores the number of InputEvent alternatives,
+ * so a file recorded before the variant changed is rejected instead of replayed wrong.
+ */
+constexpr uint32_t INPUT_SESSION_MAGIC = 0x53494D46; // "FMIS"
+constexpr uint16_t INPUT_SESSION_VERSION = 1;
+
+struct InputSessionHeader
+{
+	uint32_t magic = INPUT_SESSION_MAGIC;
+	uint16_t version = INPUT_SESSION_VERSION;
+	uint16_t eventTypeCount = 0;
+};
+
+enum class InputSessionMode : uint8_t
+{
+	Record,
+	Replay
+};
+
+/**
+ * @brief Records the InputEvents that reach Application::ProcessEvents every frame, or replays a recording
+ * Recording writes the events of a frame with its index, replaying replaces the live events with the recorded
+ * ones of the same frame (the window close request still goes through) and quits after the last recorded frame.
+ * Since every page and GUI interaction is an InputEvent, a recorded session replays the same workload.
+ */
+class InputSession
+{
+	public:
+		static std::unique_ptr<InputSession> CreateRecorder(const std::string& filePath);
+		static std::unique_ptr<InputSession> CreateReplayer(const std::string& filePath);
+
+		/** Main thread, once per frame with all the events of the frame, before they are handled */
+		void ProcessFrame(std::vector<InputEvent>& ioEvents);
+		/** Flushes the recording and prints what was recorded or replayed */
+		void Close();
+
+		[[nodiscard]] InputSessionMode GetMode() const;
+		[[nodiscard]] bool IsReplayFinished() const;
+
+	private:
+		struct RecordedEvent
+		{
+			uint32_t frame = 0;
+			InputEvent event;
+		};
+
+		InputSessionMode mMode;
+		std::string mFilePath;
+		std::ofstream mRecordFile;
+		std::vector<RecordedEvent> mReplayEvents;
+		size_t mReplayIndex;
+		uint32_t mFrameIndex;
+		uint64_t mEventCount;
+
+		explicit InputSession(InputSessionMode mode, std::string filePath);
+
+		void RecordFrame(const std::vector<InputEvent>& events);
+		void ReplayFrame(std::vector<InputEvent>& ioEvents);
+		bool LoadReplay();
+};
+#endif
@@ -5,7 +5,5 @@ int main(int argc, char* argv[])
 	Application game;
 	game.Initialize();
 	game.Run();
-	game.Terminate();
-
-	return 0;
+	return game.Terminate();
 }
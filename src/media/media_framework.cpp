@@ -53,7 +53,7 @@ void MediaFramework::RenderClear(const Color& backgroundColor)
     ClearBackground(backgroundColor);
 }
 
-void MediaFramework::RenderStage()
+void MediaFramework::RenderStage(std::vector<InputEvent>& outEvents)
 {
     MediaFramework& instance = Get();
     for (auto it = instance.mRenderablePages.begin(); it != instance.mRenderablePages.end();)
@@ -64,7 +64,7 @@ void MediaFramework::RenderStage()
         }
         else
         {
-            ptr->RenderStage();
+            ptr->RenderStage(outEvents);
             ++it;
         }
     }
@@ -21,7 +21,7 @@ public:
 
     static void PollEvents(std::vector<InputEvent>& outEvents);
     static void RenderClear(const Color& backgroundColor);
-    static void RenderStage();
+    static void RenderStage(std::vector<InputEvent>& outEvents);
     static void RenderPresent();
 
     static const MediaWindowSettings& GetCurrentWindowSettings();
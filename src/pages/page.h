@@ -1,6 +1,8 @@
 #ifndef RENDEREABLE_H
 #define RENDEREABLE_H
 
+#include "input/input_events.h"
+
 class IPage : public std::enable_shared_from_this<IPage>
 {
     friend class MediaFramework;
@@ -15,12 +17,16 @@ public:
     virtual bool IsInitialized() const { return bIsInitialized.load(std::memory_order_relaxed); }
     virtual bool CanDestroy() { return bCanDestroy.load(std::memory_order_relaxed); }
 
+    /** Called by Application::ProcessEvents, erase the events the page handles */
+    virtual void ConsumeInputEvents(std::vector<InputEvent>& ioEvents) {}
+
 protected:
     std::atomic<bool> bIsInitialized = false;
     std::atomic<bool> bCanDestroy = true;
 
     virtual void Start() = 0;
-    virtual void RenderStage() = 0;
+    /** Widget interactions are emitted as events and handled by ConsumeInputEvents on the next frame */
+    virtual void RenderStage(std::vector<InputEvent>& outEvents) = 0;
 };
 
 #endif
\ No newline at end of file
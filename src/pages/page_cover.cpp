@@ -14,7 +14,8 @@ namespace
 }
 
 PageCover::PageCover()
-: mCurrentMusicBar(0)
+: mMusicDataMutex("PageCover::mMusicDataMutex")
+, mCurrentMusicBar(0)
 , mCurrentMusicBeat(0)
 , musicInstanceID(0)
 , audioObjectID(0)
@@ -33,7 +34,7 @@ void PageCover::Deinitialize()
     IPage::Deinitialize();
     MediaFramework::UnsubscribeFromRenderStage(weak_from_this());
 
-    mMusicInstance->setCallback(nullptr);
+    AudioEngine::InstanceSetCallback(mMusicInstance, nullptr);
     AudioEngine::InstanceStop(mMusicInstance);
     AudioEngine::UnloadSoundBank(mMusicBank);
 
@@ -47,7 +48,7 @@ void PageCover::Start()
         this, ProgrammerSoundCallback, FMOD_STUDIO_EVENT_CALLBACK_TIMELINE_BEAT);
 }
 
-void PageCover::RenderStage()
+void PageCover::RenderStage(std::vector<InputEvent>& outEvents)
 {
     const MediaWindowSettings& windowSettings = MediaFramework::GetCurrentWindowSettings();
 
@@ -72,7 +73,7 @@ FMOD_RESULT PageCover::ProgrammerSoundCallback(const FMOD_STUDIO_EVENT_CALLBACK_
         const auto* musicProperties = static_cast<FMOD_STUDIO_TIMELINE_BEAT_PROPERTIES*>(properties);
         const auto* audioInstance = reinterpret_cast<AudioInstance*>(eventInstance);
         void* userData;
-        if (audioInstance->getUserData(&userData) == FMOD_OK)
+        if (AudioEngine::InstanceGetUserData(audioInstance, userData))
         {
             if (const auto game = static_cast<PageCover*>(userData))
             {
@@ -4,6 +4,7 @@
 #include "page.h"
 
 #include "audio/audio_engine.h"
+#include "profiling/lock_profiler.h"
 
 class PageCover : public IPage
 {
@@ -14,14 +15,14 @@ public:
 
 protected:
     void Start() override;
-    void RenderStage() override;
+    void RenderStage(std::vector<InputEvent>& outEvents) override;
 
 private:
 
     AudioBank* mMusicBank = nullptr;
     AudioInstance* mMusicInstance = nullptr;
 
-    mutable std::mutex mMusicDataMutex;
+    mutable ProfiledMutex mMusicDataMutex;
     int mCurrentMusicBar;
     int mCurrentMusicBeat;
 
@@ -79,7 +79,7 @@ void PageProgrammerSounds::Deinitialize()
     IPage::Deinitialize();
     MediaFramework::UnsubscribeFromRenderStage(weak_from_this());
 
-    mCurrentAudioInstance->setCallback(nullptr);
+    AudioEngine::InstanceSetCallback(mCurrentAudioInstance, nullptr);
     AudioEngine::InstanceStop(mCurrentAudioInstance, false);
     AudioEngine::UnloadSoundBank(mLoadedBasicBank);
     AudioEngine::UnloadSoundBank(mLoadedLocalizedBank);
@@ -87,6 +87,57 @@ void PageProgrammerSounds::Deinitialize()
     bCanDestroy.store(true, std::memory_order_release);
 }
 
+void PageProgrammerSounds::ConsumeInputEvents(std::vector<InputEvent>& ioEvents)
+{
+    for (auto it = ioEvents.begin(); it != ioEvents.end();)
+    {
+        if (const auto* playEvent = std::get_if<PlayProgrammerSoundEvent>(&*it))
+        {
+            // The context keeps a pointer to the key, so play the table entry and not the event's copy
+            if (const auto keyIt = std::ranges::find(PROG_SOUND_KEYS, playEvent->key); keyIt != PROG_SOUND_KEYS.end())
+            {
+                mActiveListIndex = static_cast<int>(std::distance(PROG_SOUND_KEYS.begin(), keyIt));
+                PlayProgrammerSound(*keyIt);
+            }
+            it = ioEvents.erase(it);
+        }
+        else if (std::holds_alternative<StopProgrammerSoundEvent>(*it))
+        {
+            AudioEngine::InstanceStop(mCurrentAudioInstance, false);
+            AudioEngine::InstanceRelease(mCurrentAudioInstance);
+            mCurrentAudioInstance = nullptr;
+            it = ioEvents.erase(it);
+        }
+        else if (const auto* reverbEvent = std::get_if<SetReverbEnabledEvent>(&*it))
+        {
+            bReverbEnabled = reverbEvent->enabled;
+            HandleChangeReverbActiveState();
+            it = ioEvents.erase(it);
+        }
+        else if (const auto* localeEvent = std::get_if<SelectLocaleEvent>(&*it))
+        {
+            // Accepts the combo box entry or just the code, "Spanish (es)" or "es"
+            for (size_t i = 0; i < LOCALES.size(); ++i)
+            {
+                if (LOCALES[i] == localeEvent->locale || LOCALES[i].ends_with(std::format("({})", localeEvent->locale)))
+                {
+                    if (static_cast<int>(i) != mActiveLocaleIndex)
+                    {
+                        mActiveLocaleIndex = static_cast<int>(i);
+                        HandleLocaleChange();
+                    }
+                    break;
+                }
+            }
+            it = ioEvents.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
 void PageProgrammerSounds::Start()
 {
     AudioEngine::LoadSoundBankFile(BANK_PROG_BASIC, mLoadedBasicBank);
@@ -95,7 +146,7 @@ void PageProgrammerSounds::Start()
     PrepareGuiContent();
 }
 
-void PageProgrammerSounds::RenderStage()
+void PageProgrammerSounds::RenderStage(std::vector<InputEvent>& outEvents)
 {
     /** TITLE */
     const MediaWindowSettings& windowSettings = MediaFramework::GetCurrentWindowSettings();
@@ -136,7 +187,7 @@ void PageProgrammerSounds::RenderStage()
     {
         if (mActiveListIndex >= 0 && mActiveListIndex < PROG_SOUND_KEYS.size())
         {
-            PlayProgrammerSound(PROG_SOUND_KEYS[mActiveListIndex]);
+            outEvents.emplace_back(PlayProgrammerSoundEvent{PROG_SOUND_KEYS[mActiveListIndex]});
         }
     }
 
@@ -148,8 +199,7 @@ void PageProgrammerSounds::RenderStage()
         listRectangle.y + listRectangle.height + PADDING_Y, BUTTON_WIDTH, BUTTON_HEIGHT};
     if (GuiButton(stopButtonRectangle, LABEL_BUTTON_STOP))
     {
-        AudioEngine::InstanceStop(mCurrentAudioInstance, false);
-        mCurrentAudioInstance->release();
+        outEvents.emplace_back(StopProgrammerSoundEvent());
     }
 
     /** RESTORE DEFAULT STYLE */
@@ -164,7 +214,8 @@ void PageProgrammerSounds::RenderStage()
     GuiCheckBox(checkboxRectangle, LABEL_CHECKBOX_REVERB, &bReverbEnabled);
     if (bReverbEnabled != bReverbEnabledCurrent)
     {
-        HandleChangeReverbActiveState();
+        outEvents.emplace_back(SetReverbEnabledEvent{bReverbEnabled});
+        bReverbEnabled = bReverbEnabledCurrent;
     }
 
     /** LOCALE COMBO BOX*/
@@ -174,7 +225,8 @@ void PageProgrammerSounds::RenderStage()
     GuiComboBox(localeComboBoxRectangle, mComboBoxLocaleEntries.c_str(),  &mActiveLocaleIndex);
     if (currentActiveLocaleIndex != mActiveLocaleIndex)
     {
-        HandleLocaleChange();
+        outEvents.emplace_back(SelectLocaleEvent{LOCALES[mActiveLocaleIndex]});
+        mActiveLocaleIndex = currentActiveLocaleIndex;
     }
 
     const Rectangle statusBarRectangle{pivot.x + PADDING_X,
@@ -184,7 +236,7 @@ void PageProgrammerSounds::RenderStage()
     GuiSetStyle(DEFAULT, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
     /** STATUS BAR*/
     std::string status = "Now Playing:""\n";
-    if (!mActiveTableKey.empty() && mCurrentAudioInstance->isValid())
+    if (!mActiveTableKey.empty() && mCurrentAudioInstance && mCurrentAudioInstance->isValid())
     {
         status = std::format("Now Playing:""\n{}", mActiveTableKey);
     }
@@ -218,13 +270,13 @@ void PageProgrammerSounds::PrepareGuiContent()
 
 void PageProgrammerSounds::PlayProgrammerSound(const std::string& audioTableKey)
 {
-    bool bIsPlaying;
+    bool bIsPlaying = false;
     AudioEngine::InstanceIsPlaying(mCurrentAudioInstance, bIsPlaying);
 
     if (bIsPlaying)
     {
         AudioEngine::InstanceStop(mCurrentAudioInstance, false);
-        mCurrentAudioInstance->release();
+        AudioEngine::InstanceRelease(mCurrentAudioInstance);
     }
 
     mCurrentContext.key = audioTableKey.c_str();
@@ -233,7 +285,7 @@ void PageProgrammerSounds::PlayProgrammerSound(const std::string& audioTableKey)
     mCurrentAudioInstance = AudioEngine::PlayAudioEvent(EVENT_PROG_SOUNDS,{}, &mCurrentContext, AudioEventCallback,
         FMOD_STUDIO_EVENT_CALLBACK_CREATE_PROGRAMMER_SOUND | FMOD_STUDIO_EVENT_CALLBACK_DESTROY_PROGRAMMER_SOUND);
 
-    if (mCurrentAudioInstance->isValid())
+    if (mCurrentAudioInstance && mCurrentAudioInstance->isValid())
     {
         mActiveTableKey = audioTableKey;
     }
@@ -242,7 +294,7 @@ void PageProgrammerSounds::PlayProgrammerSound(const std::string& audioTableKey)
 
 void PageProgrammerSounds::HandleChangeReverbActiveState() const
 {
-    if (mCurrentAudioInstance->isValid())
+    if (mCurrentAudioInstance && mCurrentAudioInstance->isValid())
     {
         mCurrentAudioInstance->setParameterByName(PARAM_REVERB.c_str(), bReverbEnabled ? 1.0f : 0.0f);
     }
@@ -270,9 +322,10 @@ FMOD_RESULT PageProgrammerSounds::AudioEventCallback(const FMOD_STUDIO_EVENT_CAL
     {
         if (type == FMOD_STUDIO_EVENT_CALLBACK_CREATE_PROGRAMMER_SOUND)
         {
-            ProgrammerSoundContext* context = nullptr;
-            if (audioInstance->getUserData(reinterpret_cast<void**>(&context)) != FMOD_OK)
+            void* userData = nullptr;
+            if (!AudioEngine::InstanceGetUserData(audioInstance, userData))
                 return FMOD_ERR_BADCOMMAND;
+            const auto context = static_cast<ProgrammerSoundContext*>(userData);
 
             StudioSystem* studioSystem;
             if (audioInstance->getSystem(&studioSystem) != FMOD_OK)
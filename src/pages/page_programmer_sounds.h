@@ -11,10 +11,11 @@ public:
     PageProgrammerSounds();
     void Initialize() override;
     void Deinitialize() override;
+    void ConsumeInputEvents(std::vector<InputEvent>& ioEvents) override;
 
 protected:
     void Start() override;
-    void RenderStage() override;
+    void RenderStage(std::vector<InputEvent>& outEvents) override;
 
 private:
     ProgrammerSoundContext mCurrentContext{};
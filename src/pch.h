@@ -4,10 +4,16 @@
 #ifdef __cplusplus
 
 // C++ STD Library
+#include <array>
 #include <atomic>
+#include <bit>
 #include <cassert>
 #include <chrono>
 #include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <filesystem>
 #include <format>
 #include <fstream>
@@ -16,10 +22,12 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <ostream>
 #include <ranges>
 #include <set>
 #include <string>
+#include <thread>
 #include <variant>
 #include <vector>
 
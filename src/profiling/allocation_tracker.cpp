@@ -0,0 +1,351 @@
+#include "allocation_tracker.h"
+
+#include "audio/audio_config.h"
+#include "history_ring.h"
+
+namespace
+{
+	struct ThreadSlot
+	{
+		std::atomic<uint64_t> allocations;
+		std::atomic<uint64_t> bytes;
+		std::atomic<uint64_t> frees;
+		char name[ALLOCATION_THREAD_NAME_LENGTH];
+
+		// Main thread only (EndFrame)
+		uint64_t frameStartAllocations;
+		uint64_t frameStartBytes;
+		uint64_t lastFrameAllocations;
+		uint64_t lastFrameBytes;
+	};
+
+	struct AllocationState
+	{
+		std::atomic<bool> bIsEnabled;
+		std::atomic<uint64_t> allocations;
+		std::atomic<uint64_t> bytes;
+		std::atomic<uint64_t> frees;
+
+		// The last slot is shared by every thread registered once the others are taken
+		std::atomic<size_t> threadSlotCount;
+		ThreadSlot threadSlots[ALLOCATION_TRACKER_MAX_THREADS];
+	};
+
+	struct FrameState
+	{
+		uint64_t frameIndex = 0;
+		uint64_t frameStartAllocations = 0;
+		uint64_t frameStartBytes = 0;
+		uint64_t mainThreadFrameStartAllocations = 0;
+		uint64_t framesSinceReset = 0;
+
+		bool bTestModeEnabled = false;
+		bool bTestAllThreads = false;
+		uint64_t testMaxAllocationsPerFrame = 0;
+		uint64_t testWarmupFrames = 120;
+		uint64_t steadyStateFrames = 0;
+		uint64_t steadyStateViolations = 0;
+		uint64_t steadyStateMaxAllocations = 0;
+		uint64_t firstViolationFrame = 0;
+
+		AllocationFrameStats lastFrame;
+		HistoryRing<AllocationFrameStats, 256> recentFrames;
+	};
+
+	constinit AllocationState gAllocationState {};
+	constinit thread_local ThreadSlot* tThreadSlot = nullptr;
+
+	FrameState& GetFrameState()
+	{
+		static FrameState frameState;
+		return frameState;
+	}
+
+	ThreadSlot& GetThreadSlot()
+	{
+		if (!tThreadSlot)
+		{
+			const size_t index = std::min(gAllocationState.threadSlotCount.fetch_add(1, std::memory_order_relaxed),
+				ALLOCATION_TRACKER_MAX_THREADS - 1);
+			tThreadSlot = &gAllocationState.threadSlots[index];
+		}
+		return *tThreadSlot;
+	}
+
+	void* AllocateAligned(const size_t size, const size_t alignment)
+	{
+#ifdef WIN32
+		return _aligned_malloc(size, alignment);
+#else
+		void* memory = nullptr;
+		return posix_memalign(&memory, std::max(alignment, sizeof(void*)), size) == 0 ? memory : nullptr;
+#endif
+	}
+
+	void FreeAligned(void* memory)
+	{
+#ifdef WIN32
+		_aligned_free(memory);
+#else
+		std::free(memory);
+#endif
+	}
+
+	void* TrackedAllocate(size_t size)
+	{
+		if (size == 0) { size = 1; }
+		AllocationTracker::RecordAllocation(size);
+		return std::malloc(size);
+	}
+
+	void* TrackedAllocateAligned(size_t size, const std::align_val_t alignment)
+	{
+		if (size == 0) { size = 1; }
+		AllocationTracker::RecordAllocation(size);
+		return AllocateAligned(size, static_cast<size_t>(alignment));
+	}
+
+	void TrackedFree(void* memory)
+	{
+		if (!memory) { return; }
+		AllocationTracker::RecordFree();
+		std::free(memory);
+	}
+
+	void TrackedFreeAligned(void* memory)
+	{
+		if (!memory) { return; }
+		AllocationTracker::RecordFree();
+		FreeAligned(memory);
+	}
+}
+
+bool AllocationTracker::Initialize()
+{
+	const AudioConfig& config = AudioConfig::Get();
+	if (!config.IsLoaded()) { return false; }
+
+	FrameState& frameState = GetFrameState();
+	frameState.bTestModeEnabled = config.GetBool("Profiling", "AllocationTestMode");
+	frameState.testMaxAllocationsPerFrame = std::max(config.GetInt("Profiling", "AllocationTestMaxPerFrame", 0), 0);
+	frameState.testWarmupFrames = std::max(config.GetInt("Profiling", "AllocationTestWarmupFrames", 120), 0);
+	frameState.bTestAllThreads = config.GetBool("Profiling", "AllocationTestAllThreads");
+
+	SetThreadName("Main");
+	SetEnabled(config.GetBool("Profiling", "EnableAllocationTracking") || frameState.bTestModeEnabled);
+	ResetSteadyState();
+	return true;
+}
+
+bool AllocationTracker::Terminate()
+{
+	if (!IsEnabled()) { return true; }
+
+	const FrameState& frameState = GetFrameState();
+	std::cout << std::format("Allocations: {} total, {} bytes, {} frees over {} frames",
+		gAllocationState.allocations.load(std::memory_order_relaxed), gAllocationState.bytes.load(std::memory_order_relaxed),
+		gAllocationState.frees.load(std::memory_order_relaxed), frameState.frameIndex) << std::endl;
+
+	bool bPassed = true;
+	if (frameState.bTestModeEnabled)
+	{
+		bPassed = frameState.steadyStateViolations == 0;
+		std::cout << std::format("Allocation test {}: {} of {} steady-state frames exceeded {} allocations on {} (max {}, first at frame {})",
+			bPassed ? "PASSED" : "FAILED", frameState.steadyStateViolations, frameState.steadyStateFrames,
+			frameState.testMaxAllocationsPerFrame, frameState.bTestAllThreads ? "all threads" : "the main thread", frameState.steadyStateMaxAllocations, frameState.firstViolationFrame) << std::endl;
+	}
+
+	SetEnabled(false);
+	return bPassed;
+}
+
+bool AllocationTracker::IsEnabled()
+{
+	return gAllocationState.bIsEnabled.load(std::memory_order_relaxed);
+}
+
+void AllocationTracker::SetEnabled(const bool bEnabled)
+{
+	gAllocationState.bIsEnabled.store(bEnabled, std::memory_order_relaxed);
+}
+
+void AllocationTracker::SetThreadName(const char* name)
+{
+	ThreadSlot& slot = GetThreadSlot();
+	std::strncpy(slot.name, name, ALLOCATION_THREAD_NAME_LENGTH - 1);
+}
+
+void AllocationTracker::EndFrame()
+{
+	if (!IsEnabled()) { return; }
+
+	FrameState& frameState = GetFrameState();
+	const uint64_t allocations = gAllocationState.allocations.load(std::memory_order_relaxed);
+	const uint64_t bytes = gAllocationState.bytes.load(std::memory_order_relaxed);
+	const uint64_t mainThreadAllocations = GetThreadSlot().allocations.load(std::memory_order_relaxed);
+
+	AllocationFrameStats& frame = frameState.lastFrame;
+	frame.frameIndex = frameState.frameIndex++;
+	frame.allocations = allocations - frameState.frameStartAllocations;
+	frame.bytes = bytes - frameState.frameStartBytes;
+	frame.mainThreadAllocations = mainThreadAllocations - frameState.mainThreadFrameStartAllocations;
+	frame.bIsSteadyState = ++frameState.framesSinceReset > frameState.testWarmupFrames;
+
+	frameState.frameStartAllocations = allocations;
+	frameState.frameStartBytes = bytes;
+	frameState.mainThreadFrameStartAllocations = mainThreadAllocations;
+
+	const size_t threadSlotCount = std::min(gAllocationState.threadSlotCount.load(std::memory_order_relaxed),
+		ALLOCATION_TRACKER_MAX_THREADS);
+	for (size_t i = 0; i < threadSlotCount; ++i)
+	{
+		ThreadSlot& slot = gAllocationState.threadSlots[i];
+		const uint64_t slotAllocations = slot.allocations.load(std::memory_order_relaxed);
+		const uint64_t slotBytes = slot.bytes.load(std::memory_order_relaxed);
+		slot.lastFrameAllocations = slotAllocations - slot.frameStartAllocations;
+		slot.lastFrameBytes = slotBytes - slot.frameStartBytes;
+		slot.frameStartAllocations = slotAllocations;
+		slot.frameStartBytes = slotBytes;
+	}
+
+	if (frame.bIsSteadyState)
+	{
+		// The other threads (logger, metrics server, watchdog) allocate on their own schedule, outside the frame loop
+		const uint64_t testedAllocations = frameState.bTestAllThreads ? frame.allocations : frame.mainThreadAllocations;
+		++frameState.steadyStateFrames;
+		frameState.steadyStateMaxAllocations = std::max(frameState.steadyStateMaxAllocations, testedAllocations);
+		if (frameState.bTestModeEnabled && testedAllocations > frameState.testMaxAllocationsPerFrame
+			&& frameState.steadyStateViolations++ == 0)
+		{
+			frameState.firstViolationFrame = frame.frameIndex;
+		}
+	}
+
+	frameState.recentFrames.Push(frame);
+}
+
+void AllocationTracker::ResetSteadyState()
+{
+	GetFrameState().framesSinceReset = 0;
+}
+
+AllocationFrameStats AllocationTracker::GetLastFrame()
+{
+	return GetFrameState().lastFrame;
+}
+
+size_t AllocationTracker::GetRecentFrames(AllocationFrameStats* outFrames, const size_t maxCount)
+{
+	return GetFrameState().recentFrames.CopyRecent(outFrames, maxCount);
+}
+
+size_t AllocationTracker::GetThreadStats(AllocationThreadStats* outStats, const size_t maxCount)
+{
+	const size_t count = std::min({gAllocationState.threadSlotCount.load(std::memory_order_relaxed),
+		ALLOCATION_TRACKER_MAX_THREADS, maxCount});
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const ThreadSlot& slot = gAllocationState.threadSlots[i];
+		AllocationThreadStats& stats = outStats[i];
+		if (slot.name[0] != '\0') { std::memcpy(stats.name, slot.name, ALLOCATION_THREAD_NAME_LENGTH); }
+		else { std::snprintf(stats.name, ALLOCATION_THREAD_NAME_LENGTH, "Thread %zu", i); }
+		stats.allocations = slot.allocations.load(std::memory_order_relaxed);
+		stats.bytes = slot.bytes.load(std::memory_order_relaxed);
+		stats.frees = slot.frees.load(std::memory_order_relaxed);
+		stats.lastFrameAllocations = slot.lastFrameAllocations;
+		stats.lastFrameBytes = slot.lastFrameBytes;
+	}
+	return count;
+}
+
+bool AllocationTracker::IsTestModeEnabled()
+{
+	return GetFrameState().bTestModeEnabled;
+}
+
+uint64_t AllocationTracker::GetSteadyStateViolationCount()
+{
+	return GetFrameState().steadyStateViolations;
+}
+
+void AllocationTracker::RecordAllocation(const size_t size)
+{
+	if (!IsEnabled()) { return; }
+
+	gAllocationState.allocations.fetch_add(1, std::memory_order_relaxed);
+	gAllocationState.bytes.fetch_add(size, std::memory_order_relaxed);
+
+	ThreadSlot& slot = GetThreadSlot();
+	slot.allocations.fetch_add(1, std::memory_order_relaxed);
+	slot.bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void AllocationTracker::RecordFree()
+{
+	if (!IsEnabled()) { return; }
+
+	gAllocationState.frees.fetch_add(1, std::memory_order_relaxed);
+	GetThreadSlot().frees.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Replacement global allocation functions
+// Refer to: https://en.cppreference.com/w/cpp/memory/new/operator_new#Global_replacements
+
+void* operator new(const size_t size)
+{
+	if (void* memory = TrackedAllocate(size)) { return memory; }
+	throw std::bad_alloc();
+}
+
+void* operator new[](const size_t size)
+{
+	if (void* memory = TrackedAllocate(size)) { return memory; }
+	throw std::bad_alloc();
+}
+
+void* operator new(const size_t size, const std::nothrow_t&) noexcept
+{
+	return TrackedAllocate(size);
+}
+
+void* operator new[](const size_t size, const std::nothrow_t&) noexcept
+{
+	return TrackedAllocate(size);
+}
+
+void* operator new(const size_t size, const std::align_val_t alignment)
+{
+	if (void* memory = TrackedAllocateAligned(size, alignment)) { return memory; }
+	throw std::bad_alloc();
+}
+
+void* operator new[](const size_t size, const std::align_val_t alignment)
+{
+	if (void* memory = TrackedAllocateAligned(size, alignment)) { return memory; }
+	throw std::bad_alloc();
+}
+
+void* operator new(const size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return TrackedAllocateAligned(size, alignment);
+}
+
+void* operator new[](const size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return TrackedAllocateAligned(size, alignment);
+}
+
+void operator delete(void* memory) noexcept { TrackedFree(memory); }
+void operator delete[](void* memory) noexcept { TrackedFree(memory); }
+void operator delete(void* memory, size_t) noexcept { TrackedFree(memory); }
+void operator delete[](void* memory, size_t) noexcept { TrackedFree(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { TrackedFree(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { TrackedFree(memory); }
+
+void operator delete(void* memory, std::align_val_t) noexcept { TrackedFreeAligned(memory); }
+void operator delete[](void* memory, std::align_val_t) noexcept { TrackedFreeAligned(memory); }
+void operator delete(void* memory, size_t, std::align_val_t) noexcept { TrackedFreeAligned(memory); }
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept { TrackedFreeAligned(memory); }
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept { TrackedFreeAligned(memory); }
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept { TrackedFreeAligned(memory); }
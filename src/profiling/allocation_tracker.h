@@ -0,0 +1,63 @@
+#ifndef ALLOCATION_TRACKER_H
+#define ALLOCATION_TRACKER_H
+
+constexpr size_t ALLOCATION_TRACKER_MAX_THREADS = 32;
+constexpr size_t ALLOCATION_THREAD_NAME_LENGTH = 32;
+
+struct AllocationFrameStats
+{
+	uint64_t frameIndex = 0;
+	uint64_t allocations = 0;      // All threads
+	uint64_t bytes = 0;            // All threads
+	uint64_t mainThreadAllocations = 0;
+	bool bIsSteadyState = false;
+};
+
+struct AllocationThreadStats
+{
+	char name[ALLOCATION_THREAD_NAME_LENGTH] = {};
+	uint64_t allocations = 0;
+	uint64_t bytes = 0;
+	uint64_t frees = 0;
+	uint64_t lastFrameAllocations = 0;
+	uint64_t lastFrameBytes = 0;
+};
+
+/**
+ * @brief Counts global operator new/delete calls per frame and per thread, toggled by [Profiling] EnableAllocationTracking
+ * The replacement operators live in allocation_tracker.cpp and only add a relaxed atomic load while disabled.
+ * All state is constant-initialized because operator new can run before main and must never allocate itself,
+ * so unlike the other profilers this class has no Get()/sInstance.
+ *
+ * With [Profiling] AllocationTestMode the tracker fails (Terminate returns false) when any steady-state frame,
+ * i.e. any frame after AllocationTestWarmupFrames since start or the last page change, allocates more than
+ * AllocationTestMaxPerFrame times on the main thread (on every thread with AllocationTestAllThreads).
+ */
+class AllocationTracker
+{
+	public:
+		static bool Initialize();
+		/** Prints the summary. Returns false if the steady-state allocation test failed. */
+		static bool Terminate();
+
+		static bool IsEnabled();
+		static void SetEnabled(bool bEnabled);
+
+		/** Names the calling thread in the per-thread stats */
+		static void SetThreadName(const char* name);
+
+		// Main thread only
+		static void EndFrame();
+		static void ResetSteadyState();
+
+		static AllocationFrameStats GetLastFrame();
+		static size_t GetRecentFrames(AllocationFrameStats* outFrames, size_t maxCount);
+		static size_t GetThreadStats(AllocationThreadStats* outStats, size_t maxCount);
+		static bool IsTestModeEnabled();
+		static uint64_t GetSteadyStateViolationCount();
+
+		// Called by the replacement operator new/delete
+		static void RecordAllocation(size_t size);
+		static void RecordFree();
+};
+#endif
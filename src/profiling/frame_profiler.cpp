@@ -0,0 +1,70 @@
+#include "frame_profiler.h"
+
+#include "steady_time.h"
+
+std::unique_ptr<FrameProfiler> FrameProfiler::sInstance(nullptr);
+
+namespace
+{
+	constexpr int64_t NS_PER_SECOND = 1000000000;
+	constexpr int64_t AVERAGE_WINDOW_FRAMES = 60;
+}
+
+FrameProfiler::FrameProfiler()
+: mLastFrameEndNs(0)
+, mWindowStartNs(0)
+, mWindowMaxFrameNs(0)
+{}
+
+FrameProfiler& FrameProfiler::Get()
+{
+	if (!sInstance)
+	{
+		sInstance = std::unique_ptr<FrameProfiler>(new FrameProfiler());
+	}
+	return *sInstance;
+}
+
+void FrameProfiler::EndFrame()
+{
+	FrameProfiler& frameProfiler = Get();
+	const int64_t now = GetSteadyTimeNs();
+
+	if (frameProfiler.mLastFrameEndNs == 0) // First frame has no start
+	{
+		frameProfiler.mLastFrameEndNs = now;
+		frameProfiler.mWindowStartNs = now;
+		return;
+	}
+
+	FrameTimingStats& stats = frameProfiler.mStats;
+	const int64_t frameNs = now - frameProfiler.mLastFrameEndNs;
+	frameProfiler.mLastFrameEndNs = now;
+
+	++stats.frameIndex;
+	stats.lastFrameNs = frameNs;
+	stats.averageFrameNs = stats.averageFrameNs == 0
+		? frameNs
+		: stats.averageFrameNs + (frameNs - stats.averageFrameNs) / AVERAGE_WINDOW_FRAMES;
+
+	frameProfiler.mWindowMaxFrameNs = std::max(frameProfiler.mWindowMaxFrameNs, frameNs);
+	if (now - frameProfiler.mWindowStartNs >= NS_PER_SECOND)
+	{
+		stats.maxFrameNs = frameProfiler.mWindowMaxFrameNs;
+		frameProfiler.mWindowMaxFrameNs = 0;
+		frameProfiler.mWindowStartNs = now;
+	}
+
+	frameProfiler.mFrameTimeNs.Record(static_cast<uint64_t>(frameNs));
+	frameProfiler.mStatsSnapshot.Publish(stats);
+}
+
+bool FrameProfiler::GetStats(FrameTimingStats& outStats)
+{
+	return sInstance && sInstance->mStatsSnapshot.Read(outStats);
+}
+
+const HdrHistogram* FrameProfiler::GetFrameTimeHistogram()
+{
+	return sInstance ? &sInstance->mFrameTimeNs : nullptr;
+}
@@ -0,0 +1,43 @@
+#ifndef FRAME_PROFILER_H
+#define FRAME_PROFILER_H
+
+#include "histogram.h"
+#include "snapshot_buffer.h"
+
+struct FrameTimingStats
+{
+	uint64_t frameIndex = 0;
+	int64_t lastFrameNs = 0;
+	int64_t averageFrameNs = 0; // Exponential moving average over roughly the last 60 frames
+	int64_t maxFrameNs = 0;     // Worst frame of the last completed one-second window
+};
+
+/**
+ * @brief Main loop frame times, closed once per frame by Application::Run
+ * The timing snapshot and the frame time histogram can be read from any thread.
+ */
+class FrameProfiler
+{
+	public:
+		static FrameProfiler& Get();
+
+		/** Main thread only */
+		static void EndFrame();
+
+		static bool GetStats(FrameTimingStats& outStats);
+		/** Null before the first EndFrame */
+		static const HdrHistogram* GetFrameTimeHistogram();
+
+	private:
+		static std::unique_ptr<FrameProfiler> sInstance;
+
+		int64_t mLastFrameEndNs;
+		int64_t mWindowStartNs;
+		int64_t mWindowMaxFrameNs;
+		FrameTimingStats mStats; // Main thread copy
+		SnapshotBuffer<FrameTimingStats> mStatsSnapshot;
+		HdrHistogram mFrameTimeNs;
+
+		FrameProfiler();
+};
+#endif
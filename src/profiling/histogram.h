@@ -0,0 +1,133 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+/**
+ * @brief Lock-free log-linear (HDR-style) histogram for unsigned integer samples
+ * Every power of two is split into 2^SUB_BUCKET_BITS linear buckets, so the relative error of any
+ * reported value is below 1 / 2^SUB_BUCKET_BITS (12.5%) across the whole range.
+ * Record() only does relaxed atomic increments and can be called from any thread, including FMOD callbacks.
+ * Reads are not a consistent snapshot while writers are active, which is fine for profiling output.
+ */
+class HdrHistogram
+{
+	public:
+		static constexpr int SUB_BUCKET_BITS = 3;
+		static constexpr int MAX_VALUE_BITS = 40;
+		static constexpr uint64_t SUB_BUCKET_COUNT = 1ull << SUB_BUCKET_BITS;
+		static constexpr uint64_t MAX_VALUE = (1ull << MAX_VALUE_BITS) - 1;
+		static constexpr int BUCKET_COUNT = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * static_cast<int>(SUB_BUCKET_COUNT);
+
+		HdrHistogram() = default;
+		HdrHistogram(const HdrHistogram&) = delete;
+		HdrHistogram& operator=(const HdrHistogram&) = delete;
+
+		void Record(uint64_t value)
+		{
+			value = std::min(value, MAX_VALUE);
+			mBuckets[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+			mCount.fetch_add(1, std::memory_order_relaxed);
+			mSum.fetch_add(value, std::memory_order_relaxed);
+
+			uint64_t currentMax = mMax.load(std::memory_order_relaxed);
+			while (value > currentMax && !mMax.compare_exchange_weak(currentMax, value, std::memory_order_relaxed)) {}
+
+			uint64_t currentMin = mMin.load(std::memory_order_relaxed);
+			while (value < currentMin && !mMin.compare_exchange_weak(currentMin, value, std::memory_order_relaxed)) {}
+		}
+
+		void Reset()
+		{
+			for (auto& bucket : mBuckets) { bucket.store(0, std::memory_order_relaxed); }
+			mCount.store(0, std::memory_order_relaxed);
+			mSum.store(0, std::memory_order_relaxed);
+			mMax.store(0, std::memory_order_relaxed);
+			mMin.store(UINT64_MAX, std::memory_order_relaxed);
+		}
+
+		[[nodiscard]] uint64_t GetCount() const { return mCount.load(std::memory_order_relaxed); }
+		[[nodiscard]] uint64_t GetMax() const { return mMax.load(std::memory_order_relaxed); }
+		[[nodiscard]] uint64_t GetMin() const
+		{
+			return GetCount() == 0 ? 0 : mMin.load(std::memory_order_relaxed);
+		}
+		[[nodiscard]] double GetMean() const
+		{
+			const uint64_t count = GetCount();
+			return count == 0 ? 0.0 : static_cast<double>(mSum.load(std::memory_order_relaxed)) / static_cast<double>(count);
+		}
+
+		// Returns the upper bound of the bucket holding the requested percentile (0-100), clamped to the recorded max
+		[[nodiscard]] uint64_t GetPercentile(const double percentile) const
+		{
+			const uint64_t count = GetCount();
+			if (count == 0) { return 0; }
+
+			const auto target = static_cast<uint64_t>(std::ceil(std::clamp(percentile, 0.0, 100.0) * 0.01 * static_cast<double>(count)));
+			uint64_t accumulated = 0;
+			for (int i = 0; i < BUCKET_COUNT; ++i)
+			{
+				accumulated += mBuckets[i].load(std::memory_order_relaxed);
+				if (accumulated >= std::max<uint64_t>(target, 1))
+				{
+					return std::min(BucketUpperBound(i), GetMax());
+				}
+			}
+			return GetMax();
+		}
+
+		// Visits every non-empty bucket as (lowerBound, upperBound, count)
+		template <typename Visitor>
+		void ForEachBucket(Visitor&& visitor) const
+		{
+			for (int i = 0; i < BUCKET_COUNT; ++i)
+			{
+				if (const uint64_t count = mBuckets[i].load(std::memory_order_relaxed); count > 0)
+				{
+					visitor(BucketLowerBound(i), BucketUpperBound(i), count);
+				}
+			}
+		}
+
+		static int BucketIndex(const uint64_t value)
+		{
+			if (value < SUB_BUCKET_COUNT) { return static_cast<int>(value); }
+
+			const int msb = std::bit_width(value) - 1;
+			const int shift = msb - SUB_BUCKET_BITS;
+			return (shift + 1) * static_cast<int>(SUB_BUCKET_COUNT) + static_cast<int>((value >> shift) - SUB_BUCKET_COUNT);
+		}
+
+		static uint64_t BucketLowerBound(const int index)
+		{
+			if (index < static_cast<int>(SUB_BUCKET_COUNT)) { return static_cast<uint64_t>(index); }
+
+			const int shift = index / static_cast<int>(SUB_BUCKET_COUNT) - 1;
+			const uint64_t subBucket = static_cast<uint64_t>(index) % SUB_BUCKET_COUNT;
+			return (SUB_BUCKET_COUNT + subBucket) << shift;
+		}
+
+		static uint64_t BucketUpperBound(const int index)
+		{
+			if (index < static_cast<int>(SUB_BUCKET_COUNT)) { return static_cast<uint64_t>(index); }
+
+			const int shift = index / static_cast<int>(SUB_BUCKET_COUNT) - 1;
+			return BucketLowerBound(index) + (1ull << shift) - 1;
+		}
+
+	private:
+		std::array<std::atomic<uint64_t>, BUCKET_COUNT> mBuckets{};
+		std::atomic<uint64_t> mCount = 0;
+		std::atomic<uint64_t> mSum = 0;
+		std::atomic<uint64_t> mMax = 0;
+		std::atomic<uint64_t> mMin = UINT64_MAX;
+};
+
+/** Histogram of nanosecond samples as a JSON object in milliseconds */
+inline std::string FormatHistogramMs(const HdrHistogram& histogram)
+{
+	return std::format(R"({{"mean":{:.4f},"p50":{:.4f},"p90":{:.4f},"p99":{:.4f},"max":{:.4f}}})",
+		histogram.GetMean() * 1e-6, static_cast<double>(histogram.GetPercentile(50)) * 1e-6,
+		static_cast<double>(histogram.GetPercentile(90)) * 1e-6, static_cast<double>(histogram.GetPercentile(99)) * 1e-6,
+		static_cast<double>(histogram.GetMax()) * 1e-6);
+}
+#endif
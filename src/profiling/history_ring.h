@@ -0,0 +1,66 @@
+#ifndef HISTORY_RING_H
+#define HISTORY_RING_H
+
+/**
+ * @brief Fixed-size, overwrite-oldest ring of recent values
+ * One producer thread pushes; any number of reader threads can copy the most recent entries at any time.
+ * Each slot carries its own sequence number, readers skip slots that are being rewritten instead of waiting.
+ */
+template <typename T, size_t Capacity>
+	requires std::is_trivially_copyable_v<T> && (std::has_single_bit(Capacity))
+class HistoryRing
+{
+	public:
+		HistoryRing() = default;
+		HistoryRing(const HistoryRing&) = delete;
+		HistoryRing& operator=(const HistoryRing&) = delete;
+
+		// Producer thread only
+		void Push(const T& value)
+		{
+			const uint64_t index = mWriteIndex.load(std::memory_order_relaxed);
+			Slot& slot = mSlots[index & (Capacity - 1)];
+
+			slot.sequence.store(index * 2 + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			slot.value = value;
+			slot.sequence.store(index * 2 + 2, std::memory_order_release);
+
+			mWriteIndex.store(index + 1, std::memory_order_release);
+		}
+
+		// Any thread. Copies up to maxCount of the newest entries, oldest first. Returns the number copied.
+		size_t CopyRecent(T* outValues, const size_t maxCount) const
+		{
+			const uint64_t end = mWriteIndex.load(std::memory_order_acquire);
+			const uint64_t count = std::min<uint64_t>({maxCount, end, Capacity});
+
+			size_t copied = 0;
+			for (uint64_t index = end - count; index < end; ++index)
+			{
+				const Slot& slot = mSlots[index & (Capacity - 1)];
+				const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+				if (sequence != index * 2 + 2) { continue; }
+
+				T value = slot.value;
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if (slot.sequence.load(std::memory_order_relaxed) != sequence) { continue; }
+
+				outValues[copied++] = value;
+			}
+			return copied;
+		}
+
+		[[nodiscard]] uint64_t GetTotalPushed() const { return mWriteIndex.load(std::memory_order_acquire); }
+
+	private:
+		struct Slot
+		{
+			std::atomic<uint64_t> sequence = 0;
+			T value{};
+		};
+
+		std::array<Slot, Capacity> mSlots{};
+		std::atomic<uint64_t> mWriteIndex = 0;
+};
+#endif
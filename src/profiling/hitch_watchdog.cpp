@@ -0,0 +1,223 @@
+#include "hitch_watchdog.h"
+
+#include "allocation_tracker.h"
+#include "audio/audio_config.h"
+
+std::unique_ptr<HitchWatchdog> HitchWatchdog::sInstance(nullptr);
+
+namespace
+{
+	constexpr int64_t NS_PER_MS = 1000000;
+	constexpr int64_t MIN_CHECK_INTERVAL_NS = 5 * NS_PER_MS;
+
+	std::string FormatWallClock(const int64_t wallClockMs)
+	{
+		const auto time64 = static_cast<std::time_t>(wallClockMs / 1000);
+
+		std::tm localTime {};
+#ifdef WIN32
+		localtime_s(&localTime, &time64);   // Windows (safe version)
+#else
+		localtime_r(&time64, &localTime);   // POSIX (safe version on Linux/macOS)
+#endif
+
+		std::ostringstream stringStreamTime;
+		stringStreamTime << std::put_time(&localTime, "%d-%b-%Y %H:%M:%S");
+		return std::format("{}.{:03}", stringStreamTime.str(), wallClockMs % 1000);
+	}
+
+	double NsToMs(const int64_t ns)
+	{
+		return static_cast<double>(ns) / static_cast<double>(NS_PER_MS);
+	}
+}
+
+HitchWatchdog::HitchWatchdog()
+: bIsEnabled(false)
+, mThresholdNs(100 * NS_PER_MS)
+, mCurrentPhase(nullptr)
+, bStopRequested(false)
+{}
+
+HitchWatchdog::~HitchWatchdog()
+{
+	StopThread();
+}
+
+HitchWatchdog& HitchWatchdog::Get()
+{
+	if (!sInstance)
+	{
+		sInstance = std::unique_ptr<HitchWatchdog>(new HitchWatchdog());
+	}
+	return *sInstance;
+}
+
+bool HitchWatchdog::Initialize()
+{
+	HitchWatchdog& watchdog = Get();
+	if (watchdog.mThread.joinable()) { return true; } // Already Initialized
+
+	const AudioConfig& config = AudioConfig::Get();
+	if (!config.IsLoaded()) { return false; }
+	if (!config.GetBool("Watchdog", "EnableHitchWatchdog")) { return true; }
+
+	watchdog.mThresholdNs = std::max(config.GetInt("Watchdog", "HitchThresholdMs", 100), 1) * NS_PER_MS;
+	watchdog.mLogPath = config.GetString("Watchdog", "HitchLogPath", "hitch_log.txt");
+	watchdog.mMainThreadId = std::this_thread::get_id();
+	watchdog.bStopRequested = false;
+
+	watchdog.WriteLogLine(std::format("[{}] Watchdog started, threshold {} ms",
+		FormatWallClock(std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::system_clock::now().time_since_epoch()).count()), NsToMs(watchdog.mThresholdNs)));
+
+	watchdog.bIsEnabled.store(true, std::memory_order_release);
+	watchdog.mThread = std::thread(&HitchWatchdog::ThreadMain, &watchdog);
+	return true;
+}
+
+void HitchWatchdog::Terminate()
+{
+	if (sInstance) { sInstance->StopThread(); }
+}
+
+bool HitchWatchdog::IsEnabled()
+{
+	return sInstance && sInstance->bIsEnabled.load(std::memory_order_relaxed);
+}
+
+void HitchWatchdog::Heartbeat(const WatchdogChannel channel)
+{
+	if (!IsEnabled()) { return; }
+
+	ChannelState& state = sInstance->mChannels[static_cast<size_t>(channel)];
+	state.lastBeatNs.store(GetSteadyTimeNs(), std::memory_order_relaxed);
+	state.beatCount.fetch_add(1, std::memory_order_release);
+}
+
+const char* HitchWatchdog::EnterPhase(const char* phaseName)
+{
+	if (!IsEnabled() || std::this_thread::get_id() != sInstance->mMainThreadId) { return nullptr; }
+	return sInstance->mCurrentPhase.exchange(phaseName, std::memory_order_relaxed);
+}
+
+void HitchWatchdog::ExitPhase(const char* phaseName, const char* previousPhase, const int64_t startNs)
+{
+	if (!IsEnabled() || std::this_thread::get_id() != sInstance->mMainThreadId) { return; }
+
+	sInstance->mPhaseTimings.Push({phaseName, startNs, GetSteadyTimeNs() - startNs});
+	sInstance->mCurrentPhase.store(previousPhase, std::memory_order_relaxed);
+}
+
+uint64_t HitchWatchdog::GetHitchCount()
+{
+	return sInstance ? sInstance->mHitches.GetTotalPushed() : 0;
+}
+
+size_t HitchWatchdog::GetRecentHitches(WatchdogHitchEvent* outEvents, const size_t maxCount)
+{
+	return sInstance ? sInstance->mHitches.CopyRecent(outEvents, maxCount) : 0;
+}
+
+const char* HitchWatchdog::GetChannelName(const WatchdogChannel channel)
+{
+	switch (channel)
+	{
+		case WatchdogChannel::MainLoop: return "MainLoop";
+		case WatchdogChannel::AudioUpdate: return "AudioUpdate";
+		default: return "Unknown";
+	}
+}
+
+void HitchWatchdog::StopThread()
+{
+	bIsEnabled.store(false, std::memory_order_release);
+
+	if (mThread.joinable())
+	{
+		{
+			std::lock_guard lock(mThreadMutex);
+			bStopRequested = true;
+		}
+		mThreadWakeUp.notify_all();
+		mThread.join();
+	}
+}
+
+void HitchWatchdog::ThreadMain()
+{
+	AllocationTracker::SetThreadName("HitchWatchdog");
+	const auto checkInterval = std::chrono::nanoseconds(std::max(mThresholdNs / 4, MIN_CHECK_INTERVAL_NS));
+
+	std::unique_lock lock(mThreadMutex);
+	while (!mThreadWakeUp.wait_for(lock, checkInterval, [this] { return bStopRequested; }))
+	{
+		lock.unlock();
+		CheckChannels();
+		lock.lock();
+	}
+}
+
+void HitchWatchdog::CheckChannels()
+{
+	const int64_t now = GetSteadyTimeNs();
+
+	for (size_t i = 0; i < CHANNEL_COUNT; ++i)
+	{
+		ChannelState& state = mChannels[i];
+		const auto channel = static_cast<WatchdogChannel>(i);
+
+		const uint64_t beatCount = state.beatCount.load(std::memory_order_acquire);
+		if (beatCount == 0) { continue; } // Not armed until its first heartbeat
+
+		const int64_t lastBeatNs = state.lastBeatNs.load(std::memory_order_relaxed);
+		const int64_t wallClockMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::system_clock::now().time_since_epoch()).count();
+
+		if (state.bInHitch)
+		{
+			if (beatCount != state.hitchBeatCount)
+			{
+				WriteLogLine(std::format("[{}] RESOLVED channel={} total={:.1f} ms",
+					FormatWallClock(wallClockMs), GetChannelName(channel), NsToMs(lastBeatNs - state.hitchStartNs)));
+				state.bInHitch = false;
+			}
+			continue;
+		}
+
+		if (now - lastBeatNs <= mThresholdNs) { continue; }
+
+		WatchdogHitchEvent hitch;
+		hitch.channel = channel;
+		hitch.phase = mCurrentPhase.load(std::memory_order_relaxed);
+		hitch.detectedNs = now;
+		hitch.stalledNs = now - lastBeatNs;
+		hitch.wallClockMs = wallClockMs;
+		hitch.recentPhaseCount = mPhaseTimings.CopyRecent(hitch.recentPhases, WATCHDOG_HITCH_RECENT_PHASES);
+		mHitches.Push(hitch);
+
+		state.bInHitch = true;
+		state.hitchBeatCount = beatCount;
+		state.hitchStartNs = lastBeatNs;
+
+		std::string line = std::format("[{}] HITCH channel={} phase={} stalled={:.1f} ms\n  recent phases:",
+			FormatWallClock(wallClockMs), GetChannelName(channel), hitch.phase ? hitch.phase : "None", NsToMs(hitch.stalledNs));
+		for (size_t p = 0; p < hitch.recentPhaseCount; ++p)
+		{
+			const WatchdogPhaseTiming& timing = hitch.recentPhases[p];
+			line += std::format(" {} {:.2f} ms (-{:.0f} ms);", timing.name, NsToMs(timing.durationNs), NsToMs(now - timing.startNs));
+		}
+		WriteLogLine(line);
+	}
+}
+
+void HitchWatchdog::WriteLogLine(const std::string& line) const
+{
+	std::cout << "Watchdog " << line << std::endl;
+
+	if (mLogPath.empty()) { return; }
+	if (std::ofstream logFile(mLogPath, std::ios::app); logFile.is_open())
+	{
+		logFile << line << '\n';
+	}
+}
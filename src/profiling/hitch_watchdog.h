@@ -0,0 +1,132 @@
+#ifndef HITCH_WATCHDOG_H
+#define HITCH_WATCHDOG_H
+
+#include "history_ring.h"
+#include "steady_time.h"
+
+enum class WatchdogChannel : uint8_t
+{
+	MainLoop,
+	AudioUpdate,
+	Count
+};
+
+struct WatchdogPhaseTiming
+{
+	const char* name = nullptr;
+	int64_t startNs = 0;
+	int64_t durationNs = 0;
+};
+
+constexpr size_t WATCHDOG_HITCH_RECENT_PHASES = 16;
+
+struct WatchdogHitchEvent
+{
+	WatchdogChannel channel = WatchdogChannel::MainLoop;
+	const char* phase = nullptr;
+	int64_t detectedNs = 0;
+	int64_t stalledNs = 0;
+	int64_t wallClockMs = 0;
+	size_t recentPhaseCount = 0;
+	WatchdogPhaseTiming recentPhases[WATCHDOG_HITCH_RECENT_PHASES] = {};
+};
+
+/**
+ * @brief Background thread that flags late heartbeats from the main loop and the audio update
+ * When a channel misses its heartbeat by more than the configured threshold, the watchdog records
+ * the phase the main thread is currently in plus the most recent phase timings, and appends it to the hitch log.
+ * Heartbeat and phase markers are wait-free; all formatting and file I/O happen on the watchdog thread.
+ */
+class HitchWatchdog
+{
+	public:
+		static HitchWatchdog& Get();
+
+		static bool Initialize();
+		static void Terminate();
+		static bool IsEnabled();
+
+		static void Heartbeat(WatchdogChannel channel);
+
+		/** Main thread only, phase names must be string literals */
+		static const char* EnterPhase(const char* phaseName);
+		static void ExitPhase(const char* phaseName, const char* previousPhase, int64_t startNs);
+
+		static uint64_t GetHitchCount();
+		static size_t GetRecentHitches(WatchdogHitchEvent* outEvents, size_t maxCount);
+
+		static const char* GetChannelName(WatchdogChannel channel);
+
+		~HitchWatchdog();
+
+	private:
+		static std::unique_ptr<HitchWatchdog> sInstance;
+
+		static constexpr size_t CHANNEL_COUNT = static_cast<size_t>(WatchdogChannel::Count);
+
+		struct ChannelState
+		{
+			std::atomic<int64_t> lastBeatNs = 0;
+			std::atomic<uint64_t> beatCount = 0;
+			uint64_t hitchBeatCount = 0; // Watchdog thread only
+			int64_t hitchStartNs = 0;    // Watchdog thread only
+			bool bInHitch = false;       // Watchdog thread only
+		};
+
+		std::atomic<bool> bIsEnabled;
+		std::thread::id mMainThreadId;
+		int64_t mThresholdNs;
+		std::string mLogPath;
+
+		std::array<ChannelState, CHANNEL_COUNT> mChannels;
+		std::atomic<const char*> mCurrentPhase;
+		HistoryRing<WatchdogPhaseTiming, 64> mPhaseTimings;
+		HistoryRing<WatchdogHitchEvent, 16> mHitches;
+
+		std::thread mThread;
+		std::mutex mThreadMutex;
+		std::condition_variable mThreadWakeUp;
+		bool bStopRequested;
+
+		HitchWatchdog();
+		void StopThread();
+		void ThreadMain();
+		void CheckChannels();
+		void WriteLogLine(const std::string& line) const;
+};
+
+/**
+ * @brief Marks a named phase of main thread work for the hitch watchdog
+ */
+class WatchdogPhase
+{
+	public:
+		explicit WatchdogPhase(const char* phaseName)
+		: mPhaseName(phaseName)
+		, mPreviousPhase(nullptr)
+		, mStartNs(0)
+		{
+			if (HitchWatchdog::IsEnabled())
+			{
+				mStartNs = GetSteadyTimeNs();
+				mPreviousPhase = HitchWatchdog::EnterPhase(phaseName);
+			}
+		}
+
+		~WatchdogPhase()
+		{
+			if (mStartNs != 0)
+			{
+				HitchWatchdog::ExitPhase(mPhaseName, mPreviousPhase, mStartNs);
+			}
+		}
+
+		WatchdogPhase(const WatchdogPhase&) = delete;
+		WatchdogPhase& operator=(const WatchdogPhase&) = delete;
+
+	private:
+		const char* mPhaseName;
+		const char* mPreviousPhase;
+		int64_t mStartNs;
+};
+#endif
@@ -0,0 +1,87 @@
+#include "lock_profiler.h"
+
+#include "audio/audio_config.h"
+
+std::unique_ptr<LockProfiler> LockProfiler::sInstance(nullptr);
+
+LockProfiler::LockProfiler()
+: bIsEnabled(false)
+{}
+
+LockProfiler& LockProfiler::Get()
+{
+	if (!sInstance)
+	{
+		sInstance = std::unique_ptr<LockProfiler>(new LockProfiler());
+	}
+	return *sInstance;
+}
+
+bool LockProfiler::Initialize()
+{
+	const AudioConfig& config = AudioConfig::Get();
+	if (!config.IsLoaded()) { return false; }
+
+	Get().bIsEnabled.store(config.GetBool("Profiling", "EnableLockProfiling"), std::memory_order_relaxed);
+	return true;
+}
+
+void LockProfiler::Terminate()
+{
+	if (IsEnabled())
+	{
+		DumpStats(std::cout);
+		sInstance->bIsEnabled.store(false, std::memory_order_relaxed);
+	}
+}
+
+bool LockProfiler::IsEnabled()
+{
+	return sInstance && sInstance->bIsEnabled.load(std::memory_order_relaxed);
+}
+
+LockStats* LockProfiler::GetOrCreateStats(const char* name)
+{
+	LockProfiler& lockProfiler = Get();
+
+	const auto it = std::ranges::find(lockProfiler.mStats, std::string_view(name), &LockStats::name);
+	if (it != lockProfiler.mStats.end()) { return it->get(); }
+
+	auto& stats = lockProfiler.mStats.emplace_back(std::make_unique<LockStats>());
+	stats->name = name;
+	return stats.get();
+}
+
+void LockProfiler::GetAllStats(std::vector<const LockStats*>& outStats)
+{
+	outStats.clear();
+	for (const auto& stats : Get().mStats)
+	{
+		outStats.push_back(stats.get());
+	}
+	std::ranges::sort(outStats, {}, &LockStats::name);
+}
+
+void LockProfiler::DumpStats(std::ostream& stream)
+{
+	std::vector<const LockStats*> allStats;
+	GetAllStats(allStats);
+
+	stream << "Lock contention (us)" << std::endl;
+	for (const LockStats* stats : allStats)
+	{
+		const uint64_t acquisitions = stats->acquisitions.load(std::memory_order_relaxed);
+		const uint64_t contended = stats->contendedAcquisitions.load(std::memory_order_relaxed);
+		stream << std::format("  {}: acquisitions={} contended={} ({:.2f}%)\n"
+			"    wait: p50={:.1f} p99={:.1f} max={:.1f}\n"
+			"    hold: p50={:.1f} p99={:.1f} max={:.1f}",
+			stats->name, acquisitions, contended,
+			acquisitions > 0 ? 100.0 * static_cast<double>(contended) / static_cast<double>(acquisitions) : 0.0,
+			static_cast<double>(stats->waitNs.GetPercentile(50)) * 0.001,
+			static_cast<double>(stats->waitNs.GetPercentile(99)) * 0.001,
+			static_cast<double>(stats->waitNs.GetMax()) * 0.001,
+			static_cast<double>(stats->holdNs.GetPercentile(50)) * 0.001,
+			static_cast<double>(stats->holdNs.GetPercentile(99)) * 0.001,
+			static_cast<double>(stats->holdNs.GetMax()) * 0.001) << std::endl;
+	}
+}
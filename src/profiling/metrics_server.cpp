@@ -0,0 +1,338 @@
+#include "metrics_server.h"
+
+#include "audio/audio_config.h"
+#include "audio/audio_engine.h"
+#include "frame_profiler.h"
+#include "hitch_watchdog.h"
+
+#ifdef WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+std::unique_ptr<MetricsServer> MetricsServer::sInstance(nullptr);
+
+namespace
+{
+#ifdef WIN32
+	using SocketHandle = SOCKET;
+	void CloseSocket(const SocketHandle socketHandle) { closesocket(socketHandle); }
+	int PollSocket(pollfd* pollDescriptor, const int timeoutMs) { return WSAPoll(pollDescriptor, 1, timeoutMs); }
+#else
+	using SocketHandle = int;
+	void CloseSocket(const SocketHandle socketHandle) { close(socketHandle); }
+	int PollSocket(pollfd* pollDescriptor, const int timeoutMs) { return poll(pollDescriptor, 1, timeoutMs); }
+#endif
+
+	constexpr intptr_t INVALID_SOCKET_HANDLE = -1;
+	constexpr int ACCEPT_POLL_TIMEOUT_MS = 250;
+	constexpr int CLIENT_TIMEOUT_MS = 1000;
+	constexpr size_t MAX_REQUEST_SIZE = 4096;
+
+	constexpr auto CONTENT_TYPE_METRICS = "text/plain; version=0.0.4; charset=utf-8";
+	constexpr auto CONTENT_TYPE_TEXT = "text/plain; charset=utf-8";
+
+	std::string EscapeLabelValue(const std::string_view value)
+	{
+		std::string escaped;
+		escaped.reserve(value.size());
+		for (const char character : value)
+		{
+			switch (character)
+			{
+				case '\\': escaped += "\\\\"; break;
+				case '"': escaped += "\\\""; break;
+				case '\n': escaped += "\\n"; break;
+				default: escaped += character; break;
+			}
+		}
+		return escaped;
+	}
+
+	void AppendHeader(std::string& out, const char* name, const char* type, const char* help)
+	{
+		std::format_to(std::back_inserter(out), "# HELP {} {}\n# TYPE {} {}\n", name, help, name, type);
+	}
+
+	void AppendBufferUsage(std::string& out, const char* buffer, const FMOD_STUDIO_BUFFER_INFO& info)
+	{
+		std::format_to(std::back_inserter(out),
+			"fmodcmake_audio_buffer_usage{{buffer=\"{0}\",kind=\"current\"}} {1}\n"
+			"fmodcmake_audio_buffer_usage{{buffer=\"{0}\",kind=\"peak\"}} {2}\n"
+			"fmodcmake_audio_buffer_usage{{buffer=\"{0}\",kind=\"capacity\"}} {3}\n",
+			buffer, info.currentusage, info.peakusage, info.capacity);
+	}
+
+	void SendAll(const SocketHandle socketHandle, const std::string_view data)
+	{
+		size_t sent = 0;
+		while (sent < data.size())
+		{
+			const auto result = send(socketHandle, data.data() + sent, static_cast<int>(data.size() - sent), 0);
+			if (result <= 0) { return; }
+			sent += static_cast<size_t>(result);
+		}
+	}
+
+	void SendResponse(const SocketHandle socketHandle, const char* status, const char* contentType, const std::string_view body)
+	{
+		SendAll(socketHandle, std::format("HTTP/1.1 {}\r\nContent-Type: {}\r\nContent-Length: {}\r\nConnection: close\r\n\r\n",
+			status, contentType, body.size()));
+		SendAll(socketHandle, body);
+	}
+}
+
+MetricsServer::MetricsServer()
+: bStopRequested(false)
+, mListenSocket(INVALID_SOCKET_HANDLE)
+, mPort(0)
+{}
+
+MetricsServer::~MetricsServer()
+{
+	StopThread();
+}
+
+MetricsServer& MetricsServer::Get()
+{
+	if (!sInstance)
+	{
+		sInstance = std::unique_ptr<MetricsServer>(new MetricsServer());
+	}
+	return *sInstance;
+}
+
+bool MetricsServer::Initialize()
+{
+	MetricsServer& metricsServer = Get();
+	if (metricsServer.mThread.joinable()) { return true; } // Already Initialized
+
+	const AudioConfig& config = AudioConfig::Get();
+	if (!config.IsLoaded()) { return false; }
+	if (!config.GetBool("Metrics", "EnableMetricsServer")) { return true; }
+
+	metricsServer.mPort = config.GetInt("Metrics", "MetricsPort", 9464);
+
+#ifdef WIN32
+	WSADATA wsaData;
+	if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) { return false; }
+#endif
+
+	const SocketHandle listenSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (static_cast<intptr_t>(listenSocket) == INVALID_SOCKET_HANDLE) { return false; }
+
+	constexpr int reuseAddress = 1;
+	setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&reuseAddress), sizeof(reuseAddress));
+
+	sockaddr_in address {};
+	address.sin_family = AF_INET;
+	address.sin_port = htons(static_cast<uint16_t>(metricsServer.mPort));
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK); // Never exposed beyond localhost
+
+	if (bind(listenSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0
+		|| listen(listenSocket, 8) != 0)
+	{
+		std::cout << "Metrics: cannot listen on 127.0.0.1:" << metricsServer.mPort << std::endl;
+		CloseSocket(listenSocket);
+		return false;
+	}
+
+	metricsServer.mListenSocket = static_cast<intptr_t>(listenSocket);
+	metricsServer.bStopRequested.store(false, std::memory_order_relaxed);
+	metricsServer.mThread = std::thread(&MetricsServer::ThreadMain, &metricsServer);
+
+	std::cout << "Metrics: serving http://127.0.0.1:" << metricsServer.mPort << "/metrics" << std::endl;
+	return true;
+}
+
+void MetricsServer::Terminate()
+{
+	if (sInstance) { sInstance->StopThread(); }
+}
+
+bool MetricsServer::IsEnabled()
+{
+	return sInstance && sInstance->mThread.joinable();
+}
+
+void MetricsServer::StopThread()
+{
+	if (!mThread.joinable()) { return; }
+
+	bStopRequested.store(true, std::memory_order_relaxed);
+	mThread.join();
+
+	CloseSocket(static_cast<SocketHandle>(mListenSocket));
+	mListenSocket = INVALID_SOCKET_HANDLE;
+#ifdef WIN32
+	WSACleanup();
+#endif
+}
+
+void MetricsServer::ThreadMain() const
+{
+	const auto listenSocket = static_cast<SocketHandle>(mListenSocket);
+
+	while (!bStopRequested.load(std::memory_order_relaxed))
+	{
+		pollfd pollDescriptor {};
+		pollDescriptor.fd = listenSocket;
+		pollDescriptor.events = POLLIN;
+		if (PollSocket(&pollDescriptor, ACCEPT_POLL_TIMEOUT_MS) <= 0 || !(pollDescriptor.revents & POLLIN)) { continue; }
+
+		const SocketHandle clientSocket = accept(listenSocket, nullptr, nullptr);
+		if (static_cast<intptr_t>(clientSocket) == INVALID_SOCKET_HANDLE) { continue; }
+
+		HandleConnection(static_cast<intptr_t>(clientSocket));
+		CloseSocket(clientSocket);
+	}
+}
+
+void MetricsServer::HandleConnection(const intptr_t clientSocket) const
+{
+	const auto socketHandle = static_cast<SocketHandle>(clientSocket);
+
+	std::string request;
+	std::array<char, 1024> buffer {};
+	while (request.find("\r\n\r\n") == std::string::npos && request.size() < MAX_REQUEST_SIZE)
+	{
+		pollfd pollDescriptor {};
+		pollDescriptor.fd = socketHandle;
+		pollDescriptor.events = POLLIN;
+		if (PollSocket(&pollDescriptor, CLIENT_TIMEOUT_MS) <= 0) { return; }
+
+		const auto received = recv(socketHandle, buffer.data(), static_cast<int>(buffer.size()), 0);
+		if (received <= 0) { return; }
+		request.append(buffer.data(), static_cast<size_t>(received));
+	}
+
+	const std::string_view requestLine = std::string_view(request).substr(0, request.find("\r\n"));
+	if (requestLine.starts_with("GET /metrics ") || requestLine.starts_with("GET /metrics?"))
+	{
+		std::string body;
+		BuildMetrics(body);
+		SendResponse(socketHandle, "200 OK", CONTENT_TYPE_METRICS, body);
+	}
+	else if (requestLine.starts_with("GET "))
+	{
+		SendResponse(socketHandle, "404 Not Found", CONTENT_TYPE_TEXT, "Only /metrics is served\n");
+	}
+	else
+	{
+		SendResponse(socketHandle, "405 Method Not Allowed", CONTENT_TYPE_TEXT, "Only GET is supported\n");
+	}
+}
+
+void MetricsServer::BuildMetrics(std::string& outBody)
+{
+	outBody.clear();
+	auto out = std::back_inserter(outBody);
+
+	// Application
+	if (FrameTimingStats frameStats; FrameProfiler::GetStats(frameStats))
+	{
+		AppendHeader(outBody, "fmodcmake_frames_total", "counter", "Frames rendered by the main loop");
+		std::format_to(out, "fmodcmake_frames_total {}\n", frameStats.frameIndex);
+
+		AppendHeader(outBody, "fmodcmake_frame_time_last_seconds", "gauge", "Duration of the last frame");
+		std::format_to(out, "fmodcmake_frame_time_last_seconds {:.6f}\n", static_cast<double>(frameStats.lastFrameNs) * 1e-9);
+	}
+
+	if (const HdrHistogram* frameTimes = FrameProfiler::GetFrameTimeHistogram())
+	{
+		AppendHeader(outBody, "fmodcmake_frame_time_seconds", "summary", "Frame time distribution since start");
+		for (const double quantile : {0.5, 0.9, 0.99, 0.999})
+		{
+			std::format_to(out, "fmodcmake_frame_time_seconds{{quantile=\"{}\"}} {:.6f}\n",
+				quantile, static_cast<double>(frameTimes->GetPercentile(quantile * 100.0)) * 1e-9);
+		}
+		const uint64_t count = frameTimes->GetCount();
+		std::format_to(out, "fmodcmake_frame_time_seconds_sum {:.6f}\nfmodcmake_frame_time_seconds_count {}\n",
+			frameTimes->GetMean() * static_cast<double>(count) * 1e-9, count);
+	}
+
+	if (HitchWatchdog::IsEnabled())
+	{
+		AppendHeader(outBody, "fmodcmake_hitches_total", "counter", "Stalls detected by the hitch watchdog");
+		std::format_to(out, "fmodcmake_hitches_total {}\n", HitchWatchdog::GetHitchCount());
+	}
+
+	// Audio Engine
+	AudioEngineStats audioStats;
+	if (!AudioEngine::GetStatsSnapshot(audioStats)) { return; }
+
+	AppendHeader(outBody, "fmodcmake_audio_updates_total", "counter", "AudioEngine::Update calls");
+	std::format_to(out, "fmodcmake_audio_updates_total {}\n", audioStats.updateIndex);
+
+	AppendHeader(outBody, "fmodcmake_audio_events_played_total", "counter", "Event instances created by PlayAudioEvent");
+	std::format_to(out, "fmodcmake_audio_events_played_total {}\n", audioStats.eventsPlayed);
+
+	AppendHeader(outBody, "fmodcmake_audio_events_played_per_second", "gauge", "Events played over the last second");
+	std::format_to(out, "fmodcmake_audio_events_played_per_second {:.2f}\n", audioStats.eventsPlayedPerSecond);
+
+	AppendHeader(outBody, "fmodcmake_audio_instances_active", "gauge", "Live event instances created by PlayAudioEvent");
+	std::format_to(out, "fmodcmake_audio_instances_active {}\n", audioStats.activeInstances);
+
+	AppendHeader(outBody, "fmodcmake_audio_channels_playing", "gauge", "Playing FMOD channels");
+	std::format_to(out, "fmodcmake_audio_channels_playing{{kind=\"total\"}} {}\nfmodcmake_audio_channels_playing{{kind=\"real\"}} {}\n",
+		audioStats.channelsPlaying, audioStats.realChannelsPlaying);
+
+	AppendHeader(outBody, "fmodcmake_audio_cpu_percent", "gauge", "FMOD CPU usage per component");
+	std::format_to(out,
+		"fmodcmake_audio_cpu_percent{{component=\"dsp\"}} {:.3f}\n"
+		"fmodcmake_audio_cpu_percent{{component=\"stream\"}} {:.3f}\n"
+		"fmodcmake_audio_cpu_percent{{component=\"geometry\"}} {:.3f}\n"
+		"fmodcmake_audio_cpu_percent{{component=\"update\"}} {:.3f}\n"
+		"fmodcmake_audio_cpu_percent{{component=\"convolution1\"}} {:.3f}\n"
+		"fmodcmake_audio_cpu_percent{{component=\"convolution2\"}} {:.3f}\n"
+		"fmodcmake_audio_cpu_percent{{component=\"studio_update\"}} {:.3f}\n",
+		audioStats.coreCPU.dsp, audioStats.coreCPU.stream, audioStats.coreCPU.geometry, audioStats.coreCPU.update,
+		audioStats.coreCPU.convolution1, audioStats.coreCPU.convolution2, audioStats.studioCPU.update);
+
+	AppendHeader(outBody, "fmodcmake_audio_memory_bytes", "gauge", "FMOD memory allocated");
+	std::format_to(out, "fmodcmake_audio_memory_bytes{{kind=\"current\"}} {}\nfmodcmake_audio_memory_bytes{{kind=\"max\"}} {}\n",
+		audioStats.memoryCurrentBytes, audioStats.memoryMaxBytes);
+
+	AppendHeader(outBody, "fmodcmake_audio_buffer_usage", "gauge", "FMOD Studio command queue and handle buffer usage");
+	AppendBufferUsage(outBody, "command_queue", audioStats.bufferUsage.studiocommandqueue);
+	AppendBufferUsage(outBody, "handle", audioStats.bufferUsage.studiohandle);
+
+	AppendHeader(outBody, "fmodcmake_audio_buffer_stalls_total", "counter", "Stalls waiting for FMOD Studio buffer space");
+	std::format_to(out, "fmodcmake_audio_buffer_stalls_total{{buffer=\"command_queue\"}} {}\nfmodcmake_audio_buffer_stalls_total{{buffer=\"handle\"}} {}\n",
+		audioStats.bufferUsage.studiocommandqueue.stallcount, audioStats.bufferUsage.studiohandle.stallcount);
+
+	AppendHeader(outBody, "fmodcmake_audio_studio_update_seconds", "gauge", "FMOD Studio async update duration and interval");
+	std::format_to(out,
+		"fmodcmake_audio_studio_update_seconds{{kind=\"last\"}} {:.6f}\n"
+		"fmodcmake_audio_studio_update_seconds{{kind=\"p99\"}} {:.6f}\n"
+		"fmodcmake_audio_studio_update_seconds{{kind=\"interval\"}} {:.6f}\n"
+		"fmodcmake_audio_studio_update_seconds{{kind=\"submit_period\"}} {:.6f}\n",
+		static_cast<double>(audioStats.studioUpdateMs) * 1e-3, static_cast<double>(audioStats.studioUpdateP99Ms) * 1e-3,
+		static_cast<double>(audioStats.studioUpdateIntervalMs) * 1e-3, static_cast<double>(audioStats.effectiveUpdatePeriodMs) * 1e-3);
+
+	AppendHeader(outBody, "fmodcmake_audio_studio_submit_cost_percent", "gauge", "Main thread share spent in Studio::System::update");
+	std::format_to(out, "fmodcmake_audio_studio_submit_cost_percent {:.3f}\n", audioStats.updateSubmitCostPercent);
+
+	AppendHeader(outBody, "fmodcmake_audio_studio_updates_skipped_total", "counter", "Studio::System::update calls skipped by the adaptive update period");
+	std::format_to(out, "fmodcmake_audio_studio_updates_skipped_total {}\n", audioStats.skippedUpdates);
+
+	AppendHeader(outBody, "fmodcmake_audio_bank_load_seconds", "gauge", "Blocking load time of each loaded bank");
+	for (int i = 0; i < std::min(audioStats.bankCount, AUDIO_STATS_MAX_BANKS); ++i)
+	{
+		std::format_to(out, "fmodcmake_audio_bank_load_seconds{{bank=\"{}\"}} {:.6f}\n",
+			EscapeLabelValue(audioStats.banks[i].path), static_cast<double>(audioStats.banks[i].loadTimeMs) * 1e-3);
+	}
+
+	AppendHeader(outBody, "fmodcmake_audio_bank_loaded", "gauge", "1 if the bank metadata is loaded");
+	for (int i = 0; i < std::min(audioStats.bankCount, AUDIO_STATS_MAX_BANKS); ++i)
+	{
+		std::format_to(out, "fmodcmake_audio_bank_loaded{{bank=\"{}\"}} {}\n",
+			EscapeLabelValue(audioStats.banks[i].path), audioStats.banks[i].loadingState == FMOD_STUDIO_LOADING_STATE_LOADED ? 1 : 0);
+	}
+}
@@ -0,0 +1,37 @@
+#ifndef METRICS_SERVER_H
+#define METRICS_SERVER_H
+
+/**
+ * @brief Opt-in HTTP listener on 127.0.0.1 serving GET /metrics in the Prometheus text exposition format
+ * Enabled by [Metrics] EnableMetricsServer, port from [Metrics] MetricsPort.
+ * Runs on its own thread and only reads lock-free snapshots (AudioEngine stats, FrameProfiler, HitchWatchdog),
+ * so a scrape never waits on the render or audio paths.
+ * Refer to: https://prometheus.io/docs/instrumenting/exposition_formats/
+ */
+class MetricsServer
+{
+	public:
+		static MetricsServer& Get();
+
+		static bool Initialize();
+		static void Terminate();
+		static bool IsEnabled();
+
+		static void BuildMetrics(std::string& outBody);
+
+		~MetricsServer();
+
+	private:
+		static std::unique_ptr<MetricsServer> sInstance;
+
+		std::thread mThread;
+		std::atomic<bool> bStopRequested;
+		intptr_t mListenSocket;
+		int mPort;
+
+		MetricsServer();
+		void StopThread();
+		void ThreadMain() const;
+		void HandleConnection(intptr_t clientSocket) const;
+};
+#endif
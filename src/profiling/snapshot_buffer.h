@@ -0,0 +1,49 @@
+#ifndef SNAPSHOT_BUFFER_H
+#define SNAPSHOT_BUFFER_H
+
+/**
+ * @brief Single-writer, multi-reader double buffer for small trivially copyable snapshots
+ * The writer fills the slot readers are not pointed at and then flips the sequence number.
+ * Readers copy the current slot and retry if the writer published again while they were copying,
+ * so neither side ever blocks. Meant for data published a few hundred times per second at most.
+ */
+template <typename T>
+	requires std::is_trivially_copyable_v<T>
+class SnapshotBuffer
+{
+	public:
+		SnapshotBuffer() = default;
+		SnapshotBuffer(const SnapshotBuffer&) = delete;
+		SnapshotBuffer& operator=(const SnapshotBuffer&) = delete;
+
+		// Writer thread only
+		void Publish(const T& value)
+		{
+			const uint64_t sequence = mSequence.load(std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			mBuffers[(sequence + 1) & 1] = value;
+			mSequence.store(sequence + 1, std::memory_order_release);
+		}
+
+		// Any thread. Returns false if nothing has been published yet.
+		bool Read(T& outValue) const
+		{
+			while (true)
+			{
+				const uint64_t sequence = mSequence.load(std::memory_order_acquire);
+				if (sequence == 0) { return false; }
+
+				outValue = mBuffers[sequence & 1];
+				std::atomic_thread_fence(std::memory_order_acquire);
+
+				if (mSequence.load(std::memory_order_relaxed) == sequence) { return true; }
+			}
+		}
+
+		[[nodiscard]] uint64_t GetSequence() const { return mSequence.load(std::memory_order_acquire); }
+
+	private:
+		std::array<T, 2> mBuffers{};
+		std::atomic<uint64_t> mSequence = 0;
+};
+#endif
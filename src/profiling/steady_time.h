@@ -0,0 +1,10 @@
+#ifndef STEADY_TIME_H
+#define STEADY_TIME_H
+
+/** Monotonic wall-clock time in nanoseconds, the common time base of the profilers, traces and benchmarks */
+inline int64_t GetSteadyTimeNs()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#endif
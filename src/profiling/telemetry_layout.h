@@ -0,0 +1,112 @@
+#ifndef TELEMETRY_LAYOUT_H
+#define TELEMETRY_LAYOUT_H
+
+/*
+ * Shared-memory telemetry segment, written by TelemetryWriter and read by tools/telemetry_reader.cpp.
+ * Shared with the reader, so this header only uses fixed-size types and must stay free of FMOD and raylib.
+ * Bump TELEMETRY_LAYOUT_VERSION whenever TelemetryPayload changes; readers reject other versions.
+ *
+ * Seqlock protocol: the writer makes sequence odd, copies the payload and makes it even again.
+ * A reader copies the payload between two even, equal sequence loads, otherwise it retries.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+constexpr uint32_t TELEMETRY_MAGIC = 0x544D4646; // "FFMT"
+constexpr uint32_t TELEMETRY_LAYOUT_VERSION = 1;
+constexpr const char* TELEMETRY_DEFAULT_SHARED_MEMORY_NAME = "/fmod_cmake_telemetry";
+
+constexpr int TELEMETRY_MAX_BANKS = 16;
+constexpr int TELEMETRY_MAX_PATH = 64;
+
+// Matches FMOD_STUDIO_LOADING_STATE
+enum TelemetryLoadingState : int32_t
+{
+	TELEMETRY_LOADING_STATE_UNLOADING,
+	TELEMETRY_LOADING_STATE_UNLOADED,
+	TELEMETRY_LOADING_STATE_LOADING,
+	TELEMETRY_LOADING_STATE_LOADED,
+	TELEMETRY_LOADING_STATE_ERROR,
+};
+
+struct TelemetryBank
+{
+	char path[TELEMETRY_MAX_PATH];
+	int32_t loadingState;
+	int32_t sampleLoadingState;
+	float loadTimeMs;
+	uint32_t padding;
+};
+
+struct TelemetryPayload
+{
+	int64_t timestampNs;        // steady_clock of the writer
+	uint64_t frameIndex;
+	float frameTimeMs;
+	float frameTimeAverageMs;
+	float frameTimeMaxMs;       // Worst frame of the last one-second window
+
+	// FMOD CPU usage, percent
+	float cpuDSP;
+	float cpuStream;
+	float cpuGeometry;
+	float cpuUpdate;
+	float cpuConvolution1;
+	float cpuConvolution2;
+	float cpuStudioUpdate;
+
+	int32_t memoryCurrentBytes;
+	int32_t memoryMaxBytes;
+	int32_t channelsPlaying;
+	int32_t realChannelsPlaying;
+	uint64_t activeInstances;
+	uint64_t eventsPlayed;
+	uint64_t audioUpdateIndex;
+
+	int32_t bankCount;
+	uint32_t padding;
+	TelemetryBank banks[TELEMETRY_MAX_BANKS];
+};
+
+struct TelemetrySegment
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t segmentSize;
+	uint32_t writerProcessId;
+	std::atomic<uint64_t> sequence;
+	TelemetryPayload payload;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "The seqlock sequence must be address-free across processes");
+static_assert(std::is_trivially_copyable_v<TelemetryPayload>);
+
+// Reader side. Returns false if the writer kept publishing for all attempts.
+inline bool TelemetryReadPayload(const TelemetrySegment& segment, TelemetryPayload& outPayload, const int maxAttempts = 64)
+{
+	for (int attempt = 0; attempt < maxAttempts; ++attempt)
+	{
+		const uint64_t sequenceBefore = segment.sequence.load(std::memory_order_acquire);
+		if (sequenceBefore & 1) { continue; }
+
+		std::memcpy(&outPayload, &segment.payload, sizeof(TelemetryPayload));
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		if (segment.sequence.load(std::memory_order_relaxed) == sequenceBefore) { return true; }
+	}
+	return false;
+}
+
+// Writer side, single writer only
+inline void TelemetryWritePayload(TelemetrySegment& segment, const TelemetryPayload& payload)
+{
+	const uint64_t sequence = segment.sequence.load(std::memory_order_relaxed);
+	segment.sequence.store(sequence + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	std::memcpy(&segment.payload, &payload, sizeof(TelemetryPayload));
+	segment.sequence.store(sequence + 2, std::memory_order_release);
+}
+#endif
@@ -0,0 +1,153 @@
+#include "telemetry_writer.h"
+
+#include "audio/audio_config.h"
+#include "audio/audio_engine.h"
+#include "frame_profiler.h"
+#include "steady_time.h"
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+std::unique_ptr<TelemetryWriter> TelemetryWriter::sInstance(nullptr);
+
+namespace
+{
+	float NsToMs(const int64_t ns)
+	{
+		return static_cast<float>(static_cast<double>(ns) * 1e-6);
+	}
+}
+
+TelemetryWriter::TelemetryWriter()
+: mSegment(nullptr)
+{}
+
+TelemetryWriter::~TelemetryWriter()
+{
+	CloseSegment();
+}
+
+TelemetryWriter& TelemetryWriter::Get()
+{
+	if (!sInstance)
+	{
+		sInstance = std::unique_ptr<TelemetryWriter>(new TelemetryWriter());
+	}
+	return *sInstance;
+}
+
+bool TelemetryWriter::Initialize()
+{
+	TelemetryWriter& telemetryWriter = Get();
+	if (telemetryWriter.mSegment) { return true; } // Already Initialized
+
+	const AudioConfig& config = AudioConfig::Get();
+	if (!config.IsLoaded()) { return false; }
+	if (!config.GetBool("Telemetry", "EnableSharedMemory")) { return true; }
+
+#ifdef WIN32
+	std::cout << "Telemetry: shared-memory export is only available on POSIX platforms" << std::endl;
+	return true;
+#else
+	telemetryWriter.mSharedMemoryName = config.GetString("Telemetry", "SharedMemoryName", TELEMETRY_DEFAULT_SHARED_MEMORY_NAME);
+
+	const int fileDescriptor = shm_open(telemetryWriter.mSharedMemoryName.c_str(), O_CREAT | O_RDWR, 0600);
+	if (fileDescriptor < 0) { return false; }
+
+	if (ftruncate(fileDescriptor, sizeof(TelemetrySegment)) != 0)
+	{
+		close(fileDescriptor);
+		return false;
+	}
+
+	void* memory = mmap(nullptr, sizeof(TelemetrySegment), PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+	close(fileDescriptor);
+	if (memory == MAP_FAILED) { return false; }
+
+	// A previous run may have left the segment behind, start from a clean, unpublished state
+	std::memset(memory, 0, sizeof(TelemetrySegment));
+	auto* segment = static_cast<TelemetrySegment*>(memory);
+	segment->version = TELEMETRY_LAYOUT_VERSION;
+	segment->segmentSize = sizeof(TelemetrySegment);
+	segment->writerProcessId = static_cast<uint32_t>(getpid());
+	std::atomic_thread_fence(std::memory_order_release);
+	segment->magic = TELEMETRY_MAGIC;
+
+	telemetryWriter.mSegment = segment;
+	std::cout << "Telemetry: publishing to shared memory " << telemetryWriter.mSharedMemoryName << std::endl;
+	return true;
+#endif
+}
+
+void TelemetryWriter::Terminate()
+{
+	if (sInstance) { sInstance->CloseSegment(); }
+}
+
+bool TelemetryWriter::IsEnabled()
+{
+	return sInstance && sInstance->mSegment;
+}
+
+void TelemetryWriter::Publish()
+{
+	if (!IsEnabled()) { return; }
+
+	TelemetryPayload payload {};
+	payload.timestampNs = GetSteadyTimeNs();
+
+	if (FrameTimingStats frameStats; FrameProfiler::GetStats(frameStats))
+	{
+		payload.frameIndex = frameStats.frameIndex;
+		payload.frameTimeMs = NsToMs(frameStats.lastFrameNs);
+		payload.frameTimeAverageMs = NsToMs(frameStats.averageFrameNs);
+		payload.frameTimeMaxMs = NsToMs(frameStats.maxFrameNs);
+	}
+
+	if (AudioEngineStats audioStats; AudioEngine::GetStatsSnapshot(audioStats))
+	{
+		payload.cpuDSP = audioStats.coreCPU.dsp;
+		payload.cpuStream = audioStats.coreCPU.stream;
+		payload.cpuGeometry = audioStats.coreCPU.geometry;
+		payload.cpuUpdate = audioStats.coreCPU.update;
+		payload.cpuConvolution1 = audioStats.coreCPU.convolution1;
+		payload.cpuConvolution2 = audioStats.coreCPU.convolution2;
+		payload.cpuStudioUpdate = audioStats.studioCPU.update;
+
+		payload.memoryCurrentBytes = audioStats.memoryCurrentBytes;
+		payload.memoryMaxBytes = audioStats.memoryMaxBytes;
+		payload.channelsPlaying = audioStats.channelsPlaying;
+		payload.realChannelsPlaying = audioStats.realChannelsPlaying;
+		payload.activeInstances = audioStats.activeInstances;
+		payload.eventsPlayed = audioStats.eventsPlayed;
+		payload.audioUpdateIndex = audioStats.updateIndex;
+
+		payload.bankCount = std::min(audioStats.bankCount, TELEMETRY_MAX_BANKS);
+		for (int i = 0; i < payload.bankCount; ++i)
+		{
+			const AudioBankStats& bankStats = audioStats.banks[i];
+			TelemetryBank& bank = payload.banks[i];
+			std::memcpy(bank.path, bankStats.path, std::min(sizeof(bank.path), sizeof(bankStats.path)));
+			bank.path[TELEMETRY_MAX_PATH - 1] = '\0';
+			bank.loadingState = bankStats.loadingState;
+			bank.sampleLoadingState = bankStats.sampleLoadingState;
+			bank.loadTimeMs = bankStats.loadTimeMs;
+		}
+	}
+
+	TelemetryWritePayload(*sInstance->mSegment, payload);
+}
+
+void TelemetryWriter::CloseSegment()
+{
+#ifndef WIN32
+	if (!mSegment) { return; }
+
+	munmap(mSegment, sizeof(TelemetrySegment));
+	shm_unlink(mSharedMemoryName.c_str());
+	mSegment = nullptr;
+#endif
+}
@@ -0,0 +1,34 @@
+#ifndef TELEMETRY_WRITER_H
+#define TELEMETRY_WRITER_H
+
+#include "telemetry_layout.h"
+
+/**
+ * @brief Publishes frame, FMOD CPU/memory, voice and bank stats into a POSIX shared-memory segment
+ * Enabled by [Telemetry] EnableSharedMemory. Publish only copies already gathered snapshots into the
+ * segment under a seqlock, so out-of-process readers (tools/telemetry_reader.cpp) never block the app.
+ */
+class TelemetryWriter
+{
+	public:
+		static TelemetryWriter& Get();
+
+		static bool Initialize();
+		static void Terminate();
+		static bool IsEnabled();
+
+		/** Main thread only, once per frame */
+		static void Publish();
+
+		~TelemetryWriter();
+
+	private:
+		static std::unique_ptr<TelemetryWriter> sInstance;
+
+		TelemetrySegment* mSegment;
+		std::string mSharedMemoryName;
+
+		TelemetryWriter();
+		void CloseSegment();
+};
+#endif
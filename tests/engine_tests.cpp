@@ -0,0 +1,291 @@
+/*
+ * Engine Tests
+ * Checks the engine against the fake FMOD backend (libs/fmod_fake), headless: the instance tracker pool, owner budget
+ * accounting through AudioEngine (bank load, unload and failed unload, live instances), the journal ring and names,
+ * and the logger ring (drops and rate limiting). Prints every failed check and exits with a failure code if any failed.
+ *
+ * Usage: FmodCmakeTests (from the build directory, config/ and assets/ are copied next to the executable)
+ */
+
+#include "bench_harness.h"
+
+#include "audio/audio_engine.h"
+#include "audio/audio_instance_tracker.h"
+#include "audio/audio_journal.h"
+#include "audio/audio_logger.h"
+
+namespace
+{
+	constexpr auto TEST_EVENT = "event:/MusicTest";
+	constexpr auto TEST_OWNER = "Cover"; // [Budget.Cover] MaxBanks=2
+	constexpr std::array<const char*, 3> TEST_BANKS = { "Music.bank", "ProgrammerSounds_Basic.bank", "ProgrammerSounds_Localized_en.bank" };
+
+	// FNV-1a collision, both names hash to 1582148253
+	constexpr auto COLLIDING_NAME_A = "costarring";
+	constexpr auto COLLIDING_NAME_B = "liquid";
+
+	int sCheckCount = 0;
+	int sFailedCount = 0;
+
+	void Check(const bool bPassed, const char* expression, const char* file, const int line)
+	{
+		++sCheckCount;
+		if (bPassed) { return; }
+
+		++sFailedCount;
+		std::cerr << std::format("FAILED {}:{}: {}", file, line, expression) << std::endl;
+	}
+
+#define CHECK(expression) Check(static_cast<bool>(expression), #expression, __FILE__, __LINE__)
+
+	void TestInstanceTrackerPool()
+	{
+		AudioInstanceTracker tracker(2);
+		CHECK(tracker.GetCapacity() == 2);
+
+		TrackedAudioInstance* first = tracker.Acquire();
+		TrackedAudioInstance* second = tracker.Acquire();
+		CHECK(first && second && first != second);
+		CHECK(tracker.Owns(first) && tracker.Owns(second));
+		CHECK(tracker.GetActiveCount() == 2);
+
+		// Full: the caller plays the event untracked
+		CHECK(tracker.Acquire() == nullptr);
+		CHECK(tracker.GetDroppedCount() == 1);
+
+		int inUseCount = 0;
+		tracker.ForEachInUse([&inUseCount](const TrackedAudioInstance&) { ++inUseCount; });
+		CHECK(inUseCount == 2);
+
+		// Foreign pointers are ignored
+		TrackedAudioInstance foreignRecord;
+		CHECK(!tracker.Owns(&foreignRecord));
+		tracker.Release(&foreignRecord);
+		tracker.Release(nullptr);
+		CHECK(tracker.GetActiveCount() == 2);
+
+		// Released records are reused and reset
+		first->ownerIndex = 1;
+		first->userData = &foreignRecord;
+		tracker.Release(first);
+		CHECK(tracker.GetActiveCount() == 1);
+
+		TrackedAudioInstance* reused = tracker.Acquire();
+		CHECK(reused == first);
+		CHECK(reused && reused->ownerIndex == AUDIO_OWNER_NONE && reused->userData == nullptr);
+		CHECK(tracker.GetActiveCount() == 2);
+		CHECK(tracker.GetDroppedCount() == 1);
+
+		tracker.Release(second);
+		tracker.Release(reused);
+		CHECK(tracker.GetActiveCount() == 0);
+	}
+
+	bool GetOwnerStats(const std::string& ownerName, AudioOwnerStats& outStats)
+	{
+		std::vector<AudioOwnerStats> ownerStats;
+		AudioEngine::GetOwnerStats(ownerStats);
+		for (auto& stats : ownerStats)
+		{
+			if (stats.name == ownerName)
+			{
+				outStats = std::move(stats);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void TestOwnerAccounting()
+	{
+		ApplyHeadlessConfigDefaults();
+		AudioConfig::SetOverride("Budgets", "EnableOwnerAccounting", "true");
+		AudioConfig::SetOverride("Budgets", "OverflowAction", "Log");
+
+		if (!AudioEngine::Initialize())
+		{
+			Check(false, "AudioEngine::Initialize, run from the build directory", __FILE__, __LINE__);
+			AudioEngine::Terminate();
+			AudioConfig::ClearOverrides();
+			return;
+		}
+		CHECK(AudioEngine::IsOwnerAccountingEnabled());
+
+		// Owners are created by the first SetActiveOwner, with the budget of their config section
+		AudioEngine::SetActiveOwner(TEST_OWNER);
+		AudioOwnerStats stats;
+		CHECK(GetOwnerStats(TEST_OWNER, stats));
+		CHECK(stats.budget.maxBanks == 2);
+		CHECK(stats.bankCount == 0 && stats.liveInstances == 0 && stats.overBudgetMask == 0);
+
+		// Load
+		std::array<AudioBank*, TEST_BANKS.size()> banks {};
+		CHECK(AudioEngine::LoadSoundBankFile(TEST_BANKS[0], banks[0]));
+		CHECK(GetOwnerStats(TEST_OWNER, stats));
+		CHECK(stats.bankCount == 1);
+		CHECK(stats.bankMemoryBytes >= 0);
+
+		// Instances count until FMOD destroys them
+		AudioInstance* instance = AudioEngine::PlayAudioEvent(TEST_EVENT);
+		CHECK(instance != nullptr);
+		AudioEngine::Update();
+		CHECK(GetOwnerStats(TEST_OWNER, stats));
+		CHECK(stats.liveInstances == 1);
+
+		CHECK(AudioEngine::InstanceStop(instance, false));
+		AudioEngine::Update();
+		AudioEngine::Update();
+		CHECK(GetOwnerStats(TEST_OWNER, stats));
+		CHECK(stats.liveInstances == 0);
+
+		// Crossing MaxBanks sets the flag on the next update
+		CHECK(AudioEngine::LoadSoundBankFile(TEST_BANKS[1], banks[1]));
+		CHECK(AudioEngine::LoadSoundBankFile(TEST_BANKS[2], banks[2]));
+		AudioEngine::Update();
+		CHECK(GetOwnerStats(TEST_OWNER, stats));
+		CHECK(stats.bankCount == 3);
+		CHECK(stats.overBudgetMask & AUDIO_OWNER_BUDGET_BANKS);
+
+		// Unload
+		const int64_t bankMemoryBytes = stats.bankMemoryBytes;
+		CHECK(AudioEngine::UnloadSoundBank(banks[2]));
+		AudioEngine::Update();
+		CHECK(GetOwnerStats(TEST_OWNER, stats));
+		CHECK(stats.bankCount == 2);
+		CHECK(stats.bankMemoryBytes <= bankMemoryBytes);
+		CHECK(!(stats.overBudgetMask & AUDIO_OWNER_BUDGET_BANKS));
+
+		// Failed unload: the handle is already invalid, the accounting is left as it was
+		CHECK(banks[1]->unload() == FMOD_OK);
+		CHECK(!AudioEngine::UnloadSoundBank(banks[1]));
+		CHECK(GetOwnerStats(TEST_OWNER, stats));
+		CHECK(stats.bankCount == 2);
+
+		CHECK(AudioEngine::UnloadSoundBank(banks[0]));
+		CHECK(GetOwnerStats(TEST_OWNER, stats));
+		CHECK(stats.bankCount == 1);
+
+		AudioEngine::Terminate();
+		AudioConfig::ClearOverrides();
+	}
+
+	void TestJournalRing()
+	{
+		constexpr uint32_t recordCapacity = 4;
+		constexpr uint32_t nameCapacity = 4;
+		constexpr uint32_t recordCount = 6;
+		const std::string path = (std::filesystem::temp_directory_path() / "fmod_cmake_tests_journal.bin").string();
+
+		uint32_t nameIdA = 0;
+		uint32_t nameIdB = 0;
+		{
+			const std::unique_ptr<AudioJournal> journal = AudioJournal::Create(path, recordCapacity, nameCapacity);
+			CHECK(journal != nullptr);
+			if (!journal) { return; }
+
+			nameIdA = journal->RegisterName(COLLIDING_NAME_A);
+			nameIdB = journal->RegisterName(COLLIDING_NAME_B);
+			CHECK(nameIdA == GetJournalNameId(COLLIDING_NAME_A, strlen(COLLIDING_NAME_A)));
+			CHECK(nameIdB != 0 && nameIdB != nameIdA);
+			CHECK(journal->RegisterName(COLLIDING_NAME_A) == nameIdA);
+			CHECK(journal->RegisterName(COLLIDING_NAME_B) == nameIdB);
+
+			// Once the table is full, the moved name is still found past the slot of the name it collided with
+			CHECK(journal->RegisterName("event:/MusicTest") != 0);
+			CHECK(journal->RegisterName("bus:/") != 0);
+			CHECK(journal->RegisterName(COLLIDING_NAME_B) == nameIdB);
+			CHECK(journal->RegisterName(COLLIDING_NAME_A) == nameIdA);
+			CHECK(journal->RegisterName("vca:/Master_VCA") == GetJournalNameId("vca:/Master_VCA", strlen("vca:/Master_VCA")));
+
+			for (uint32_t i = 0; i < recordCount; ++i)
+			{
+				journal->Record(JOURNAL_OP_PLAY, &journal, i % 2 == 0 ? nameIdA : nameIdB, i, static_cast<float>(i), 0, 0);
+			}
+		}
+
+		// The journal is flushed to the file when destroyed
+		std::ifstream file(path, std::ios::binary);
+		CHECK(file.is_open());
+
+		JournalHeader header {};
+		std::array<JournalName, nameCapacity> names {};
+		std::array<JournalRecord, recordCapacity> records {};
+		file.read(reinterpret_cast<char*>(&header), sizeof(header));
+		file.read(reinterpret_cast<char*>(names.data()), sizeof(names));
+		file.read(reinterpret_cast<char*>(records.data()), sizeof(records));
+		CHECK(file.good());
+		file.close();
+		std::filesystem::remove(path);
+
+		CHECK(header.magic == JOURNAL_MAGIC && header.version == JOURNAL_LAYOUT_VERSION);
+		CHECK(header.recordCapacity == recordCapacity && header.nameCapacity == nameCapacity);
+		CHECK(header.writeIndex == recordCount);
+		CHECK(header.nameCount == nameCapacity);
+		CHECK(names[0].nameId == nameIdA && std::string_view(names[0].name) == COLLIDING_NAME_A);
+		CHECK(names[1].nameId == nameIdB && std::string_view(names[1].name) == COLLIDING_NAME_B);
+
+		// Only the last recordCapacity records are left, at (sequence - 1) % recordCapacity
+		for (uint32_t i = recordCount - recordCapacity; i < recordCount; ++i)
+		{
+			const JournalRecord& record = records[i % recordCapacity];
+			CHECK(record.sequence == i + 1);
+			CHECK(record.op == JOURNAL_OP_PLAY && record.data == i && record.values[0] == static_cast<float>(i));
+			CHECK(record.nameId == (i % 2 == 0 ? nameIdA : nameIdB));
+		}
+	}
+
+	void TestLoggerRing()
+	{
+		constexpr int repeatedCount = 5;
+		constexpr int floodCount = 100000;
+
+		// The writer thread prints to std::cout, capture it until the loggers are destroyed
+		std::ostringstream output;
+		std::streambuf* coutBuffer = std::cout.rdbuf(output.rdbuf());
+
+		// Same call site within the rate limit window: printed once, then summarized when flushed
+		{
+			AudioLogger logger(64, 60000);
+			for (int i = 0; i < repeatedCount; ++i)
+			{
+				logger.PushLog(AudioLogLevel::Warning, __FILE__, __LINE__, __func__, std::format("repeated {}", i).c_str());
+			}
+			logger.PushLog(AudioLogLevel::Error, __FILE__, __LINE__, __func__, "other call site");
+		}
+		const std::string rateLimitedOutput = output.str();
+		output.str("");
+
+		// A ring of 2 records cannot keep up with a tight loop: the overflow is dropped and reported, never blocks
+		uint64_t droppedCount = 0;
+		{
+			AudioLogger logger(2, 0);
+			for (int i = 0; i < floodCount; ++i)
+			{
+				logger.PushLog(AudioLogLevel::Log, __FILE__, __LINE__, __func__, "flood");
+			}
+			droppedCount = logger.GetDroppedCount();
+		}
+		const std::string floodOutput = output.str();
+
+		std::cout.rdbuf(coutBuffer);
+
+		CHECK(rateLimitedOutput.find("repeated 0\n") != std::string::npos);
+		CHECK(rateLimitedOutput.find("repeated 1\n") == std::string::npos);
+		CHECK(rateLimitedOutput.find(std::format("repeated {} (repeated {} times)", repeatedCount - 1, repeatedCount - 1)) != std::string::npos);
+		CHECK(rateLimitedOutput.find("FMOD Error") != std::string::npos);
+
+		CHECK(droppedCount > 0 && droppedCount < floodCount);
+		CHECK(floodOutput.find("the log ring is full") != std::string::npos);
+	}
+}
+
+int main()
+{
+	TestInstanceTrackerPool();
+	TestOwnerAccounting();
+	TestJournalRing();
+	TestLoggerRing();
+
+	std::cout << std::format("{} of {} checks passed", sCheckCount - sFailedCount, sCheckCount) << std::endl;
+	return sFailedCount == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,262 @@
+"""
+Performance Results Comparison
+Compares baseline and candidate result JSON files written by the scenario runner (scenario_results.json),
+FmodCmakeBench, FmodCmakeThroughput and FmodCmakeReplay. Every side can hold several repeated runs: each metric
+is reduced to the median of its runs and the noise is estimated from the median absolute deviation (MAD) of both sides.
+A metric regresses when it moves in the worse direction by more than the noise threshold and by more than the
+relative and absolute minimum changes, so a single noisy run does not fail a build.
+Exits with 1 when any metric regressed.
+"""
+
+import json
+import math
+import statistics
+import sys
+
+from pathlib import Path
+
+# MAD * 1.4826 estimates the standard deviation of normally distributed samples
+MAD_TO_SIGMA = 1.4826
+
+DEFAULT_MADS = 3.0
+DEFAULT_MIN_CHANGE = 0.05
+
+# Changes below these are never significant, whatever the noise, keyed by metric unit suffix
+ABSOLUTE_FLOORS = {
+    '_ms': 0.05,
+    '_us': 20.0,
+    '_ns': 1.0,
+    '_allocations': 1.0,
+    '_percent': 0.5,
+}
+
+# Every other metric is better when lower
+HIGHER_IS_BETTER = (
+    'realtime_factor',
+    'events_started_per_s',
+)
+
+
+def add_histogram_metrics(metrics, prefix, histogram, unit, percentiles=('p50', 'p90', 'p99', 'max')):
+    """Adds the percentiles of a histogram written by the app, skipping empty ones."""
+    if histogram.get('count', 1) == 0:
+        return
+    for percentile in percentiles:
+        if percentile in histogram:
+            metrics[f"{prefix}/{percentile}{unit}"] = histogram[percentile]
+
+
+def extract_scenario_metrics(results):
+    """Scenario runner output, see src/app/scenario_runner.cpp."""
+    metrics = {}
+    add_histogram_metrics(metrics, 'frame', results['frameMs'], '_ms')
+
+    allocations = results.get('allocationsPerFrame', {})
+    if allocations.get('tracked'):
+        metrics['frame/mean_allocations'] = allocations['mean']
+        metrics['frame/max_allocations'] = allocations['max']
+
+    # Actions are keyed by their text and occurrence, so editing an unrelated line of the script keeps the keys
+    occurrences = {}
+    for action in results.get('actions', []):
+        text = action['action']
+        occurrences[text] = occurrences.get(text, 0) + 1
+        key = f"action[{text}#{occurrences[text]}]"
+        metrics[f"{key}/action_frame_ms"] = action['actionFrameMs']
+        if action['frames'] > 1:
+            add_histogram_metrics(metrics, key, action['frameMs'], '_ms', ('p50', 'p99'))
+
+    occurrences = {}
+    for bank in results.get('bankLoads', []):
+        path = bank['path']
+        occurrences[path] = occurrences.get(path, 0) + 1
+        metrics[f"bank[{path}#{occurrences[path]}]/load_ms"] = bank['loadTimeMs']
+
+    for latency in results.get('firstPlayLatency', []):
+        key = f"first_play[{latency['event']}]"
+        add_histogram_metrics(metrics, f"{key}/started", latency['startedUs'], '_us', ('p50', 'p99'))
+        add_histogram_metrics(metrics, f"{key}/sound_played", latency['soundPlayedUs'], '_us', ('p50', 'p99'))
+    return metrics
+
+
+def extract_bench_metrics(results):
+    """FmodCmakeBench output, see bench/bench_harness.h."""
+    metrics = {}
+    for result in results['results']:
+        if 'skipped' not in result:
+            metrics[f"bench[{result['name']}]/median_ns"] = result['nsPerOp']['median']
+    return metrics
+
+
+def extract_throughput_metrics(results):
+    """FmodCmakeThroughput output, see bench/nrt_throughput.cpp."""
+    metrics = {
+        'throughput/realtime_factor': results['realtimeFactor'],
+        'throughput/events_started_per_s': results['eventsStartedPerSecond'],
+        'throughput/dsp_mean_percent': results['dspCPUPercent']['mean'],
+        'throughput/studio_update_percent': results['studioUpdateCPUPercent'],
+    }
+    add_histogram_metrics(metrics, 'throughput/update', results['updateMs'], '_ms')
+    add_histogram_metrics(metrics, 'throughput/tick', results['tickMs'], '_ms')
+    return metrics
+
+
+def extract_replay_metrics(results):
+    """FmodCmakeReplay output, see bench/command_replay.cpp."""
+    metrics = {
+        'replay/realtime_factor': results['realtimeFactor'],
+        'replay/dsp_mean_percent': results['dspCPUPercent']['mean'],
+        'replay/studio_update_mean_percent': results['studioUpdateCPUPercent']['mean'],
+        'replay/memory_max_bytes': results['memoryMaxBytes'],
+    }
+    add_histogram_metrics(metrics, 'replay/update', results['updateMs'], '_ms')
+    return metrics
+
+
+def load_metrics(path):
+    """Reads one result file and flattens it into {metric name: value}."""
+    with open(path, 'r', encoding='utf-8') as file:
+        results = json.load(file)
+
+    if 'scenario' in results:
+        metrics = extract_scenario_metrics(results)
+    elif 'suite' in results:
+        metrics = extract_bench_metrics(results)
+    elif results.get('benchmark') == 'nrt_throughput':
+        metrics = extract_throughput_metrics(results)
+    elif results.get('benchmark') == 'command_replay':
+        metrics = extract_replay_metrics(results)
+    else:
+        raise ValueError(f"{path} is not a scenario, bench, throughput or replay result file")
+
+    # Runs against the fake FMOD backend only compare with other fake runs, they show up as "not in both" otherwise
+    if results.get('backend', 'fmod') != 'fmod':
+        metrics = {f"{results['backend']}:{metric}": value for metric, value in metrics.items()}
+    return metrics
+
+
+def median_and_mad(values):
+    median = statistics.median(values)
+    return median, statistics.median(abs(value - median) for value in values)
+
+
+def get_absolute_floor(metric):
+    for suffix, floor in ABSOLUTE_FLOORS.items():
+        if metric.endswith(suffix):
+            return floor
+    return 0.0
+
+
+def compare_metric(metric, baseline_values, candidate_values, mads, min_change):
+    """Returns (status, baseline median, candidate median, relative delta, threshold)."""
+    baseline, baseline_mad = median_and_mad(baseline_values)
+    candidate, candidate_mad = median_and_mad(candidate_values)
+
+    # Noise of the difference of the two medians, with a single run per side only the minimum changes apply
+    noise = MAD_TO_SIGMA * math.hypot(baseline_mad, candidate_mad)
+    threshold = max(mads * noise, min_change * abs(baseline), get_absolute_floor(metric))
+
+    worse = candidate - baseline
+    if metric.endswith(HIGHER_IS_BETTER):
+        worse = -worse
+
+    relative = (candidate - baseline) / abs(baseline) if baseline != 0 else 0.0
+    if worse > threshold:
+        status = 'REGRESSION'
+    elif -worse > threshold:
+        status = 'improved'
+    else:
+        status = 'ok'
+    return status, baseline, candidate, relative, threshold
+
+
+def print_usage():
+    print("Usage: python compare_results.py --baseline <results.json>... --candidate <results.json>...")
+    print("                                 [--mads 3] [--min-change 0.05] [--filter <substring>] [--all]")
+    print("Example: python compare_results.py --baseline main_1.json main_2.json main_3.json "
+          "--candidate branch_1.json branch_2.json branch_3.json")
+    print("\nOptions:")
+    print("  --mads          Noise threshold in estimated standard deviations (MAD * 1.4826) of the difference")
+    print("  --min-change    Relative change below which a metric is never significant (0.05 = 5%)")
+    print("  --filter        Only compares metrics whose name contains the substring")
+    print("  --all           Also prints the metrics that did not change significantly")
+
+
+def parse_arguments(arguments):
+    options = {'baseline': [], 'candidate': [], 'mads': DEFAULT_MADS, 'min_change': DEFAULT_MIN_CHANGE,
+               'filter': '', 'all': False}
+    current_list = None
+    index = 0
+    while index < len(arguments):
+        argument = arguments[index]
+        if argument in ('--baseline', '--candidate'):
+            current_list = options[argument[2:]]
+        elif argument in ('--mads', '--min-change', '--filter'):
+            if index + 1 >= len(arguments):
+                return None
+            index += 1
+            key = argument[2:].replace('-', '_')
+            options[key] = arguments[index] if key == 'filter' else float(arguments[index])
+            current_list = None
+        elif argument == '--all':
+            options['all'] = True
+            current_list = None
+        elif current_list is not None and not argument.startswith('--'):
+            current_list.append(Path(argument))
+        else:
+            return None
+        index += 1
+
+    if not options['baseline'] or not options['candidate']:
+        return None
+    return options
+
+
+def main():
+    try:
+        options = parse_arguments(sys.argv[1:])
+    except ValueError:
+        options = None
+    if options is None:
+        print_usage()
+        sys.exit(2)
+
+    try:
+        baseline_runs = [load_metrics(path) for path in options['baseline']]
+        candidate_runs = [load_metrics(path) for path in options['candidate']]
+    except (OSError, ValueError, KeyError) as e:
+        print(f"Error: {e}")
+        sys.exit(2)
+
+    # Only metrics present in every run of both sides are compared, the others are listed as missing
+    baseline_metrics = set.intersection(*(set(run) for run in baseline_runs))
+    candidate_metrics = set.intersection(*(set(run) for run in candidate_runs))
+    compared = sorted(metric for metric in baseline_metrics & candidate_metrics if options['filter'] in metric)
+    missing = sorted(metric for metric in baseline_metrics ^ candidate_metrics if options['filter'] in metric)
+
+    print(f"Baseline: {len(baseline_runs)} run(s), candidate: {len(candidate_runs)} run(s), "
+          f"threshold: {options['mads']:g} MADs, min change {options['min_change'] * 100:g}%\n")
+    print(f"{'metric':<72} {'baseline':>12} {'candidate':>12} {'delta':>9} {'threshold':>11}  status")
+
+    regressions = 0
+    improvements = 0
+    for metric in compared:
+        status, baseline, candidate, relative, threshold = compare_metric(
+            metric, [run[metric] for run in baseline_runs], [run[metric] for run in candidate_runs],
+            options['mads'], options['min_change'])
+        regressions += status == 'REGRESSION'
+        improvements += status == 'improved'
+        if status != 'ok' or options['all']:
+            print(f"{metric:<72} {baseline:>12.4f} {candidate:>12.4f} {relative * 100:>+8.1f}% {threshold:>11.4f}  {status}")
+
+    for metric in missing:
+        side = 'baseline' if metric in baseline_metrics else 'candidate'
+        print(f"{metric:<72} only in {side}")
+
+    print(f"\n{len(compared)} metrics compared: {regressions} regressed, {improvements} improved, "
+          f"{len(missing)} not in both")
+    sys.exit(1 if regressions > 0 else 0)
+
+
+if __name__ == "__main__":
+    main()
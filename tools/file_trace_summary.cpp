@@ -0,0 +1,175 @@
+/*
+ * File Trace Summary
+ * Summarizes a binary file I/O trace written by FmodCmake ([Profiling] EnableFileTracing=true, FileTracePath)
+ * per file and per access kind (bank load, sample data load, stream).
+ *
+ * Usage: FmodCmakeFileTraceSummary <trace file> [--small-read-bytes 4096]
+ */
+
+#include "audio/audio_file_trace_layout.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	struct TracedHandle
+	{
+		std::string path;
+		uint8_t kind = FILE_TRACE_KIND_UNKNOWN;
+	};
+
+	struct AccessSummary
+	{
+		uint64_t handles = 0;
+		uint64_t reads = 0;
+		uint64_t seeks = 0;
+		uint64_t bytesRead = 0;
+		uint64_t smallReads = 0;
+		uint64_t sequentialReads = 0;
+		std::vector<uint32_t> readSizes;
+		std::vector<uint32_t> readLatenciesNs;
+		uint64_t firstTimeNs = UINT64_MAX;
+		uint64_t lastTimeNs = 0;
+	};
+
+	uint32_t Percentile(std::vector<uint32_t>& values, const double percentile)
+	{
+		if (values.empty()) { return 0; }
+		const size_t index = std::min(static_cast<size_t>(percentile * 0.01 * static_cast<double>(values.size())), values.size() - 1);
+		std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+		return values[index];
+	}
+
+	void PrintUsage(const char* program)
+	{
+		std::printf("Usage: %s <trace file> [--small-read-bytes <bytes>]\n", program);
+	}
+}
+
+int main(const int argc, char* argv[])
+{
+	std::string tracePath;
+	uint32_t smallReadBytes = 4096;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string argument = argv[i];
+		if (argument == "--small-read-bytes" && i + 1 < argc) { smallReadBytes = static_cast<uint32_t>(std::max(std::atol(argv[++i]), 1l)); }
+		else if (tracePath.empty() && argument.rfind("--", 0) != 0) { tracePath = argument; }
+		else
+		{
+			PrintUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (tracePath.empty())
+	{
+		PrintUsage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	std::FILE* file = std::fopen(tracePath.c_str(), "rb");
+	if (!file)
+	{
+		std::fprintf(stderr, "Cannot open %s\n", tracePath.c_str());
+		return EXIT_FAILURE;
+	}
+
+	FileTraceHeader header = {};
+	if (std::fread(&header, sizeof(header), 1, file) != 1 || header.magic != FILE_TRACE_MAGIC
+		|| header.version != FILE_TRACE_LAYOUT_VERSION || header.recordSize != sizeof(FileTraceRecord))
+	{
+		std::fprintf(stderr, "%s is not a file trace of layout version %u\n", tracePath.c_str(), static_cast<unsigned>(FILE_TRACE_LAYOUT_VERSION));
+		std::fclose(file);
+		return EXIT_FAILURE;
+	}
+
+	// First pass: the access kind of a handle is only final on its Close record
+	std::vector<FileTraceRecord> records;
+	std::unordered_map<uint32_t, TracedHandle> handles;
+	FileTraceRecord record = {};
+	while (std::fread(&record, sizeof(record), 1, file) == 1)
+	{
+		if (record.op == FILE_TRACE_OP_OPEN)
+		{
+			const size_t paddedSize = (record.sizeBytes + 7u) & ~size_t{7};
+			std::vector<char> pathBytes(paddedSize);
+			if (std::fread(pathBytes.data(), 1, paddedSize, file) != paddedSize) { break; }
+			handles[record.fileId] = TracedHandle{std::string(pathBytes.data(), record.sizeBytes), record.kind};
+		}
+		else if (record.op == FILE_TRACE_OP_CLOSE)
+		{
+			handles[record.fileId].kind = record.kind;
+		}
+		records.push_back(record);
+	}
+	std::fclose(file);
+
+	// Second pass: aggregate per path and kind, ordered by path
+	std::map<std::pair<std::string, uint8_t>, AccessSummary> summaries;
+	std::unordered_map<uint32_t, uint32_t> nextSequentialPosition;
+	for (const FileTraceRecord& traceRecord : records)
+	{
+		const TracedHandle& handle = handles[traceRecord.fileId];
+		AccessSummary& summary = summaries[{handle.path, handle.kind}];
+		summary.firstTimeNs = std::min(summary.firstTimeNs, traceRecord.timeNs);
+		summary.lastTimeNs = std::max(summary.lastTimeNs, traceRecord.timeNs);
+
+		switch (traceRecord.op)
+		{
+			case FILE_TRACE_OP_OPEN:
+				++summary.handles;
+				nextSequentialPosition[traceRecord.fileId] = 0;
+				break;
+			case FILE_TRACE_OP_READ:
+				++summary.reads;
+				summary.bytesRead += traceRecord.bytesRead;
+				summary.readSizes.push_back(traceRecord.sizeBytes);
+				summary.readLatenciesNs.push_back(traceRecord.latencyNs);
+				if (traceRecord.sizeBytes < smallReadBytes) { ++summary.smallReads; }
+				if (nextSequentialPosition[traceRecord.fileId] == traceRecord.position) { ++summary.sequentialReads; }
+				nextSequentialPosition[traceRecord.fileId] = traceRecord.position + traceRecord.bytesRead;
+				break;
+			case FILE_TRACE_OP_SEEK:
+				++summary.seeks;
+				break;
+			default:
+				break;
+		}
+	}
+
+	std::printf("%zu records, %zu handles\n", records.size(), handles.size());
+	for (auto& [key, summary] : summaries)
+	{
+		const auto& [path, kind] = key;
+		const double durationMs = summary.firstTimeNs == UINT64_MAX ? 0.0 : static_cast<double>(summary.lastTimeNs - summary.firstTimeNs) * 1e-6;
+		const double sequentialPercent = summary.reads == 0 ? 0.0 : 100.0 * static_cast<double>(summary.sequentialReads) / static_cast<double>(summary.reads);
+
+		std::printf("%s [%s]\n", path.c_str(), GetFileTraceKindName(kind));
+		std::printf("  handles=%llu reads=%llu seeks=%llu bytes=%llu span=%.1f ms sequential=%.0f%%\n",
+			static_cast<unsigned long long>(summary.handles), static_cast<unsigned long long>(summary.reads),
+			static_cast<unsigned long long>(summary.seeks), static_cast<unsigned long long>(summary.bytesRead),
+			durationMs, sequentialPercent);
+		if (summary.reads == 0) { continue; }
+
+		const uint32_t minSize = *std::ranges::min_element(summary.readSizes);
+		const uint32_t maxSize = *std::ranges::max_element(summary.readSizes);
+		std::printf("  read size bytes: min=%u p50=%u max=%u small(<%u)=%llu\n",
+			minSize, Percentile(summary.readSizes, 50), maxSize, smallReadBytes,
+			static_cast<unsigned long long>(summary.smallReads));
+		std::printf("  read latency us: p50=%.1f p99=%.1f max=%.1f\n",
+			static_cast<double>(Percentile(summary.readLatenciesNs, 50)) * 0.001,
+			static_cast<double>(Percentile(summary.readLatenciesNs, 99)) * 0.001,
+			static_cast<double>(*std::ranges::max_element(summary.readLatenciesNs)) * 0.001);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,192 @@
+/*
+ * Journal Decoder
+ * Converts the memory-mapped audio journal written by FmodCmake ([Journal] EnableJournal=true) to CSV or JSON,
+ * oldest record first. Works on the journal of a running, exited or crashed app.
+ *
+ * Usage: FmodCmakeJournalDecoder <journal file> [--format csv|json] [--last 0]
+ */
+
+#include "audio/audio_journal_layout.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	std::string EscapeJson(const std::string& text)
+	{
+		std::string escaped;
+		for (const char character : text)
+		{
+			if (static_cast<unsigned char>(character) < 0x20)
+			{
+				char unicodeEscape[8];
+				std::snprintf(unicodeEscape, sizeof(unicodeEscape), "\\u%04x", static_cast<unsigned char>(character));
+				escaped += unicodeEscape;
+				continue;
+			}
+			if (character == '"' || character == '\\') { escaped += '\\'; }
+			escaped += character;
+		}
+		return escaped;
+	}
+
+	std::string EscapeCsv(const std::string& text)
+	{
+		if (text.find_first_of(",\"\r\n") == std::string::npos) { return text; }
+
+		std::string escaped = "\"";
+		for (const char character : text)
+		{
+			if (character == '"') { escaped += '"'; }
+			escaped += character;
+		}
+		return escaped + "\"";
+	}
+
+	// JSON has no NaN or infinity
+	std::string FormatJsonNumber(const float value)
+	{
+		if (!std::isfinite(value)) { return "null"; }
+
+		char text[32];
+		std::snprintf(text, sizeof(text), "%g", static_cast<double>(value));
+		return text;
+	}
+
+	void PrintUsage(const char* program)
+	{
+		std::printf("Usage: %s <journal file> [--format csv|json] [--last <records, 0 = all>]\n", program);
+	}
+}
+
+int main(const int argc, char* argv[])
+{
+	std::string journalPath;
+	bool bJson = false;
+	size_t lastCount = 0;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string argument = argv[i];
+		if (argument == "--format" && i + 1 < argc)
+		{
+			const std::string format = argv[++i];
+			if (format != "csv" && format != "json")
+			{
+				PrintUsage(argv[0]);
+				return EXIT_FAILURE;
+			}
+			bJson = format == "json";
+		}
+		else if (argument == "--last" && i + 1 < argc) { lastCount = static_cast<size_t>(std::max(std::atol(argv[++i]), 0l)); }
+		else if (journalPath.empty() && argument.rfind("--", 0) != 0) { journalPath = argument; }
+		else
+		{
+			PrintUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (journalPath.empty())
+	{
+		PrintUsage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	std::FILE* file = std::fopen(journalPath.c_str(), "rb");
+	if (!file)
+	{
+		std::fprintf(stderr, "Cannot open %s\n", journalPath.c_str());
+		return EXIT_FAILURE;
+	}
+
+	JournalHeader header = {};
+	if (std::fread(&header, sizeof(header), 1, file) != 1 || header.magic != JOURNAL_MAGIC
+		|| header.version != JOURNAL_LAYOUT_VERSION || header.recordSize != sizeof(JournalRecord))
+	{
+		std::fprintf(stderr, "%s is not a journal of layout version %u\n", journalPath.c_str(), static_cast<unsigned>(JOURNAL_LAYOUT_VERSION));
+		std::fclose(file);
+		return EXIT_FAILURE;
+	}
+
+	std::vector<JournalName> names(header.nameCapacity);
+	std::vector<JournalRecord> records(header.recordCapacity);
+	if (std::fread(names.data(), sizeof(JournalName), names.size(), file) != names.size()
+		|| std::fread(records.data(), sizeof(JournalRecord), records.size(), file) != records.size())
+	{
+		std::fprintf(stderr, "%s is truncated\n", journalPath.c_str());
+		std::fclose(file);
+		return EXIT_FAILURE;
+	}
+	std::fclose(file);
+
+	std::unordered_map<uint32_t, std::string> nameById;
+	for (uint32_t i = 0; i < std::min(header.nameCount, header.nameCapacity); ++i)
+	{
+		names[i].name[JOURNAL_MAX_NAME - 1] = '\0';
+		nameById.emplace(names[i].nameId, names[i].name);
+	}
+
+	const auto resolveName = [&nameById](const uint32_t nameId) -> std::string
+	{
+		if (nameId == 0) { return ""; }
+		if (const auto it = nameById.find(nameId); it != nameById.end()) { return it->second; }
+
+		char unknownName[16];
+		std::snprintf(unknownName, sizeof(unknownName), "#%08x", nameId);
+		return unknownName;
+	};
+
+	// Slots with sequence 0 are empty or were torn by a crash mid-write
+	std::erase_if(records, [](const JournalRecord& record) { return record.sequence == 0; });
+	std::ranges::sort(records, {}, &JournalRecord::sequence);
+	if (lastCount > 0 && records.size() > lastCount)
+	{
+		records.erase(records.begin(), records.end() - static_cast<std::ptrdiff_t>(lastCount));
+	}
+
+	if (bJson)
+	{
+		std::printf("{\"startUnixTimeNs\":%lld,\"writerProcessId\":%u,\"written\":%llu,\"records\":[",
+			static_cast<long long>(header.startUnixTimeNs), header.writerProcessId,
+			static_cast<unsigned long long>(header.writeIndex));
+	}
+	else
+	{
+		std::printf("sequence,time_ms,op,handle,name,data,label,x,y,z\n");
+	}
+
+	for (size_t i = 0; i < records.size(); ++i)
+	{
+		const JournalRecord& record = records[i];
+		const std::string name = resolveName(record.nameId);
+		const std::string label = record.op == JOURNAL_OP_PARAMETER_LABEL ? resolveName(record.data) : "";
+		const double timeMs = static_cast<double>(record.timeNs) * 1e-6;
+
+		if (bJson)
+		{
+			std::printf("%s\n{\"sequence\":%llu,\"timeMs\":%.3f,\"op\":\"%s\",\"handle\":\"0x%llx\",\"name\":\"%s\",\"data\":%u,"
+				"\"label\":\"%s\",\"position\":[%s,%s,%s]}",
+				i == 0 ? "" : ",", static_cast<unsigned long long>(record.sequence), timeMs, GetJournalOpName(record.op),
+				static_cast<unsigned long long>(record.handle), EscapeJson(name).c_str(), record.data, EscapeJson(label).c_str(),
+				FormatJsonNumber(record.values[0]).c_str(), FormatJsonNumber(record.values[1]).c_str(),
+				FormatJsonNumber(record.values[2]).c_str());
+		}
+		else
+		{
+			std::printf("%llu,%.3f,%s,0x%llx,%s,%u,%s,%g,%g,%g\n",
+				static_cast<unsigned long long>(record.sequence), timeMs, GetJournalOpName(record.op),
+				static_cast<unsigned long long>(record.handle), EscapeCsv(name).c_str(), record.data,
+				EscapeCsv(label).c_str(), record.values[0], record.values[1], record.values[2]);
+		}
+	}
+
+	if (bJson) { std::printf("\n]}\n"); }
+	return EXIT_SUCCESS;
+}
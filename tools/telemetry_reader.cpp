@@ -0,0 +1,121 @@
+/*
+ * Telemetry Reader
+ * Samples the shared-memory segment published by FmodCmake ([Telemetry] EnableSharedMemory=true)
+ * and prints one line per sample. Read-only: attaching or detaching never affects the app.
+ *
+ * Usage: FmodCmakeTelemetryReader [--name /fmod_cmake_telemetry] [--interval-ms 100] [--count 0] [--banks]
+ */
+
+#include "profiling/telemetry_layout.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace
+{
+	const char* LoadingStateName(const int32_t loadingState)
+	{
+		switch (loadingState)
+		{
+			case TELEMETRY_LOADING_STATE_UNLOADING: return "unloading";
+			case TELEMETRY_LOADING_STATE_UNLOADED: return "unloaded";
+			case TELEMETRY_LOADING_STATE_LOADING: return "loading";
+			case TELEMETRY_LOADING_STATE_LOADED: return "loaded";
+			case TELEMETRY_LOADING_STATE_ERROR: return "error";
+			default: return "unknown";
+		}
+	}
+
+	void PrintUsage(const char* program)
+	{
+		std::printf("Usage: %s [--name <shm name>] [--interval-ms <ms>] [--count <samples, 0 = forever>] [--banks]\n", program);
+	}
+}
+
+int main(const int argc, char* argv[])
+{
+	std::string name = TELEMETRY_DEFAULT_SHARED_MEMORY_NAME;
+	int intervalMs = 100;
+	long count = 0;
+	bool bPrintBanks = false;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string argument = argv[i];
+		if (argument == "--name" && i + 1 < argc) { name = argv[++i]; }
+		else if (argument == "--interval-ms" && i + 1 < argc) { intervalMs = std::max(std::atoi(argv[++i]), 1); }
+		else if (argument == "--count" && i + 1 < argc) { count = std::atol(argv[++i]); }
+		else if (argument == "--banks") { bPrintBanks = true; }
+		else
+		{
+			PrintUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	const int fileDescriptor = shm_open(name.c_str(), O_RDONLY, 0);
+	if (fileDescriptor < 0)
+	{
+		std::fprintf(stderr, "Cannot open shared memory %s (is FmodCmake running with telemetry enabled?)\n", name.c_str());
+		return EXIT_FAILURE;
+	}
+
+	void* memory = mmap(nullptr, sizeof(TelemetrySegment), PROT_READ, MAP_SHARED, fileDescriptor, 0);
+	close(fileDescriptor);
+	if (memory == MAP_FAILED)
+	{
+		std::fprintf(stderr, "Cannot map shared memory %s\n", name.c_str());
+		return EXIT_FAILURE;
+	}
+
+	const auto* segment = static_cast<const TelemetrySegment*>(memory);
+	if (segment->magic != TELEMETRY_MAGIC || segment->version != TELEMETRY_LAYOUT_VERSION
+		|| segment->segmentSize != sizeof(TelemetrySegment))
+	{
+		std::fprintf(stderr, "Unsupported telemetry layout (magic 0x%08X, version %u, size %u), expected version %u\n",
+			segment->magic, segment->version, segment->segmentSize, TELEMETRY_LAYOUT_VERSION);
+		munmap(memory, sizeof(TelemetrySegment));
+		return EXIT_FAILURE;
+	}
+
+	std::printf("Attached to %s (writer pid %u, layout v%u)\n", name.c_str(), segment->writerProcessId, segment->version);
+	std::printf("%10s %8s %8s %8s %7s %7s %7s %10s %6s %6s %8s %10s\n",
+		"frame", "ms", "avg ms", "max ms", "dsp %", "strm %", "upd %", "fmod KiB", "voices", "real", "inst", "played");
+
+	TelemetryPayload payload {};
+	for (long sample = 0; count == 0 || sample < count; ++sample)
+	{
+		if (!TelemetryReadPayload(*segment, payload))
+		{
+			std::fprintf(stderr, "Writer busy, sample skipped\n");
+		}
+		else
+		{
+			std::printf("%10llu %8.2f %8.2f %8.2f %7.2f %7.2f %7.2f %10d %6d %6d %8llu %10llu\n",
+				static_cast<unsigned long long>(payload.frameIndex), payload.frameTimeMs, payload.frameTimeAverageMs,
+				payload.frameTimeMaxMs, payload.cpuDSP, payload.cpuStream, payload.cpuStudioUpdate,
+				payload.memoryCurrentBytes / 1024, payload.channelsPlaying, payload.realChannelsPlaying,
+				static_cast<unsigned long long>(payload.activeInstances), static_cast<unsigned long long>(payload.eventsPlayed));
+
+			for (int i = 0; bPrintBanks && i < std::min(payload.bankCount, TELEMETRY_MAX_BANKS); ++i)
+			{
+				const TelemetryBank& bank = payload.banks[i];
+				std::printf("    %-40.*s %-10s samples %-10s load %.2f ms\n", TELEMETRY_MAX_PATH, bank.path,
+					LoadingStateName(bank.loadingState), LoadingStateName(bank.sampleLoadingState), bank.loadTimeMs);
+			}
+		}
+		std::fflush(stdout);
+		std::this_thread::sleep_for(std::chrono::milliseconds(intervalMs));
+	}
+
+	munmap(memory, sizeof(TelemetrySegment));
+	return EXIT_SUCCESS;
+}
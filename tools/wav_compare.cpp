@@ -0,0 +1,280 @@
+/*
+ * WAV Compare
+ * Compares a WAV bounced by FmodCmake (FMOD_CMAKE_BOUNCE, [System] OutputType=WavWriterNRT) against a golden file, so
+ * changes to buffering, sample formats or DSP chains can be checked for audible differences without listening.
+ * Both files are converted to float and the shorter one is padded with silence. The sample difference is scanned
+ * with SSE2 when available and reports the peak and RMS error, the samples over the tolerance and the first divergence.
+ * Exits with 1 when any sample differs by more than the tolerance.
+ *
+ * Usage: FmodCmakeWavCompare <golden wav> <candidate wav> [--tolerance-db -80]
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define WAV_COMPARE_SSE2 1
+#endif
+
+namespace
+{
+	constexpr uint16_t WAVE_FORMAT_PCM = 0x0001;
+	constexpr uint16_t WAVE_FORMAT_IEEE_FLOAT = 0x0003;
+	constexpr uint16_t WAVE_FORMAT_EXTENSIBLE = 0xFFFE;
+
+	// Squares are summed in float per block and flushed to double, so long files keep their precision
+	constexpr size_t SUM_BLOCK_SAMPLES = 4096;
+
+	struct WavFile
+	{
+		int sampleRate = 0;
+		int channels = 0;
+		int bitsPerSample = 0;
+		bool bFloat = false;
+		std::vector<float> samples; // Interleaved
+	};
+
+	struct DiffStats
+	{
+		float peak = 0;
+		double sumSquares = 0;
+		size_t overTolerance = 0;
+		size_t firstOverIndex = 0;
+	};
+
+	uint32_t ReadLE(const uint8_t* bytes, const int byteCount)
+	{
+		uint32_t value = 0;
+		for (int i = 0; i < byteCount; ++i) { value |= static_cast<uint32_t>(bytes[i]) << (8 * i); }
+		return value;
+	}
+
+	float DecodeSample(const uint8_t* bytes, const int bitsPerSample, const bool bFloat)
+	{
+		if (bFloat)
+		{
+			return std::bit_cast<float>(ReadLE(bytes, 4));
+		}
+		switch (bitsPerSample)
+		{
+			case 8: return (static_cast<float>(bytes[0]) - 128.0f) / 128.0f;
+			case 16: return static_cast<float>(static_cast<int16_t>(ReadLE(bytes, 2))) / 32768.0f;
+			case 24: return static_cast<float>(static_cast<int32_t>(ReadLE(bytes, 3) << 8) >> 8) / 8388608.0f;
+			default: return static_cast<float>(static_cast<double>(static_cast<int32_t>(ReadLE(bytes, 4))) / 2147483648.0);
+		}
+	}
+
+	bool ReadWavFile(const std::string& filePath, WavFile& outWav)
+	{
+		std::FILE* file = std::fopen(filePath.c_str(), "rb");
+		if (!file)
+		{
+			std::fprintf(stderr, "Cannot open %s\n", filePath.c_str());
+			return false;
+		}
+
+		std::vector<uint8_t> bytes;
+		uint8_t buffer[65536];
+		for (size_t read; (read = std::fread(buffer, 1, sizeof(buffer), file)) > 0;) { bytes.insert(bytes.end(), buffer, buffer + read); }
+		std::fclose(file);
+
+		if (bytes.size() < 12 || std::memcmp(bytes.data(), "RIFF", 4) != 0 || std::memcmp(bytes.data() + 8, "WAVE", 4) != 0)
+		{
+			std::fprintf(stderr, "%s is not a WAV file\n", filePath.c_str());
+			return false;
+		}
+
+		const uint8_t* data = nullptr;
+		size_t dataSize = 0;
+		uint16_t format = 0;
+		for (size_t offset = 12; offset + 8 <= bytes.size();)
+		{
+			const uint8_t* chunk = bytes.data() + offset;
+			// A writer that did not finish (crash, NRT output not released) leaves sizes of 0, the chunk then runs to the end of the file
+			size_t chunkSize = ReadLE(chunk + 4, 4);
+			if (chunkSize == 0 || chunkSize > bytes.size() - offset - 8) { chunkSize = bytes.size() - offset - 8; }
+
+			if (std::memcmp(chunk, "fmt ", 4) == 0 && chunkSize >= 16)
+			{
+				format = static_cast<uint16_t>(ReadLE(chunk + 8, 2));
+				outWav.channels = static_cast<int>(ReadLE(chunk + 10, 2));
+				outWav.sampleRate = static_cast<int>(ReadLE(chunk + 12, 4));
+				outWav.bitsPerSample = static_cast<int>(ReadLE(chunk + 22, 2));
+				// The sub format GUID starts with the format tag
+				if (format == WAVE_FORMAT_EXTENSIBLE && chunkSize >= 40) { format = static_cast<uint16_t>(ReadLE(chunk + 32, 2)); }
+			}
+			else if (std::memcmp(chunk, "data", 4) == 0)
+			{
+				data = chunk + 8;
+				dataSize = chunkSize;
+			}
+			offset += 8 + chunkSize + (chunkSize & 1);
+		}
+
+		outWav.bFloat = format == WAVE_FORMAT_IEEE_FLOAT;
+		const bool bSupportedPCM = format == WAVE_FORMAT_PCM && (outWav.bitsPerSample == 8 || outWav.bitsPerSample == 16
+			|| outWav.bitsPerSample == 24 || outWav.bitsPerSample == 32);
+		if (!data || outWav.channels <= 0 || outWav.sampleRate <= 0 || !(bSupportedPCM || (outWav.bFloat && outWav.bitsPerSample == 32)))
+		{
+			std::fprintf(stderr, "%s has no data or an unsupported format (%u, %d bits), only PCM 8/16/24/32 and float 32 are supported\n",
+				filePath.c_str(), static_cast<unsigned>(format), outWav.bitsPerSample);
+			return false;
+		}
+
+		const int bytesPerSample = outWav.bitsPerSample / 8;
+		const size_t frameCount = dataSize / (static_cast<size_t>(bytesPerSample) * outWav.channels);
+		outWav.samples.resize(frameCount * outWav.channels);
+		for (size_t i = 0; i < outWav.samples.size(); ++i)
+		{
+			outWav.samples[i] = DecodeSample(data + i * bytesPerSample, outWav.bitsPerSample, outWav.bFloat);
+		}
+		return true;
+	}
+
+	void RecordOverTolerance(DiffStats& stats, const size_t index, const unsigned count)
+	{
+		if (stats.overTolerance == 0) { stats.firstOverIndex = index; }
+		stats.overTolerance += count;
+	}
+
+	// NaN differences count as over the tolerance, hence the "not less or equal" comparisons
+	DiffStats DiffSamples(const float* golden, const float* candidate, const size_t count, const float tolerance)
+	{
+		DiffStats stats;
+		size_t i = 0;
+
+#ifdef WAV_COMPARE_SSE2
+		const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+		const __m128 toleranceVector = _mm_set1_ps(tolerance);
+		const size_t vectorCount = count & ~static_cast<size_t>(3);
+		__m128 peak = _mm_setzero_ps();
+		float lanes[4];
+
+		while (i < vectorCount)
+		{
+			const size_t blockEnd = std::min(vectorCount, i + SUM_BLOCK_SAMPLES);
+			__m128 sumSquares = _mm_setzero_ps();
+			for (; i < blockEnd; i += 4)
+			{
+				const __m128 diff = _mm_and_ps(_mm_sub_ps(_mm_loadu_ps(golden + i), _mm_loadu_ps(candidate + i)), absMask);
+				peak = _mm_max_ps(peak, diff);
+				sumSquares = _mm_add_ps(sumSquares, _mm_mul_ps(diff, diff));
+
+				if (const auto overMask = static_cast<unsigned>(_mm_movemask_ps(_mm_cmpnle_ps(diff, toleranceVector))); overMask != 0)
+				{
+					RecordOverTolerance(stats, i + std::countr_zero(overMask), std::popcount(overMask));
+				}
+			}
+			_mm_storeu_ps(lanes, sumSquares);
+			stats.sumSquares += static_cast<double>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+		}
+
+		_mm_storeu_ps(lanes, peak);
+		stats.peak = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+#endif
+
+		for (; i < count; ++i)
+		{
+			const float diff = std::fabs(golden[i] - candidate[i]);
+			stats.peak = std::max(stats.peak, diff);
+			stats.sumSquares += static_cast<double>(diff) * diff;
+			if (!(diff <= tolerance)) { RecordOverTolerance(stats, i, 1); }
+		}
+		return stats;
+	}
+
+	double ToDecibels(const double amplitude)
+	{
+		return amplitude > 0 ? 20.0 * std::log10(amplitude) : -INFINITY;
+	}
+
+	void PrintWav(const char* label, const std::string& filePath, const WavFile& wav)
+	{
+		const size_t frameCount = wav.samples.size() / wav.channels;
+		std::printf("%-10s %s: %d Hz, %d channel(s), %s %d, %.3f s\n", label, filePath.c_str(), wav.sampleRate, wav.channels,
+			wav.bFloat ? "float" : "PCM", wav.bitsPerSample, static_cast<double>(frameCount) / wav.sampleRate);
+	}
+
+	void PrintUsage(const char* program)
+	{
+		std::printf("Usage: %s <golden wav> <candidate wav> [--tolerance-db <dBFS, default -80>]\n", program);
+	}
+}
+
+int main(const int argc, char* argv[])
+{
+	std::string goldenPath;
+	std::string candidatePath;
+	double toleranceDb = -80.0;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string argument = argv[i];
+		if (argument == "--tolerance-db" && i + 1 < argc) { toleranceDb = std::atof(argv[++i]); }
+		else if (goldenPath.empty() && argument.rfind("--", 0) != 0) { goldenPath = argument; }
+		else if (candidatePath.empty() && argument.rfind("--", 0) != 0) { candidatePath = argument; }
+		else
+		{
+			PrintUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (goldenPath.empty() || candidatePath.empty())
+	{
+		PrintUsage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	WavFile golden;
+	WavFile candidate;
+	if (!ReadWavFile(goldenPath, golden) || !ReadWavFile(candidatePath, candidate)) { return EXIT_FAILURE; }
+
+	PrintWav("Golden", goldenPath, golden);
+	PrintWav("Candidate", candidatePath, candidate);
+	if (golden.sampleRate != candidate.sampleRate || golden.channels != candidate.channels)
+	{
+		std::printf("FAIL: sample rate or channel count differ\n");
+		return EXIT_FAILURE;
+	}
+
+	// A missing tail is compared against silence, so a shorter bounce diverges where it ends
+	const size_t lengthDifference = golden.samples.size() > candidate.samples.size()
+		? golden.samples.size() - candidate.samples.size() : candidate.samples.size() - golden.samples.size();
+	const size_t sampleCount = std::max(golden.samples.size(), candidate.samples.size());
+	golden.samples.resize(sampleCount, 0.0f);
+	candidate.samples.resize(sampleCount, 0.0f);
+
+	const auto tolerance = static_cast<float>(std::pow(10.0, toleranceDb / 20.0));
+	const DiffStats stats = DiffSamples(golden.samples.data(), candidate.samples.data(), sampleCount, tolerance);
+	const double rms = sampleCount > 0 ? std::sqrt(stats.sumSquares / static_cast<double>(sampleCount)) : 0.0;
+
+	if (lengthDifference > 0)
+	{
+		std::printf("Length differs by %.3f s\n", static_cast<double>(lengthDifference / golden.channels) / golden.sampleRate);
+	}
+	std::printf("Peak error: %.9f (%.1f dBFS)\n", stats.peak, ToDecibels(stats.peak));
+	std::printf("RMS error:  %.9f (%.1f dBFS)\n", rms, ToDecibels(rms));
+	std::printf("Samples over %.1f dBFS: %zu of %zu\n", toleranceDb, stats.overTolerance, sampleCount);
+
+	if (stats.overTolerance == 0)
+	{
+		std::printf("PASS\n");
+		return EXIT_SUCCESS;
+	}
+
+	const size_t frame = stats.firstOverIndex / golden.channels;
+	std::printf("First divergence: %.6f s (frame %zu, channel %zu, golden %.6f, candidate %.6f)\n",
+		static_cast<double>(frame) / golden.sampleRate, frame, stats.firstOverIndex % golden.channels,
+		golden.samples[stats.firstOverIndex], candidate.samples[stats.firstOverIndex]);
+	std::printf("FAIL\n");
+	return EXIT_FAILURE;
+}